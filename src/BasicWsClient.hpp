@@ -0,0 +1,371 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#pragma once
+
+#include "Protocol.hpp"
+#include "MessageHandler.hpp"
+#include "Logger.hpp"
+
+#include <string>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <type_traits>
+
+// Included directly (unlike the Pimpl-hidden WsClient): the whole point of
+// this template is that the send path inlines down into the library call,
+// which requires the library types to be visible at the call site
+#include <ixwebsocket/IXNetSystem.h>
+#include <ixwebsocket/IXWebSocket.h>
+
+/**
+ * @namespace ClientPolicy
+ * @brief Compile-time policy tags for BasicWsClient feature stripping.
+ *
+ * Each policy is a tag type with constexpr flags; BasicWsClient branches on
+ * them with `if constexpr`, so disabled features are removed by the compiler
+ * rather than skipped at runtime - no branch, no load, no code.
+ */
+namespace ClientPolicy
+{
+    /// @brief Per-message Debug logging on the send/receive paths (WsClient behavior)
+    struct VerboseLogging
+    {
+        static constexpr bool kLogging = true;
+    };
+
+    /// @brief No per-message logging; only construction/teardown events remain
+    struct NoLogging
+    {
+        static constexpr bool kLogging = false;
+    };
+
+    /// @brief Check the connection state before every send (WsClient behavior)
+    struct CheckedState
+    {
+        static constexpr bool kStateChecked = true;
+    };
+
+    /// @brief Skip the pre-send state check; the library rejects dead sends itself
+    struct UncheckedState
+    {
+        static constexpr bool kStateChecked = false;
+    };
+
+    /// @brief Track BinaryStart sizes and synthesize completion (WsClient behavior)
+    struct TrackedReassembly
+    {
+        static constexpr bool kReassembly = true;
+    };
+
+    /// @brief Deliver binary chunks raw, with no size crediting or completion
+    struct RawBinary
+    {
+        static constexpr bool kReassembly = false;
+    };
+}
+
+/**
+ * @class BasicWsClient
+ * @brief Policy-stripped, statically-dispatched WebSocket client.
+ *
+ * WsClient pays for every feature on every message - per-message Debug log
+ * construction, the binary reassembly bookkeeping, the pre-send state check,
+ * virtual router dispatch - even when a deployment needs none of them.
+ * BasicWsClient resolves those choices at compile time instead: the handler
+ * is a template parameter dispatched through MessageRouterT (no virtuals),
+ * and logging / state-checking / reassembly are policy tags stripped with
+ * `if constexpr`. A fully stripped instantiation's SendText compiles down to
+ * little more than the ix::WebSocket::sendText call.
+ *
+ * What this client deliberately does NOT have (use WsClient for these):
+ * auto-reconnect, ack windows and retransmits, priority send scheduling,
+ * RTT probing, adaptive compression, traffic capture, executor-mode routing,
+ * runtime handler swapping. It is the latency-critical minimal core, not a
+ * replacement default.
+ *
+ * @tparam Handler Concrete handler type (MessageRouterT requirements apply)
+ * @tparam LoggingPolicy ClientPolicy::VerboseLogging or NoLogging
+ * @tparam StatePolicy ClientPolicy::CheckedState or UncheckedState
+ * @tparam BinaryPolicy ClientPolicy::TrackedReassembly or RawBinary
+ *
+ * @note Header-only by design, and includes the IXWebSocket headers directly -
+ *       the inlining this class exists for requires the library types to be
+ *       visible, so the Pimpl convention of WsClient is intentionally not
+ *       followed here.
+ * @note Thread-safety matches WsClient's contract: Send* from any thread,
+ *       Open/Connect/Close from one controlling thread, callbacks on the
+ *       library's internal thread.
+ *
+ * @example
+ *   struct FastHandler { ... };  // Plain struct, MessageRouterT-compatible
+ *   FastHandler handler;
+ *   BasicWsClient<FastHandler,
+ *                 ClientPolicy::NoLogging,
+ *                 ClientPolicy::UncheckedState,
+ *                 ClientPolicy::RawBinary> client(handler);
+ *   client.Open();
+ *   client.Connect("ws://server:9001");
+ *   client.WaitForConnection(5000);
+ *   client.SendText(payload);   // State check, logging, bookkeeping: all gone
+ */
+template <typename Handler,
+          typename LoggingPolicy = ClientPolicy::VerboseLogging,
+          typename StatePolicy = ClientPolicy::CheckedState,
+          typename BinaryPolicy = ClientPolicy::TrackedReassembly>
+class BasicWsClient
+{
+public:
+    /**
+     * @brief Bind the client to a handler instance.
+     *
+     * @param pHandler Handler to dispatch to; must outlive the client
+     * @param pConfig Protocol configuration (timeouts and limits)
+     */
+    explicit BasicWsClient(Handler& pHandler,
+                           const Protocol::Config& pConfig = Protocol::Config())
+        : mConfig(pConfig)
+        , mRouter(pHandler)
+    {
+    }
+
+    ~BasicWsClient()
+    {
+        Close();
+    }
+
+    // One connection per instance, same as WsClient
+    BasicWsClient(const BasicWsClient&) = delete;
+    BasicWsClient& operator=(const BasicWsClient&) = delete;
+
+    /**
+     * @brief Initialize the network system and install the message callback.
+     *
+     * @return true if the network system initialized
+     */
+    bool Open()
+    {
+        if (!ix::initNetSystem())
+        {
+            Logger::Instance().Error("BasicWsClient",
+                "Failed to initialize network system");
+            return false;
+        }
+
+        mWs.disableAutomaticReconnection();
+
+        mWs.setOnMessageCallback(
+            [this](const ix::WebSocketMessagePtr& msg)
+            {
+                switch (msg->type)
+                {
+                case ix::WebSocketMessageType::Open:
+                    {
+                        std::lock_guard<std::mutex> lock(mStateMutex);
+                        mConnected.store(true, std::memory_order_release);
+                    }
+                    mStateCV.notify_all();
+                    break;
+
+                case ix::WebSocketMessageType::Message:
+                    OnMessage(std::move(msg->str), msg->binary);
+                    break;
+
+                case ix::WebSocketMessageType::Close:
+                case ix::WebSocketMessageType::Error:
+                    {
+                        std::lock_guard<std::mutex> lock(mStateMutex);
+                        mConnected.store(false, std::memory_order_release);
+                    }
+                    mStateCV.notify_all();
+                    if (msg->type == ix::WebSocketMessageType::Error)
+                        mRouter.RouteProtocolError(msg->errorInfo.reason);
+                    break;
+
+                default:
+                    break;  // Ping/Pong/Fragment - nothing to strip or track
+                }
+            });
+
+        return true;
+    }
+
+    /**
+     * @brief Initiate the connection (non-blocking).
+     *
+     * @param pUrl WebSocket URL (e.g., "ws://localhost:9001")
+     */
+    void Connect(const std::string& pUrl)
+    {
+        mWs.setUrl(pUrl);
+        mWs.start();
+    }
+
+    /**
+     * @brief Block until connected or the timeout expires.
+     *
+     * @param pTimeoutMs Timeout in milliseconds
+     * @return true if connected
+     */
+    bool WaitForConnection(int pTimeoutMs = 10000)
+    {
+        std::unique_lock<std::mutex> lock(mStateMutex);
+        return mStateCV.wait_for(lock, std::chrono::milliseconds(pTimeoutMs),
+            [this] { return mConnected.load(std::memory_order_acquire); });
+    }
+
+    /**
+     * @brief Send a text frame.
+     *
+     * With UncheckedState and NoLogging this is a single forwarded call into
+     * the library - no branch, no atomic load, no log construction.
+     *
+     * @param pText Frame payload
+     * @return true if the frame was queued for sending
+     */
+    bool SendText(const std::string& pText)
+    {
+        if constexpr (StatePolicy::kStateChecked)
+        {
+            if (!mConnected.load(std::memory_order_acquire))
+            {
+                if constexpr (LoggingPolicy::kLogging)
+                    Logger::Instance().Warning("BasicWsClient",
+                        "SendText while not connected - rejected");
+                return false;
+            }
+        }
+
+        if constexpr (LoggingPolicy::kLogging)
+            Logger::Instance().Debug("BasicWsClient", [&pText] {
+                return "[SEND][TEXT] " + std::to_string(pText.size()) + " bytes"; });
+
+        return mWs.sendText(pText).success;
+    }
+
+    /**
+     * @brief Send a binary frame.
+     *
+     * @param pData Frame payload (binary bytes in a string, IXWebSocket form)
+     * @return true if the frame was queued for sending
+     */
+    bool SendBinary(const std::string& pData)
+    {
+        if constexpr (StatePolicy::kStateChecked)
+        {
+            if (!mConnected.load(std::memory_order_acquire))
+            {
+                if constexpr (LoggingPolicy::kLogging)
+                    Logger::Instance().Warning("BasicWsClient",
+                        "SendBinary while not connected - rejected");
+                return false;
+            }
+        }
+
+        if constexpr (LoggingPolicy::kLogging)
+            Logger::Instance().Debug("BasicWsClient", [&pData] {
+                return "[SEND][BINARY] " + std::to_string(pData.size()) + " bytes"; });
+
+        return mWs.sendBinary(pData).success;
+    }
+
+    /**
+     * @brief Close the connection.
+     */
+    void Close()
+    {
+        mWs.stop();
+        mConnected.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Whether the connection is currently established.
+     *
+     * @return true if connected
+     */
+    bool IsConnected() const
+    {
+        return mConnected.load(std::memory_order_acquire);
+    }
+
+private:
+    /// @brief Receive dispatch - the policy-stripped mirror of WsClient::OnMessage
+    void OnMessage(std::string&& pMsg, bool pIsBinary)
+    {
+        if (pIsBinary)
+        {
+            if constexpr (LoggingPolicy::kLogging)
+                Logger::Instance().Debug("BasicWsClient", [&pMsg] {
+                    return "[RECV][BINARY] " + std::to_string(pMsg.size()) +
+                           " bytes"; });
+
+            if constexpr (BinaryPolicy::kReassembly)
+            {
+                // Single-stream crediting: chunks count toward the announced
+                // size and completion is synthesized when it is reached
+                bool complete = false;
+                if (mExpectedBinarySize > 0)
+                {
+                    mBinaryReceived += pMsg.size();
+                    if (mBinaryReceived >= mExpectedBinarySize)
+                    {
+                        complete = true;
+                        mExpectedBinarySize = 0;
+                        mBinaryReceived = 0;
+                    }
+                }
+
+                mRouter.RouteBinaryDataOwned(std::string(), std::move(pMsg));
+                if (complete)
+                    mRouter.RouteBinaryComplete();
+            }
+            else
+            {
+                // Raw delivery - no bookkeeping, no overflow arithmetic
+                mRouter.RouteBinaryDataOwned(std::string(), std::move(pMsg));
+            }
+        }
+        else
+        {
+            if constexpr (LoggingPolicy::kLogging)
+                Logger::Instance().Debug("BasicWsClient", [&pMsg] {
+                    return "[RECV][TEXT] " + pMsg.substr(0, 100) +
+                           (pMsg.length() > 100 ? "..." : ""); });
+
+            const Protocol::MessageView msg = Protocol::ParseJsonMessageView(pMsg);
+
+            if constexpr (BinaryPolicy::kReassembly)
+            {
+                if (msg.type == Protocol::MessageType::BinaryStart)
+                {
+                    if (msg.binarySize == 0 ||
+                        msg.binarySize > mConfig.maxBinaryPayloadSize)
+                    {
+                        mRouter.RouteProtocolError(
+                            "Invalid BinaryStart size: " +
+                            std::to_string(msg.binarySize));
+                        return;
+                    }
+                    mExpectedBinarySize = msg.binarySize;
+                    mBinaryReceived = 0;
+                }
+            }
+
+            mRouter.RouteMessageView(msg);
+        }
+    }
+
+    ix::WebSocket mWs;                    ///< The underlying library socket
+    Protocol::Config mConfig;             ///< Timeouts and limits
+    MessageRouterT<Handler> mRouter;      ///< Statically-dispatched router
+
+    std::atomic<bool> mConnected{false};  ///< Lock-free connection flag
+    std::mutex mStateMutex;               ///< Pairs with mStateCV for waits
+    std::condition_variable mStateCV;     ///< Signals connect/disconnect
+
+    // Reassembly state - only touched (and only present in any meaningful
+    // sense) under TrackedReassembly; callbacks arrive on one library thread
+    // so no lock is needed
+    size_t mExpectedBinarySize = 0;       ///< Announced size of the open transfer
+    size_t mBinaryReceived = 0;           ///< Bytes credited so far
+};
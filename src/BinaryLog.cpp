@@ -0,0 +1,517 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#include "BinaryLog.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <sstream>
+#include <iomanip>
+
+/**
+ * @file BinaryLog.cpp
+ * @brief Implementation of the structured binary logging backend.
+ */
+
+namespace
+{
+    /// @brief Append a uint16 in little-endian byte order
+    void AppendU16(std::string& pOut, uint16_t pValue)
+    {
+        pOut.push_back(static_cast<char>(pValue & 0xFF));
+        pOut.push_back(static_cast<char>((pValue >> 8) & 0xFF));
+    }
+
+    /// @brief Append a uint32 in little-endian byte order
+    void AppendU32(std::string& pOut, uint32_t pValue)
+    {
+        for (int i = 0; i < 4; ++i)
+            pOut.push_back(static_cast<char>((pValue >> (i * 8)) & 0xFF));
+    }
+
+    /// @brief Append a uint64 in little-endian byte order
+    void AppendU64(std::string& pOut, uint64_t pValue)
+    {
+        for (int i = 0; i < 8; ++i)
+            pOut.push_back(static_cast<char>((pValue >> (i * 8)) & 0xFF));
+    }
+
+    /// @brief Read a little-endian uint16 from a raw byte stream
+    bool ReadU16(std::ifstream& pFile, uint16_t& pValue)
+    {
+        unsigned char bytes[2];
+        if (!pFile.read(reinterpret_cast<char*>(bytes), 2))
+            return false;
+        pValue = static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
+        return true;
+    }
+
+    /// @brief Read a little-endian uint32 from a raw byte stream
+    bool ReadU32(std::ifstream& pFile, uint32_t& pValue)
+    {
+        unsigned char bytes[4];
+        if (!pFile.read(reinterpret_cast<char*>(bytes), 4))
+            return false;
+        pValue = 0;
+        for (int i = 0; i < 4; ++i)
+            pValue |= static_cast<uint32_t>(bytes[i]) << (i * 8);
+        return true;
+    }
+
+    /// @brief Read a little-endian uint64 from a raw byte stream
+    bool ReadU64(std::ifstream& pFile, uint64_t& pValue)
+    {
+        unsigned char bytes[8];
+        if (!pFile.read(reinterpret_cast<char*>(bytes), 8))
+            return false;
+        pValue = 0;
+        for (int i = 0; i < 8; ++i)
+            pValue |= static_cast<uint64_t>(bytes[i]) << (i * 8);
+        return true;
+    }
+
+    /// @brief Raw steady-clock nanoseconds (the record timestamp)
+    uint64_t SteadyNowNanos()
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+}
+
+// ============================================================================
+// BinaryLogWriter
+// ============================================================================
+
+BinaryLogWriter::BinaryLogWriter() = default;
+
+BinaryLogWriter::~BinaryLogWriter()
+{
+    Close();
+}
+
+BinaryLogWriter::ThreadState::~ThreadState()
+{
+    // Salvage whatever this thread staged before its storage disappears
+    if (owner != nullptr)
+        owner->OnThreadExit(this);
+}
+
+bool BinaryLogWriter::Open(const std::string& pPath, size_t pMaxFileBytes)
+{
+    if (mOpen.load(std::memory_order_acquire))
+        return false;  // Already recording - Close first
+
+    std::lock_guard<std::mutex> lock(mSinkMutex);
+
+    mFile.open(pPath, std::ios::binary | std::ios::trunc);
+    if (!mFile.is_open())
+        return false;
+
+    mPath = pPath;
+    mMaxFileBytes = pMaxFileBytes;
+    mFileBytes = 0;
+    mCentral.clear();
+    mCentral.reserve(kFileFlushThreshold);
+    mTagTableBytes.clear();
+    {
+        std::lock_guard<std::mutex> tagLock(mTagMutex);
+        mTags.clear();
+    }
+    mRecordCount.store(0, std::memory_order_relaxed);
+
+    // One epoch pair per session, reused verbatim in rotated file headers so
+    // every record timestamp of the session maps through the same anchors
+    mSystemEpochMicros = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+    mSteadyEpochNanos = SteadyNowNanos();
+
+    WriteFileProlog();
+
+    // New generation: staging buffers bound to an earlier session rebind
+    // (and discard any stale bytes) on their next Write
+    mGeneration.fetch_add(1, std::memory_order_release);
+    mOpen.store(true, std::memory_order_release);
+    return true;
+}
+
+void BinaryLogWriter::Write(uint8_t pLevel, const std::string& pTag,
+                            const std::string& pMessage)
+{
+    if (!mOpen.load(std::memory_order_acquire))
+        return;
+
+    ThreadState& state = GetThreadState();
+    const uint16_t tagId = InternTag(state, pTag);
+    const uint64_t nanos = SteadyNowNanos();
+
+    bool shouldDrain = false;
+    {
+        // Uncontended except when Close or the drain path is stealing the
+        // buffer - this lock plus the appends IS the hot path
+        std::lock_guard<std::mutex> lock(state.mutex);
+        std::string& buffer = state.buffer;
+        buffer.push_back(static_cast<char>(kRecordMessage));
+        buffer.push_back(static_cast<char>(pLevel));
+        AppendU16(buffer, tagId);
+        AppendU64(buffer, nanos);
+        AppendU32(buffer, static_cast<uint32_t>(pMessage.size()));
+        buffer.append(pMessage);
+        shouldDrain = buffer.size() >= kStagingFlushThreshold;
+    }
+
+    mRecordCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (shouldDrain)
+        DrainThreadState(state);
+}
+
+void BinaryLogWriter::Flush()
+{
+    if (!mOpen.load(std::memory_order_acquire))
+        return;
+
+    DrainThreadState(GetThreadState());
+
+    std::lock_guard<std::mutex> lock(mSinkMutex);
+    FlushLocked();
+    mFile.flush();
+}
+
+void BinaryLogWriter::Close()
+{
+    if (!mOpen.load(std::memory_order_acquire))
+        return;
+
+    // Stop accepting records first so the drain below sees a stable picture
+    mOpen.store(false, std::memory_order_release);
+
+    // Steal every registered thread's staged bytes - threads that raced past
+    // the mOpen check above land harmlessly in buffers cleared on rebind
+    std::string staged;
+    {
+        std::lock_guard<std::mutex> registryLock(mRegistryMutex);
+        for (ThreadState* state : mStates)
+        {
+            std::lock_guard<std::mutex> stateLock(state->mutex);
+            staged.append(state->buffer);
+            state->buffer.clear();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mSinkMutex);
+    mCentral.append(staged);
+    FlushLocked();
+    mFile.flush();
+    mFile.close();
+}
+
+BinaryLogWriter::ThreadState& BinaryLogWriter::GetThreadState()
+{
+    thread_local ThreadState tState;
+
+    const uint32_t generation = mGeneration.load(std::memory_order_acquire);
+    if (tState.owner != this || tState.generation != generation)
+    {
+        // Rebind to the current session: stale staged bytes belong to a file
+        // that is already closed (or a different writer) and are dropped
+        if (tState.owner != nullptr && tState.owner != this)
+            tState.owner->OnThreadExit(&tState);
+
+        {
+            std::lock_guard<std::mutex> lock(tState.mutex);
+            tState.buffer.clear();
+            tState.buffer.reserve(kStagingFlushThreshold);
+        }
+        tState.tagCache.clear();
+        tState.generation = generation;
+        tState.owner = this;
+
+        if (!tState.registered)
+        {
+            std::lock_guard<std::mutex> lock(mRegistryMutex);
+            mStates.push_back(&tState);
+            tState.registered = true;
+        }
+    }
+
+    return tState;
+}
+
+uint16_t BinaryLogWriter::InternTag(ThreadState& pState, const std::string& pTag)
+{
+    // Thread-private cache first - after warmup this is the only lookup
+    auto cached = pState.tagCache.find(pTag);
+    if (cached != pState.tagCache.end())
+        return cached->second;
+
+    uint16_t tagId = 0;
+    bool isNew = false;
+    {
+        std::lock_guard<std::mutex> lock(mTagMutex);
+        auto it = mTags.find(pTag);
+        if (it != mTags.end())
+        {
+            tagId = it->second;
+        }
+        else
+        {
+            tagId = static_cast<uint16_t>(mTags.size());
+            mTags.emplace(pTag, tagId);
+            isNew = true;
+        }
+    }
+
+    if (isNew)
+    {
+        // Definition records go straight into the central buffer, which all
+        // staged message records are appended to later - so a definition
+        // always precedes the first use of its id in the file
+        std::string def;
+        def.push_back(static_cast<char>(kRecordTagDefinition));
+        AppendU16(def, tagId);
+        AppendU16(def, static_cast<uint16_t>(pTag.size()));
+        def.append(pTag);
+
+        std::lock_guard<std::mutex> lock(mSinkMutex);
+        mCentral.append(def);
+        mTagTableBytes.append(def);  // Replayed into rotated files
+    }
+
+    pState.tagCache.emplace(pTag, tagId);
+    return tagId;
+}
+
+void BinaryLogWriter::DrainThreadState(ThreadState& pState)
+{
+    std::string batch;
+    {
+        std::lock_guard<std::mutex> lock(pState.mutex);
+        batch.swap(pState.buffer);
+        pState.buffer.reserve(kStagingFlushThreshold);
+    }
+
+    if (batch.empty())
+        return;
+
+    std::lock_guard<std::mutex> lock(mSinkMutex);
+    mCentral.append(batch);
+    if (mCentral.size() >= kFileFlushThreshold)
+        FlushLocked();
+}
+
+void BinaryLogWriter::FlushLocked()
+{
+    if (mCentral.empty() || !mFile.is_open())
+        return;
+
+    // Rotate before the write that would blow the limit: the current file is
+    // renamed to "<path>.1" (dropping any previous rotation) and a fresh one
+    // starts with the same session header plus the tag table so far
+    if (mFileBytes + mCentral.size() > mMaxFileBytes && mFileBytes > 0)
+    {
+        mFile.flush();
+        mFile.close();
+
+        const std::string rotated = mPath + ".1";
+        std::remove(rotated.c_str());
+        std::rename(mPath.c_str(), rotated.c_str());
+
+        mFile.open(mPath, std::ios::binary | std::ios::trunc);
+        mFileBytes = 0;
+        if (!mFile.is_open())
+            return;  // Reopen failed - records in mCentral are lost
+        WriteFileProlog();
+    }
+
+    mFile.write(mCentral.data(), static_cast<std::streamsize>(mCentral.size()));
+    mFileBytes += mCentral.size();
+    mCentral.clear();
+}
+
+void BinaryLogWriter::WriteFileProlog()
+{
+    std::string header;
+    header.append(kMagic, sizeof(kMagic));
+    header.push_back(static_cast<char>(kFormatVersion));
+    AppendU64(header, mSystemEpochMicros);
+    AppendU64(header, mSteadyEpochNanos);
+    header.append(mTagTableBytes);
+
+    mFile.write(header.data(), static_cast<std::streamsize>(header.size()));
+    mFileBytes += header.size();
+}
+
+void BinaryLogWriter::OnThreadExit(ThreadState* pState)
+{
+    // Unregister first so Close cannot walk into a dying state
+    {
+        std::lock_guard<std::mutex> lock(mRegistryMutex);
+        mStates.erase(std::remove(mStates.begin(), mStates.end(), pState),
+                      mStates.end());
+    }
+    pState->registered = false;
+    pState->owner = nullptr;
+
+    // Salvage staged records if the session is still live
+    if (mOpen.load(std::memory_order_acquire) &&
+        pState->generation == mGeneration.load(std::memory_order_acquire))
+    {
+        DrainThreadState(*pState);
+    }
+}
+
+// ============================================================================
+// BinaryLogReader
+// ============================================================================
+
+BinaryLogReader::BinaryLogReader() = default;
+
+BinaryLogReader::~BinaryLogReader()
+{
+    Close();
+}
+
+bool BinaryLogReader::Open(const std::string& pPath)
+{
+    Close();
+
+    mFile.open(pPath, std::ios::binary);
+    if (!mFile.is_open())
+        return false;
+
+    char magic[sizeof(BinaryLogWriter::kMagic)];
+    if (!mFile.read(magic, sizeof(magic)) ||
+        std::memcmp(magic, BinaryLogWriter::kMagic, sizeof(magic)) != 0)
+    {
+        Close();
+        return false;
+    }
+
+    char version = 0;
+    if (!mFile.read(&version, 1) ||
+        static_cast<uint8_t>(version) != BinaryLogWriter::kFormatVersion)
+    {
+        Close();
+        return false;
+    }
+
+    if (!ReadU64(mFile, mSystemEpochMicros) || !ReadU64(mFile, mSteadyEpochNanos))
+    {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+bool BinaryLogReader::ReadNext(Record& pRecord)
+{
+    if (!mFile.is_open())
+        return false;
+
+    // Consume tag definitions silently until a message record surfaces
+    for (;;)
+    {
+        char type = 0;
+        if (!mFile.read(&type, 1))
+            return false;  // Clean end of log
+
+        if (static_cast<uint8_t>(type) == BinaryLogWriter::kRecordTagDefinition)
+        {
+            uint16_t tagId = 0;
+            uint16_t length = 0;
+            if (!ReadU16(mFile, tagId) || !ReadU16(mFile, length))
+                return false;
+            std::string tag(length, '\0');
+            if (length > 0 && !mFile.read(&tag[0], length))
+                return false;
+            mTags[tagId] = std::move(tag);
+            continue;
+        }
+
+        if (static_cast<uint8_t>(type) != BinaryLogWriter::kRecordMessage)
+            return false;  // Unknown record type - treat as corruption
+
+        char level = 0;
+        uint16_t tagId = 0;
+        uint32_t length = 0;
+        if (!mFile.read(&level, 1) || !ReadU16(mFile, tagId) ||
+            !ReadU64(mFile, pRecord.steadyNanos) || !ReadU32(mFile, length))
+        {
+            return false;  // Truncated record
+        }
+
+        pRecord.message.resize(length);
+        if (length > 0 && !mFile.read(&pRecord.message[0], length))
+            return false;
+
+        pRecord.level = static_cast<uint8_t>(level);
+
+        auto it = mTags.find(tagId);
+        pRecord.tag = (it != mTags.end())
+            ? it->second
+            : "tag#" + std::to_string(tagId);  // Definition lost (shouldn't happen)
+
+        // Map raw steady ticks to wall clock through the header's epoch pair
+        const uint64_t sinceEpochNanos =
+            (pRecord.steadyNanos >= mSteadyEpochNanos)
+                ? pRecord.steadyNanos - mSteadyEpochNanos
+                : 0;
+        pRecord.wallMicros = mSystemEpochMicros + sinceEpochNanos / 1000;
+
+        return true;
+    }
+}
+
+uint64_t BinaryLogReader::RenderTo(std::ostream& pOut)
+{
+    // Records are in flush order in the file; collect and re-sort by the
+    // steady-clock timestamp so the output reads like the live console did
+    std::vector<Record> records;
+    Record record;
+    while (ReadNext(record))
+        records.push_back(std::move(record));
+
+    std::stable_sort(records.begin(), records.end(),
+        [](const Record& a, const Record& b)
+        {
+            return a.steadyNanos < b.steadyNanos;
+        });
+
+    for (const Record& r : records)
+        pOut << FormatLine(r) << "\n";
+
+    return records.size();
+}
+
+void BinaryLogReader::Close()
+{
+    if (mFile.is_open())
+        mFile.close();
+    mTags.clear();
+    mSystemEpochMicros = 0;
+    mSteadyEpochNanos = 0;
+}
+
+std::string BinaryLogReader::FormatLine(const Record& pRecord) const
+{
+    // Mirror Logger's console format exactly: "HH:MM:SS.mmm [LVL][TAG] message"
+    const time_t seconds = static_cast<time_t>(pRecord.wallMicros / 1000000);
+    const unsigned millis =
+        static_cast<unsigned>((pRecord.wallMicros / 1000) % 1000);
+
+    struct tm timeInfo;
+    localtime_s(&timeInfo, &seconds);
+
+    static const char* const kLevelNames[] = {"DBG", "INF", "WRN", "ERR"};
+    const char* levelStr =
+        (pRecord.level < 4) ? kLevelNames[pRecord.level] : "???";
+
+    std::stringstream ss;
+    ss << std::put_time(&timeInfo, "%H:%M:%S")
+       << "." << std::setfill('0') << std::setw(3) << millis
+       << " [" << levelStr << "][" << pRecord.tag << "] " << pRecord.message;
+    return ss.str();
+}
@@ -0,0 +1,339 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#pragma once
+
+#include <string>
+#include <fstream>
+#include <mutex>
+#include <atomic>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+#include <ostream>
+
+/**
+ * @file BinaryLog.hpp
+ * @brief Structured binary logging backend for the Logger singleton.
+ *
+ * The text path in Logger formats every record (GetTimestamp alone does a
+ * chrono-to-string conversion per call) and writes it to the console, which
+ * makes high-volume Debug logging unaffordable exactly when it matters -
+ * under load. The classes here replace that with a structured pipeline:
+ * records are captured as compact binary entries (raw steady-clock ticks,
+ * level byte, interned tag id, message bytes) into per-thread staging
+ * buffers, batched into a large file with rotation, and rendered back to
+ * the familiar text format offline by BinaryLogReader.
+ *
+ * @see Logger::EnableBinaryLog, TrafficRecorder (same capture-then-replay
+ *      philosophy applied to wire frames)
+ */
+
+/**
+ * @class BinaryLogWriter
+ * @brief Appends log records as compact binary entries to a rotated file.
+ *
+ * File format (little-endian):
+ * - 24-byte header: magic "TIXWBLG" + format version byte,
+ *   uint64 system-clock microseconds at session start,
+ *   uint64 steady-clock nanoseconds at session start
+ *   (the pair lets the reader map steady ticks back to wall-clock time)
+ * - Records, each starting with a uint8 type:
+ *   - Tag definition (type 1): uint16 tag id, uint16 length, tag bytes.
+ *     Emitted once per distinct tag, always before the first record that
+ *     references the id.
+ *   - Message (type 0): uint8 level, uint16 tag id,
+ *     uint64 steady-clock nanoseconds, uint32 length, message bytes.
+ *
+ * Hot-path cost: a Write is one steady_clock read, a hash lookup in the
+ * calling thread's private tag cache, an uncontended mutex and a memcpy
+ * into that thread's staging buffer - no formatting, no syscall, no shared
+ * lock. Staging buffers drain into a central buffer when they fill, and the
+ * central buffer hits the file in large blocks.
+ *
+ * Rotation: when the file exceeds the configured limit it is renamed to
+ * "<path>.1" (replacing any previous rotation) and a fresh file is started
+ * with the same session header and a replay of the tag table, so each file
+ * is independently renderable. At most two files exist at a time.
+ *
+ * Thread Safety:
+ * - Write is safe from any number of threads
+ * - Open and Close are intended for one controlling thread
+ * - Records from different threads are written in flush order, not
+ *   timestamp order; BinaryLogReader re-sorts by timestamp when rendering
+ *
+ * @note Threads that logged during a session and then stay idle keep their
+ *       last partial batch staged until they log again, the thread exits,
+ *       or Close drains all registered staging buffers.
+ *
+ * @see BinaryLogReader, Logger::EnableBinaryLog
+ */
+class BinaryLogWriter
+{
+public:
+    /// @brief File header: 7 magic bytes + format version
+    static constexpr char kMagic[7] = {'T', 'I', 'X', 'W', 'B', 'L', 'G'};
+
+    /// @brief Current format version byte
+    static constexpr uint8_t kFormatVersion = 1;
+
+    /// @brief Record type bytes
+    static constexpr uint8_t kRecordMessage = 0;
+    static constexpr uint8_t kRecordTagDefinition = 1;
+
+    /// @brief Constructor - no file is opened yet
+    BinaryLogWriter();
+
+    /// @brief Destructor - drains staging buffers and closes the log if still open
+    ~BinaryLogWriter();
+
+    // Non-copyable, non-movable (owns the file and is shared by reference)
+    BinaryLogWriter(const BinaryLogWriter&) = delete;
+    BinaryLogWriter& operator=(const BinaryLogWriter&) = delete;
+
+    /**
+     * @brief Open (truncate) the log file and write the session header.
+     *
+     * Captures the system-clock / steady-clock epoch pair that the header
+     * carries; all record timestamps in this session are interpreted
+     * against it.
+     *
+     * @param pPath Log file path (overwritten if it exists; rotation uses
+     *              "<path>.1")
+     * @param pMaxFileBytes Rotate when the file exceeds this size
+     *                      (default 64 MB)
+     * @return true if the file is ready for writing
+     */
+    bool Open(const std::string& pPath, size_t pMaxFileBytes = 64 * 1024 * 1024);
+
+    /**
+     * @brief Append one record to the calling thread's staging buffer.
+     *
+     * Silently ignored when no file is open. The level byte uses the
+     * Logger::Level numbering (0=Debug .. 3=Error) but is taken as a raw
+     * uint8_t so this class has no Logger dependency.
+     *
+     * @param pLevel Severity (0=Debug, 1=Info, 2=Warning, 3=Error)
+     * @param pTag Component tag; interned to a uint16 id on first use
+     * @param pMessage Message bytes, stored verbatim
+     */
+    void Write(uint8_t pLevel, const std::string& pTag, const std::string& pMessage);
+
+    /**
+     * @brief Push the calling thread's staged records and the central buffer
+     *        to the file.
+     *
+     * Write batches aggressively; call this at quiet points if records must
+     * be on disk promptly (other threads' staging buffers are not touched).
+     */
+    void Flush();
+
+    /**
+     * @brief Drain every registered staging buffer, flush, and close the file.
+     *
+     * Safe to call when no file is open.
+     */
+    void Close();
+
+    /// @brief Whether a file is currently open for writing
+    bool IsOpen() const { return mOpen.load(std::memory_order_acquire); }
+
+    /// @brief Message records accepted since Open
+    uint64_t GetRecordCount() const
+    {
+        return mRecordCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    /**
+     * @struct ThreadState
+     * @brief Per-thread staging buffer and private tag cache.
+     *
+     * One instance lives in thread-local storage per logging thread. The
+     * buffer is guarded by its own (almost always uncontended) mutex so
+     * Close and the flush path can steal staged bytes from other threads;
+     * the tag cache is touched only by the owning thread.
+     */
+    struct ThreadState
+    {
+        ~ThreadState();
+
+        std::mutex mutex;                                ///< Guards buffer against flush/Close
+        std::string buffer;                              ///< Staged record bytes
+        std::unordered_map<std::string, uint16_t> tagCache;  ///< Thread-private tag id cache
+        BinaryLogWriter* owner = nullptr;                ///< Writer this state is bound to
+        uint32_t generation = 0;                         ///< Session the buffer belongs to
+        bool registered = false;                         ///< Present in the owner's registry
+    };
+
+    /// @brief Drain a thread's staging buffer into the central buffer when it reaches this size
+    static constexpr size_t kStagingFlushThreshold = 16 * 1024;
+
+    /// @brief Write the central buffer to the file when it reaches this size
+    static constexpr size_t kFileFlushThreshold = 256 * 1024;
+
+    /// @brief Bind (or rebind) the calling thread's state to the current session
+    ThreadState& GetThreadState();
+
+    /// @brief Resolve a tag to its interned id, emitting a definition record on first use
+    uint16_t InternTag(ThreadState& pState, const std::string& pTag);
+
+    /// @brief Move a thread's staged bytes into the central buffer and maybe hit the file
+    void DrainThreadState(ThreadState& pState);
+
+    /// @brief Write the central buffer to the file, rotating first if needed (mSinkMutex held)
+    void FlushLocked();
+
+    /// @brief Write the session header and the current tag table (mSinkMutex held)
+    void WriteFileProlog();
+
+    /// @brief Thread-exit hook - unregister and salvage any staged records
+    void OnThreadExit(ThreadState* pState);
+
+    /// @brief The log file (open between Open and Close)
+    std::ofstream mFile;
+
+    /// @brief Log file path, base name for rotation
+    std::string mPath;
+
+    /// @brief Rotate when the file exceeds this many bytes
+    size_t mMaxFileBytes = 0;
+
+    /// @brief Bytes written to the current file so far
+    size_t mFileBytes = 0;
+
+    /// @brief Central buffer collecting drained staging batches (mSinkMutex)
+    std::string mCentral;
+
+    /// @brief Serialized tag table, replayed into each rotated file (mSinkMutex)
+    std::string mTagTableBytes;
+
+    /// @brief Guards the central buffer, the tag table bytes, and the file
+    std::mutex mSinkMutex;
+
+    /// @brief Tag string to interned id (mTagMutex)
+    std::unordered_map<std::string, uint16_t> mTags;
+
+    /// @brief Guards the shared tag map (always taken before mSinkMutex)
+    std::mutex mTagMutex;
+
+    /// @brief Registered per-thread states so Close can drain them (mRegistryMutex)
+    std::vector<ThreadState*> mStates;
+
+    /// @brief Guards the thread-state registry
+    std::mutex mRegistryMutex;
+
+    /// @brief Set while a file is open - checked before any staging work
+    std::atomic<bool> mOpen{false};
+
+    /// @brief Bumped on every Open so stale staging buffers are discarded
+    std::atomic<uint32_t> mGeneration{0};
+
+    /// @brief Message records accepted since Open
+    std::atomic<uint64_t> mRecordCount{0};
+
+    /// @brief System-clock microseconds at session start (header field)
+    uint64_t mSystemEpochMicros = 0;
+
+    /// @brief Steady-clock nanoseconds at session start (header field)
+    uint64_t mSteadyEpochNanos = 0;
+};
+
+/**
+ * @class BinaryLogReader
+ * @brief Renders a BinaryLogWriter file back to the Logger text format.
+ *
+ * The offline half of the structured logging pipeline: reads the binary
+ * records, resolves interned tag ids, maps raw steady-clock ticks to
+ * wall-clock time using the epoch pair in the file header, and emits lines
+ * identical to what Logger's console path would have printed
+ * ("HH:MM:SS.mmm [LVL][TAG] message").
+ *
+ * Records land in the file in flush order, not timestamp order (different
+ * threads drain their staging buffers at different times), so RenderTo
+ * sorts by timestamp before emitting. ReadNext exposes the raw file order
+ * for callers that want to stream instead.
+ *
+ * @example
+ *   BinaryLogReader reader;
+ *   if (reader.Open("session.tixwblg"))
+ *       reader.RenderTo(std::cout);   // Rotated half first: open "session.tixwblg.1"
+ *
+ * @see BinaryLogWriter, Logger::EnableBinaryLog
+ */
+class BinaryLogReader
+{
+public:
+    /**
+     * @struct Record
+     * @brief One decoded message record.
+     */
+    struct Record
+    {
+        uint8_t level = 0;           ///< Severity (0=Debug .. 3=Error)
+        std::string tag;             ///< Resolved tag string
+        uint64_t steadyNanos = 0;    ///< Raw steady-clock nanoseconds from the writer
+        uint64_t wallMicros = 0;     ///< Wall-clock microseconds since the Unix epoch
+        std::string message;         ///< Message bytes
+    };
+
+    /// @brief Constructor - no file is opened yet
+    BinaryLogReader();
+
+    /// @brief Destructor - closes the log if still open
+    ~BinaryLogReader();
+
+    // Non-copyable, non-movable (owns the file stream)
+    BinaryLogReader(const BinaryLogReader&) = delete;
+    BinaryLogReader& operator=(const BinaryLogReader&) = delete;
+
+    /**
+     * @brief Open a binary log and validate its header.
+     *
+     * @param pPath Path to a file written by BinaryLogWriter
+     * @return true if the file opened and the magic/version matched
+     */
+    bool Open(const std::string& pPath);
+
+    /**
+     * @brief Read the next message record in file order.
+     *
+     * Tag definition records are consumed internally to build the id table;
+     * only message records are surfaced.
+     *
+     * @param pRecord Receives the decoded record
+     * @return true if a record was read, false at end of log or on a
+     *         truncated record
+     */
+    bool ReadNext(Record& pRecord);
+
+    /**
+     * @brief Render every record to the Logger text format, sorted by time.
+     *
+     * Reads the remainder of the file, sorts records by their steady-clock
+     * timestamp, and writes one "HH:MM:SS.mmm [LVL][TAG] message" line per
+     * record.
+     *
+     * @param pOut Destination stream
+     * @return Number of records rendered
+     */
+    uint64_t RenderTo(std::ostream& pOut);
+
+    /// @brief Close the log file (safe when not open)
+    void Close();
+
+private:
+    /// @brief Format one record as a Logger-style text line
+    std::string FormatLine(const Record& pRecord) const;
+
+    /// @brief The log file (open between Open and Close)
+    std::ifstream mFile;
+
+    /// @brief Interned tag id to string, built from definition records
+    std::unordered_map<uint16_t, std::string> mTags;
+
+    /// @brief System-clock microseconds at session start (from the header)
+    uint64_t mSystemEpochMicros = 0;
+
+    /// @brief Steady-clock nanoseconds at session start (from the header)
+    uint64_t mSteadyEpochNanos = 0;
+};
@@ -0,0 +1,354 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#include "BinarySink.hpp"
+#include "Logger.hpp"
+
+#include <cstring>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+/**
+ * @file BinarySink.cpp
+ * @brief Implementations of the shipped binary sinks (file and memory-mapped).
+ *
+ * Both sinks reserve the full destination from the BinaryStart size metadata
+ * before any data arrives, so arbitrarily large transfers complete with a
+ * small constant memory footprint instead of accumulating the payload in RAM.
+ */
+
+//
+// FileBinarySink - preallocated file destination with buffered writes
+//
+
+FileBinarySink::FileBinarySink(const std::string& path)
+    : mPath(path)
+{
+}
+
+FileBinarySink::~FileBinarySink()
+{
+    CloseFile();
+}
+
+bool FileBinarySink::OnStart(const std::string& streamId, size_t expectedSize)
+{
+    // A new transfer while one is open means the previous one was cut short
+    CloseFile();
+    mBytesWritten = 0;
+
+#ifdef _WIN32
+    if (fopen_s(&mFile, mPath.c_str(), "wb") != 0)
+        mFile = nullptr;
+#else
+    mFile = std::fopen(mPath.c_str(), "wb");
+#endif
+    if (!mFile)
+    {
+        Logger::Instance().Error("BinarySink",
+            "Failed to open file for transfer: " + mPath);
+        return false;
+    }
+
+    // Preallocate by extending the file to the announced size up front; the
+    // filesystem can then allocate contiguous space and writes never grow it
+    if (expectedSize > 0)
+    {
+        if (std::fseek(mFile, static_cast<long>(expectedSize - 1), SEEK_SET) != 0 ||
+            std::fputc(0, mFile) == EOF ||
+            std::fseek(mFile, 0, SEEK_SET) != 0)
+        {
+            Logger::Instance().Error("BinarySink",
+                "Failed to preallocate " + std::to_string(expectedSize) +
+                " bytes for: " + mPath);
+            CloseFile();
+            return false;
+        }
+    }
+
+    Logger::Instance().Debug("BinarySink", [&] {
+        return "File sink ready for stream '" + streamId + "': " + mPath +
+               " (" + std::to_string(expectedSize) + " bytes preallocated)"; });
+    return true;
+}
+
+bool FileBinarySink::Write(const uint8_t* data, size_t size)
+{
+    if (!mFile)
+        return false;
+
+    if (std::fwrite(data, 1, size, mFile) != size)
+    {
+        Logger::Instance().Error("BinarySink",
+            "File write failed at offset " + std::to_string(mBytesWritten));
+        return false;
+    }
+
+    mBytesWritten += size;
+    return true;
+}
+
+bool FileBinarySink::WriteAt(uint64_t offset, const uint8_t* data, size_t size)
+{
+    if (!mFile)
+        return false;
+
+    // Seek-and-write into the preallocated range; 64-bit seek so transfers
+    // past 2GB address correctly
+#ifdef _WIN32
+    if (_fseeki64(mFile, static_cast<long long>(offset), SEEK_SET) != 0)
+#else
+    if (std::fseek(mFile, static_cast<long>(offset), SEEK_SET) != 0)
+#endif
+    {
+        Logger::Instance().Error("BinarySink",
+            "File seek failed at offset " + std::to_string(offset));
+        return false;
+    }
+
+    if (std::fwrite(data, 1, size, mFile) != size)
+    {
+        Logger::Instance().Error("BinarySink",
+            "File write failed at offset " + std::to_string(offset));
+        return false;
+    }
+
+    mBytesWritten += size;
+    return true;
+}
+
+void FileBinarySink::OnComplete(const std::string& streamId)
+{
+    CloseFile();
+    Logger::Instance().Info("BinarySink",
+        "Transfer '" + streamId + "' written to " + mPath + " (" +
+        std::to_string(mBytesWritten) + " bytes)");
+}
+
+void FileBinarySink::OnAbort(const std::string& reason)
+{
+    CloseFile();
+    Logger::Instance().Warning("BinarySink",
+        "Transfer aborted after " + std::to_string(mBytesWritten) +
+        " bytes: " + reason);
+}
+
+void FileBinarySink::CloseFile()
+{
+    if (mFile)
+    {
+        std::fclose(mFile);
+        mFile = nullptr;
+    }
+}
+
+//
+// MemoryMappedBinarySink - mapped file destination (Win32 file mapping)
+//
+
+MemoryMappedBinarySink::MemoryMappedBinarySink(const std::string& path)
+    : mPath(path)
+{
+}
+
+MemoryMappedBinarySink::~MemoryMappedBinarySink()
+{
+    ReleaseMapping();
+}
+
+bool MemoryMappedBinarySink::OnStart(const std::string& streamId, size_t expectedSize)
+{
+    // A new transfer while one is open means the previous one was cut short
+    ReleaseMapping();
+    mBytesWritten = 0;
+
+    // Mapping a zero-length file is not meaningful - require the size metadata
+    if (expectedSize == 0)
+    {
+        Logger::Instance().Error("BinarySink",
+            "Memory-mapped sink requires a non-zero expected size");
+        return false;
+    }
+
+#ifdef _WIN32
+    // Create the destination file and extend it to the announced size
+    HANDLE file = CreateFileA(mPath.c_str(), GENERIC_READ | GENERIC_WRITE, 0,
+                              nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        Logger::Instance().Error("BinarySink",
+            "Failed to create file for mapping: " + mPath);
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    size.QuadPart = static_cast<LONGLONG>(expectedSize);
+    if (!SetFilePointerEx(file, size, nullptr, FILE_BEGIN) || !SetEndOfFile(file))
+    {
+        Logger::Instance().Error("BinarySink",
+            "Failed to reserve " + std::to_string(expectedSize) +
+            " bytes for mapping: " + mPath);
+        CloseHandle(file);
+        return false;
+    }
+
+    // Map the reserved range writable; chunks are copied straight into the
+    // mapping and the OS pages them out lazily
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+    if (!mapping)
+    {
+        Logger::Instance().Error("BinarySink",
+            "CreateFileMapping failed for: " + mPath);
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, expectedSize);
+    if (!view)
+    {
+        Logger::Instance().Error("BinarySink",
+            "MapViewOfFile failed for: " + mPath);
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    mFileHandle = file;
+    mMappingHandle = mapping;
+    mMapping = static_cast<uint8_t*>(view);
+    mMappingSize = expectedSize;
+#else
+    // Non-Windows fallback: buffered file writes (no mapping available here)
+    std::FILE* file = std::fopen(mPath.c_str(), "wb");
+    if (!file)
+    {
+        Logger::Instance().Error("BinarySink",
+            "Failed to create file for mapping fallback: " + mPath);
+        return false;
+    }
+    mFileHandle = file;
+    mMappingSize = expectedSize;
+#endif
+
+    Logger::Instance().Debug("BinarySink", [&] {
+        return "Memory-mapped sink ready for stream '" + streamId + "': " + mPath +
+               " (" + std::to_string(expectedSize) + " bytes reserved)"; });
+    return true;
+}
+
+bool MemoryMappedBinarySink::Write(const uint8_t* data, size_t size)
+{
+#ifdef _WIN32
+    if (!mMapping)
+        return false;
+
+    // Guard against writes past the reserved range
+    if (size > mMappingSize - mBytesWritten)
+    {
+        Logger::Instance().Error("BinarySink",
+            "Chunk exceeds reserved mapping: " + std::to_string(size) +
+            " bytes at offset " + std::to_string(mBytesWritten));
+        return false;
+    }
+
+    std::memcpy(mMapping + mBytesWritten, data, size);
+#else
+    if (!mFileHandle)
+        return false;
+
+    if (std::fwrite(data, 1, size, static_cast<std::FILE*>(mFileHandle)) != size)
+    {
+        Logger::Instance().Error("BinarySink",
+            "File write failed at offset " + std::to_string(mBytesWritten));
+        return false;
+    }
+#endif
+
+    mBytesWritten += size;
+    return true;
+}
+
+bool MemoryMappedBinarySink::WriteAt(uint64_t offset, const uint8_t* data, size_t size)
+{
+#ifdef _WIN32
+    if (!mMapping)
+        return false;
+
+    // Guard against writes past the reserved range
+    if (offset > mMappingSize || size > mMappingSize - offset)
+    {
+        Logger::Instance().Error("BinarySink",
+            "Chunk exceeds reserved mapping: " + std::to_string(size) +
+            " bytes at offset " + std::to_string(offset));
+        return false;
+    }
+
+    // A mapping is the ideal offset-addressed destination: out-of-order
+    // chunks are plain memcpys at their final position
+    std::memcpy(mMapping + offset, data, size);
+#else
+    if (!mFileHandle)
+        return false;
+
+    std::FILE* file = static_cast<std::FILE*>(mFileHandle);
+    if (std::fseek(file, static_cast<long>(offset), SEEK_SET) != 0 ||
+        std::fwrite(data, 1, size, file) != size)
+    {
+        Logger::Instance().Error("BinarySink",
+            "File write failed at offset " + std::to_string(offset));
+        return false;
+    }
+#endif
+
+    mBytesWritten += size;
+    return true;
+}
+
+void MemoryMappedBinarySink::OnComplete(const std::string& streamId)
+{
+#ifdef _WIN32
+    // Flush dirty pages before tearing the mapping down
+    if (mMapping)
+        FlushViewOfFile(mMapping, mBytesWritten);
+#endif
+    ReleaseMapping();
+    Logger::Instance().Info("BinarySink",
+        "Transfer '" + streamId + "' mapped to " + mPath + " (" +
+        std::to_string(mBytesWritten) + " bytes)");
+}
+
+void MemoryMappedBinarySink::OnAbort(const std::string& reason)
+{
+    ReleaseMapping();
+    Logger::Instance().Warning("BinarySink",
+        "Mapped transfer aborted after " + std::to_string(mBytesWritten) +
+        " bytes: " + reason);
+}
+
+void MemoryMappedBinarySink::ReleaseMapping()
+{
+#ifdef _WIN32
+    if (mMapping)
+    {
+        UnmapViewOfFile(mMapping);
+        mMapping = nullptr;
+    }
+    if (mMappingHandle)
+    {
+        CloseHandle(static_cast<HANDLE>(mMappingHandle));
+        mMappingHandle = nullptr;
+    }
+    if (mFileHandle)
+    {
+        CloseHandle(static_cast<HANDLE>(mFileHandle));
+        mFileHandle = nullptr;
+    }
+#else
+    if (mFileHandle)
+    {
+        std::fclose(static_cast<std::FILE*>(mFileHandle));
+        mFileHandle = nullptr;
+    }
+#endif
+    mMappingSize = 0;
+}
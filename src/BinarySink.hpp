@@ -0,0 +1,220 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * @class BinarySink
+ * @brief Abstract destination for streamed binary transfers (bounded memory).
+ *
+ * Registering a BinarySink on WsClient (alongside SetMessageHandler) lets large
+ * binary transfers stream straight from the receive path into their final
+ * destination - a file, a mapping, a decoder - without being accumulated in
+ * RAM first. With a sink registered, a 100MB+ transfer completes with a small
+ * constant memory footprint instead of a payload-sized buffer on top of the
+ * client's own copies.
+ *
+ * Call sequence per transfer (all from the WebSocket thread):
+ *   OnStart(streamId, expectedSize) -> Write(...) x N -> OnComplete(streamId)
+ * OnAbort is called instead of OnComplete if the transfer is cut short
+ * (protocol error or connection loss).
+ *
+ * @note When a sink is registered on WsClient, binary chunks go to the sink
+ *       instead of IMessageHandler::OnBinaryChunk; text messages (including
+ *       the BinaryStart metadata) are still routed to the message handler.
+ *
+ * @see WsClient::SetBinarySink
+ * @see FileBinarySink, MemoryMappedBinarySink for shipped implementations
+ */
+class BinarySink
+{
+public:
+    /// @brief Virtual destructor - required for proper cleanup of derived classes
+    virtual ~BinarySink() = default;
+
+    /**
+     * @brief Called when a binary transfer begins.
+     *
+     * The expected size comes from the BinaryStart metadata message, allowing
+     * the sink to reserve its destination (preallocate a file, create a
+     * mapping) before any data arrives.
+     *
+     * @param streamId msgId of the announcing BinaryStart message
+     * @param expectedSize Total bytes announced for this transfer
+     * @return true if the sink is ready to receive data; false aborts delivery
+     *         for this transfer (chunks fall back to the message handler)
+     */
+    virtual bool OnStart(const std::string& streamId, size_t expectedSize) = 0;
+
+    /**
+     * @brief Called for each received chunk of the active transfer.
+     *
+     * @param data Pointer to the binary data chunk (valid only during this call)
+     * @param size Size of this chunk in bytes
+     * @return true on success; false aborts the transfer (OnAbort follows)
+     */
+    virtual bool Write(const uint8_t* data, size_t size) = 0;
+
+    /**
+     * @brief Whether this sink accepts offset-addressed writes (WriteAt).
+     *
+     * Sinks with a random-access destination (a preallocated file, a mapping)
+     * should return true: with chunk framing enabled, out-of-order chunks can
+     * then be committed directly at their offset instead of being buffered in
+     * the client's reorder window first.
+     *
+     * @return true if WriteAt may be called instead of Write
+     *
+     * @note Default is false - chunks arrive through sequential Write calls.
+     */
+    virtual bool SupportsOffsetWrites() const { return false; }
+
+    /**
+     * @brief Offset-addressed write for framed (possibly out-of-order) chunks.
+     *
+     * Only called when SupportsOffsetWrites() returns true. Offsets never
+     * overlap and never exceed the size announced in OnStart, but may arrive
+     * in any order.
+     *
+     * @param offset Destination byte offset within the transfer
+     * @param data Pointer to the binary data chunk (valid only during this call)
+     * @param size Size of this chunk in bytes
+     * @return true on success; false aborts the transfer (OnAbort follows)
+     */
+    virtual bool WriteAt(uint64_t offset, const uint8_t* data, size_t size)
+    {
+        (void)offset; (void)data; (void)size;
+        return false;  // Base sinks are sequential-only
+    }
+
+    /**
+     * @brief Called when all expected bytes of the transfer have been delivered.
+     *
+     * Flush and finalize the destination here (close the file, sync the
+     * mapping, validate the result).
+     *
+     * @param streamId msgId of the transfer that finished
+     */
+    virtual void OnComplete(const std::string& streamId) = 0;
+
+    /**
+     * @brief Called when a transfer ends without completing.
+     *
+     * @param reason Human-readable description of why the transfer was cut short
+     *
+     * @note Default implementation does nothing - override to clean up partial output
+     */
+    virtual void OnAbort(const std::string& reason) { (void)reason; }
+};
+
+/**
+ * @class FileBinarySink
+ * @brief BinarySink writing the transfer into a preallocated file.
+ *
+ * The destination file is created (truncated) on OnStart and extended to the
+ * announced size up front, so the filesystem can allocate contiguous space and
+ * subsequent writes never grow the file. Chunks are written through a buffered
+ * stream; memory usage is a small constant regardless of transfer size.
+ *
+ * @example
+ *   FileBinarySink sink("download.bin");
+ *   client.SetBinarySink(&sink);
+ *   // Transfers now stream to download.bin with constant memory
+ */
+class FileBinarySink : public BinarySink
+{
+public:
+    /**
+     * @brief Construct a sink targeting the given path.
+     *
+     * @param path Destination file path; created/truncated when a transfer starts
+     */
+    explicit FileBinarySink(const std::string& path);
+
+    /// @brief Destructor - closes the file if a transfer was left open
+    ~FileBinarySink() override;
+
+    bool OnStart(const std::string& streamId, size_t expectedSize) override;
+    bool Write(const uint8_t* data, size_t size) override;
+    bool SupportsOffsetWrites() const override { return true; }
+    bool WriteAt(uint64_t offset, const uint8_t* data, size_t size) override;
+    void OnComplete(const std::string& streamId) override;
+    void OnAbort(const std::string& reason) override;
+
+    /// @brief Get the number of bytes written for the current/last transfer
+    size_t GetBytesWritten() const { return mBytesWritten; }
+
+private:
+    /// @brief Destination file path
+    std::string mPath;
+
+    /// @brief Open file handle (null when no transfer is active)
+    std::FILE* mFile = nullptr;
+
+    /// @brief Bytes written so far in the current transfer
+    size_t mBytesWritten = 0;
+
+    /// @brief Close and null the file handle
+    void CloseFile();
+};
+
+/**
+ * @class MemoryMappedBinarySink
+ * @brief BinarySink writing the transfer through a memory-mapped file.
+ *
+ * On OnStart the destination file is extended to the announced size and mapped
+ * into the address space; chunks are then copied directly into the mapping at
+ * the current offset, letting the OS page data out lazily. This avoids the
+ * write-syscall-per-chunk cost of the buffered file sink for very large
+ * transfers.
+ *
+ * @note Memory mapping uses the Win32 file-mapping API on Windows; on other
+ *       platforms this sink falls back to buffered file writes.
+ */
+class MemoryMappedBinarySink : public BinarySink
+{
+public:
+    /**
+     * @brief Construct a sink targeting the given path.
+     *
+     * @param path Destination file path; created and mapped when a transfer starts
+     */
+    explicit MemoryMappedBinarySink(const std::string& path);
+
+    /// @brief Destructor - unmaps and closes if a transfer was left open
+    ~MemoryMappedBinarySink() override;
+
+    bool OnStart(const std::string& streamId, size_t expectedSize) override;
+    bool Write(const uint8_t* data, size_t size) override;
+    bool SupportsOffsetWrites() const override { return true; }
+    bool WriteAt(uint64_t offset, const uint8_t* data, size_t size) override;
+    void OnComplete(const std::string& streamId) override;
+    void OnAbort(const std::string& reason) override;
+
+    /// @brief Get the number of bytes written for the current/last transfer
+    size_t GetBytesWritten() const { return mBytesWritten; }
+
+private:
+    /// @brief Destination file path
+    std::string mPath;
+
+    /// @brief Base address of the active mapping (null when no transfer is active)
+    uint8_t* mMapping = nullptr;
+
+    /// @brief Size of the active mapping in bytes
+    size_t mMappingSize = 0;
+
+    /// @brief Bytes written so far in the current transfer
+    size_t mBytesWritten = 0;
+
+    /// @brief Platform file handle (HANDLE on Windows, FILE* elsewhere)
+    void* mFileHandle = nullptr;
+
+    /// @brief Platform mapping handle (HANDLE on Windows, unused elsewhere)
+    void* mMappingHandle = nullptr;
+
+    /// @brief Unmap and close all platform handles
+    void ReleaseMapping();
+};
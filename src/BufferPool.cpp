@@ -0,0 +1,144 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#include "BufferPool.hpp"
+
+/**
+ * @file BufferPool.cpp
+ * @brief Implementation of the size-classed receive-path recycling pool.
+ */
+
+BufferPool& BufferPool::Instance()
+{
+    // Meyers singleton - thread-safe initialization guaranteed by C++11
+    static BufferPool instance;
+    return instance;
+}
+
+size_t BufferPool::ClassFor(size_t pSize)
+{
+    for (size_t i = 0; i < kClassCount; ++i)
+    {
+        if (pSize <= kClassCapacity[i])
+            return i;
+    }
+    return kClassCount;  // Larger than the biggest class - not poolable
+}
+
+std::string BufferPool::AcquireBuffer(size_t pMinCapacity)
+{
+    // Walk the classes from the smallest that fits upward - a 1MB buffer can
+    // serve a 4KB request if the 4KB list happens to be empty
+    for (size_t i = ClassFor(pMinCapacity); i < kClassCount; ++i)
+    {
+        SizeClass& sizeClass = mClasses[i];
+        std::lock_guard<std::mutex> lock(sizeClass.mutex);
+        if (!sizeClass.free.empty())
+        {
+            std::string buffer = std::move(sizeClass.free.back());
+            sizeClass.free.pop_back();
+            mBufferHits.fetch_add(1, std::memory_order_relaxed);
+            return buffer;
+        }
+    }
+
+    // Miss - allocate fresh with the capacity reserved up front so the caller
+    // does not pay a second growth allocation while filling it
+    mBufferMisses.fetch_add(1, std::memory_order_relaxed);
+    std::string buffer;
+    buffer.reserve(pMinCapacity);
+    return buffer;
+}
+
+void BufferPool::ReleaseBuffer(std::string&& pBuffer)
+{
+    // Find the largest class this buffer's capacity fully covers; SSO-only
+    // strings and oversized buffers are not worth pooling
+    const size_t capacity = pBuffer.capacity();
+    size_t classIndex = kClassCount;
+    for (size_t i = kClassCount; i > 0; --i)
+    {
+        if (capacity >= kClassCapacity[i - 1])
+        {
+            classIndex = i - 1;
+            break;
+        }
+    }
+
+    if (classIndex == kClassCount || capacity > kClassCapacity[kClassCount - 1])
+    {
+        mBuffersDropped.fetch_add(1, std::memory_order_relaxed);
+        return;  // Destructor frees it as usual
+    }
+
+    pBuffer.clear();  // Keeps capacity, discards contents
+
+    SizeClass& sizeClass = mClasses[classIndex];
+    std::lock_guard<std::mutex> lock(sizeClass.mutex);
+    if (sizeClass.free.size() >= kMaxBuffersPerClass)
+    {
+        mBuffersDropped.fetch_add(1, std::memory_order_relaxed);
+        return;  // Class full - cap the pool's footprint
+    }
+    sizeClass.free.push_back(std::move(pBuffer));
+}
+
+Protocol::Message BufferPool::AcquireMessage()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMessageMutex);
+        if (!mMessages.empty())
+        {
+            Protocol::Message msg = std::move(mMessages.back());
+            mMessages.pop_back();
+            mMessageHits.fetch_add(1, std::memory_order_relaxed);
+            return msg;
+        }
+    }
+
+    mMessageMisses.fetch_add(1, std::memory_order_relaxed);
+    return Protocol::Message();
+}
+
+void BufferPool::ReleaseMessage(Protocol::Message&& pMsg)
+{
+    // Reset to default field values but keep the strings' capacity - that
+    // capacity is the whole point of recycling
+    pMsg.type = Protocol::MessageType::Unknown;
+    pMsg.msgId.clear();
+    pMsg.content.clear();
+    pMsg.binarySize = 0;
+    pMsg.crc32c = 0;
+    pMsg.hasCrc32c = false;
+
+    std::lock_guard<std::mutex> lock(mMessageMutex);
+    if (mMessages.size() >= kMaxMessages)
+        return;  // Pool full - let the destructor free it
+    mMessages.push_back(std::move(pMsg));
+}
+
+BufferPool::Stats BufferPool::GetStats() const
+{
+    Stats stats;
+    stats.bufferHits = mBufferHits.load(std::memory_order_relaxed);
+    stats.bufferMisses = mBufferMisses.load(std::memory_order_relaxed);
+    stats.buffersDropped = mBuffersDropped.load(std::memory_order_relaxed);
+    stats.messageHits = mMessageHits.load(std::memory_order_relaxed);
+    stats.messageMisses = mMessageMisses.load(std::memory_order_relaxed);
+
+    // Occupancy needs the locks; GetStats is an observability call, not a
+    // hot-path one, so the brief contention is acceptable
+    for (size_t i = 0; i < kClassCount; ++i)
+    {
+        const SizeClass& sizeClass = mClasses[i];
+        std::lock_guard<std::mutex> lock(sizeClass.mutex);
+        stats.pooledBuffers += sizeClass.free.size();
+        for (const std::string& buffer : sizeClass.free)
+            stats.pooledBufferBytes += buffer.capacity();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMessageMutex);
+        stats.pooledMessages = mMessages.size();
+    }
+
+    return stats;
+}
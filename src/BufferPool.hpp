@@ -0,0 +1,168 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#pragma once
+
+#include "Protocol.hpp"
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @class BufferPool
+ * @brief Process-wide recycling pool for receive-path buffers and messages.
+ *
+ * At tens of thousands of frames per second the allocator itself becomes a
+ * hot spot: every executor-queued text event materializes a Protocol::Message
+ * with heap-backed strings, and every queued binary chunk copies into a fresh
+ * std::string. This pool recycles both so steady-state receive processing
+ * reuses the same capacity-retaining objects instead of hitting the heap -
+ * and the heap stops fragmenting over long uptimes.
+ *
+ * Buffers are size-classed (256B / 4KB / 64KB / 1MB): a released buffer joins
+ * the free list of the largest class its capacity covers, and an acquire pops
+ * from the smallest class that satisfies the request. Requests above the
+ * largest class, and releases when a class is full, fall through to the
+ * regular allocator - the pool caps its own footprint rather than growing
+ * without bound.
+ *
+ * Thread-safe singleton, same pattern as Logger. Occupancy and hit/miss
+ * counters are exposed via GetStats() for the metrics surface.
+ *
+ * @example
+ *   std::string buf = BufferPool::Instance().AcquireBuffer(frame.size());
+ *   buf.assign(frame.data(), frame.size());
+ *   // ... use buf ...
+ *   BufferPool::Instance().ReleaseBuffer(std::move(buf));
+ *
+ * @note Acquire/release pairing is cooperative, not enforced: a buffer that
+ *       never comes back is simply freed by its destructor as usual.
+ */
+class BufferPool
+{
+public:
+    /**
+     * @struct Stats
+     * @brief Point-in-time snapshot of pool occupancy and effectiveness.
+     *
+     * Hit/miss counters are cumulative since process start; occupancy fields
+     * reflect the moment of the call.
+     */
+    struct Stats
+    {
+        uint64_t bufferHits = 0;       ///< Acquires served from a free list
+        uint64_t bufferMisses = 0;     ///< Acquires that fell through to the heap
+        uint64_t buffersDropped = 0;   ///< Releases discarded (class full / unpoolable)
+        uint64_t messageHits = 0;      ///< Message acquires served from the pool
+        uint64_t messageMisses = 0;    ///< Message acquires that allocated fresh
+        size_t pooledBuffers = 0;      ///< Buffers currently sitting in free lists
+        size_t pooledBufferBytes = 0;  ///< Total capacity held by pooled buffers
+        size_t pooledMessages = 0;     ///< Messages currently available for reuse
+    };
+
+    /**
+     * @brief Get the singleton pool instance.
+     *
+     * @return Reference to the global BufferPool
+     */
+    static BufferPool& Instance();
+
+    /**
+     * @brief Acquire an empty buffer with at least the requested capacity.
+     *
+     * Pops a recycled buffer from the smallest size class that covers
+     * pMinCapacity; on a miss a fresh buffer is allocated with that capacity
+     * reserved. The returned buffer is always empty (size 0).
+     *
+     * @param pMinCapacity Minimum capacity the caller needs
+     * @return An empty std::string with capacity >= pMinCapacity
+     */
+    std::string AcquireBuffer(size_t pMinCapacity);
+
+    /**
+     * @brief Return a buffer to the pool for reuse.
+     *
+     * The buffer joins the free list of the largest size class its capacity
+     * covers. Buffers smaller than the smallest class (including SSO-only
+     * strings) and buffers arriving at a full class are simply freed.
+     *
+     * @param pBuffer Buffer to recycle (moved from; contents discarded)
+     */
+    void ReleaseBuffer(std::string&& pBuffer);
+
+    /**
+     * @brief Acquire a recycled Protocol::Message.
+     *
+     * The returned message has default field values but its msgId/content
+     * strings retain the capacity of their previous use, so assigning new
+     * values of similar length performs no allocation.
+     *
+     * @return A reset Protocol::Message ready for assignment
+     */
+    Protocol::Message AcquireMessage();
+
+    /**
+     * @brief Return a message to the pool for reuse.
+     *
+     * @param pMsg Message to recycle (moved from; contents discarded)
+     */
+    void ReleaseMessage(Protocol::Message&& pMsg);
+
+    /**
+     * @brief Snapshot the pool's counters and current occupancy.
+     *
+     * @return Stats structure with cumulative and point-in-time values
+     */
+    Stats GetStats() const;
+
+private:
+    BufferPool() = default;
+    ~BufferPool() = default;
+
+    // Prevent copying of singleton
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    /// Number of buffer size classes (256B, 4KB, 64KB, 1MB)
+    static constexpr size_t kClassCount = 4;
+
+    /// Capacity ceiling of each size class, ascending
+    static constexpr size_t kClassCapacity[kClassCount] =
+        { 256, 4 * 1024, 64 * 1024, 1024 * 1024 };
+
+    /// Maximum buffers retained per class (caps pool footprint at ~34MB worst case)
+    static constexpr size_t kMaxBuffersPerClass = 32;
+
+    /// Maximum recycled messages retained
+    static constexpr size_t kMaxMessages = 64;
+
+    /**
+     * @struct SizeClass
+     * @brief One free list of same-class buffers with its own lock.
+     *
+     * Per-class locking keeps small-buffer traffic (protocol messages) from
+     * contending with large-buffer traffic (binary chunks).
+     */
+    struct SizeClass
+    {
+        mutable std::mutex mutex;        ///< Guards the free list (mutable for GetStats)
+        std::vector<std::string> free;   ///< Recycled buffers, capacity-retaining
+    };
+
+    /// @brief Index of the smallest class with capacity >= pSize, or kClassCount
+    static size_t ClassFor(size_t pSize);
+
+    SizeClass mClasses[kClassCount];  ///< Buffer free lists by size class
+
+    mutable std::mutex mMessageMutex;            ///< Guards the message free list
+    std::vector<Protocol::Message> mMessages;    ///< Recycled messages
+
+    // Effectiveness counters - relaxed atomics, read only by GetStats
+    std::atomic<uint64_t> mBufferHits{0};      ///< Pool-served buffer acquires
+    std::atomic<uint64_t> mBufferMisses{0};    ///< Heap-served buffer acquires
+    std::atomic<uint64_t> mBuffersDropped{0};  ///< Releases the pool declined
+    std::atomic<uint64_t> mMessageHits{0};     ///< Pool-served message acquires
+    std::atomic<uint64_t> mMessageMisses{0};   ///< Heap-served message acquires
+};
@@ -0,0 +1,159 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#include "Crc32c.hpp"
+
+#include <cstring>
+
+// SSE4.2 crc32 intrinsics are only reachable on x86/x64 builds
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define CRC32C_X86 1
+    #include <nmmintrin.h>
+    #ifdef _MSC_VER
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#else
+    #define CRC32C_X86 0
+#endif
+
+/**
+ * @file Crc32c.cpp
+ * @brief CRC-32C implementation: SSE4.2 instruction path + table fallback.
+ *
+ * The implementation is picked once, on first use, by probing CPUID for
+ * SSE4.2; after that every call goes straight through a function pointer.
+ * Both paths produce the standard CRC-32C (Castagnoli, reflected polynomial
+ * 0x82F63B78) as used by iSCSI, ext4, and RFC 3720.
+ */
+
+namespace Crc32c
+{
+    namespace
+    {
+        /// Lookup table for the software path, built on first use
+        uint32_t gTable[256];
+
+        /// @brief Populate the byte-wise lookup table for polynomial 0x82F63B78
+        void BuildTable()
+        {
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                uint32_t crc = i;
+                for (int bit = 0; bit < 8; ++bit)
+                    crc = (crc >> 1) ^ (0x82F63B78u & (~(crc & 1) + 1));
+                gTable[i] = crc;
+            }
+        }
+
+        /// @brief Portable table-driven implementation
+        uint32_t ExtendSoftware(uint32_t state, const void* data, size_t size)
+        {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (size_t i = 0; i < size; ++i)
+                state = (state >> 8) ^ gTable[(state ^ bytes[i]) & 0xFF];
+            return state;
+        }
+
+#if CRC32C_X86
+        /// @brief SSE4.2 implementation: 8 bytes per crc32 instruction
+    #if defined(__GNUC__) && !defined(__SSE4_2__)
+        __attribute__((target("sse4.2")))
+    #endif
+        uint32_t ExtendHardware(uint32_t state, const void* data, size_t size)
+        {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+            // Head: align to 8 bytes
+            while (size > 0 && (reinterpret_cast<uintptr_t>(bytes) & 7) != 0)
+            {
+                state = _mm_crc32_u8(state, *bytes);
+                ++bytes;
+                --size;
+            }
+
+    #if defined(_M_X64) || defined(__x86_64__)
+            // Body: one instruction per 8 bytes
+            uint64_t state64 = state;
+            while (size >= 8)
+            {
+                uint64_t chunk;
+                std::memcpy(&chunk, bytes, 8);
+                state64 = _mm_crc32_u64(state64, chunk);
+                bytes += 8;
+                size -= 8;
+            }
+            state = static_cast<uint32_t>(state64);
+    #else
+            // 32-bit builds: one instruction per 4 bytes
+            while (size >= 4)
+            {
+                uint32_t chunk;
+                std::memcpy(&chunk, bytes, 4);
+                state = _mm_crc32_u32(state, chunk);
+                bytes += 4;
+                size -= 4;
+            }
+    #endif
+
+            // Tail
+            while (size > 0)
+            {
+                state = _mm_crc32_u8(state, *bytes);
+                ++bytes;
+                --size;
+            }
+            return state;
+        }
+
+        /// @brief CPUID probe for the SSE4.2 feature bit (ECX bit 20)
+        bool DetectSse42()
+        {
+    #ifdef _MSC_VER
+            int info[4] = {};
+            __cpuid(info, 1);
+            return (info[2] & (1 << 20)) != 0;
+    #else
+            unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+            if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+                return false;
+            return (ecx & (1u << 20)) != 0;
+    #endif
+        }
+#endif  // CRC32C_X86
+
+        /// Signature shared by both implementations
+        using ExtendFn = uint32_t (*)(uint32_t, const void*, size_t);
+
+        /// @brief Probe the CPU once and pick the implementation
+        ExtendFn SelectImplementation()
+        {
+#if CRC32C_X86
+            if (DetectSse42())
+                return &ExtendHardware;
+#endif
+            BuildTable();
+            return &ExtendSoftware;
+        }
+
+        /// The selected implementation (initialized thread-safely on first use)
+        ExtendFn GetImplementation()
+        {
+            static const ExtendFn implementation = SelectImplementation();
+            return implementation;
+        }
+    }
+
+    uint32_t Extend(uint32_t pState, const void* pData, size_t pSize)
+    {
+        return GetImplementation()(pState, pData, pSize);
+    }
+
+    bool IsHardwareAccelerated()
+    {
+#if CRC32C_X86
+        return GetImplementation() == &ExtendHardware;
+#else
+        return false;
+#endif
+    }
+}
@@ -1,5 +1,6 @@
 // CodeRabbit: Please review this file thoroughly for production readiness
 #include "Logger.hpp"
+#include "BinaryLog.hpp"
 #include <iomanip>
 
 /**
@@ -19,27 +20,247 @@ Logger& Logger::Instance()
     return instance;
 }
 
+Logger::~Logger()
+{
+    // Flush and stop the drain thread if async mode was left enabled
+    DisableAsync();
+
+    // Drain staged records and close the binary log if it was left enabled
+    DisableBinaryLog();
+}
+
 void Logger::SetMinLevel(Level level)
 {
-    std::lock_guard<std::mutex> lock(mMutex);
-    mMinLevel = level;
+    // Atomic store - no lock needed, and Log() can check it lock-free
+    mMinLevel.store(level, std::memory_order_relaxed);
 }
 
 void Logger::Log(Level level, const std::string& tag, const std::string& message)
 {
-    // Lock the mutex to ensure exclusive access to std::cout
-    // The lock is automatically released when lock_guard goes out of scope
-    std::lock_guard<std::mutex> lock(mMutex);
-    
     // Check if this message meets the minimum log level threshold
     // Level order: Debug(0) < Info(1) < Warning(2) < Error(3)
-    if (static_cast<int>(level) < static_cast<int>(mMinLevel))
+    // This is a lock-free atomic read so filtered messages cost almost nothing
+    if (static_cast<int>(level) < static_cast<int>(mMinLevel.load(std::memory_order_relaxed)))
         return;  // Skip messages below minimum level
-    
+
+    if (mBinaryLogEnabled.load(std::memory_order_acquire))
+    {
+        // Structured binary backend: no formatting at all - raw steady-clock
+        // ticks, level byte, interned tag id and message bytes go into the
+        // calling thread's staging buffer. This is the few-dozen-nanosecond
+        // path; rendering to text happens offline via BinaryLogReader.
+        mBinaryLog->Write(static_cast<uint8_t>(level), tag, message);
+        return;
+    }
+
     // Format: "HH:MM:SS.mmm [LVL][TAG] message"
     // Example: "14:23:45.123 [INF][WsClient] Connected to server"
-    std::cout << GetTimestamp() << " [" << GetLevelStr(level) << "][" << tag << "] "
-              << message << "\n";
+    std::string line = GetTimestamp() + " [" + GetLevelStr(level) + "][" + tag + "] " + message;
+
+    if (mAsyncEnabled.load(std::memory_order_acquire))
+    {
+        // Asynchronous mode: enqueue the formatted record and return immediately.
+        // The drain thread performs the actual I/O, so this path never blocks on
+        // the console even when output is redirected to a slow file.
+        if (!TryEnqueue(std::move(line)))
+        {
+            // Ring is full - apply the drop-oldest overflow policy: discard the
+            // oldest queued record to make room, and count the drop so the drain
+            // thread can emit a visible marker.
+            std::string discarded;
+            if (TryDequeue(discarded))
+                mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+
+            // Retry once; if producers are racing hard enough that this still
+            // fails, drop the new record rather than spin on the hot path.
+            if (!TryEnqueue(std::move(line)))
+                mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
+    }
+
+    // Synchronous mode: lock the mutex to ensure exclusive access to std::cout
+    // The lock is automatically released when lock_guard goes out of scope
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::cout << line << "\n";
+}
+
+void Logger::EnableAsync(size_t capacity)
+{
+    // Already enabled - nothing to do
+    if (mAsyncEnabled.load(std::memory_order_acquire))
+        return;
+
+    // Round capacity up to a power of two so slot indexing is a cheap mask
+    size_t cap = 1;
+    while (cap < capacity)
+        cap <<= 1;
+
+    // Allocate and initialize the ring buffer cells
+    mRing.reset(new RingCell[cap]);
+    mRingMask = cap - 1;
+    for (size_t i = 0; i < cap; ++i)
+        mRing[i].seq.store(i, std::memory_order_relaxed);
+    mEnqueuePos.store(0, std::memory_order_relaxed);
+    mDequeuePos.store(0, std::memory_order_relaxed);
+
+    // Start the drain thread, then flip the mode flag so producers start enqueueing
+    mDrainRunning.store(true, std::memory_order_release);
+    mDrainThread = std::thread(&Logger::DrainLoop, this);
+    mAsyncEnabled.store(true, std::memory_order_release);
+}
+
+void Logger::DisableAsync()
+{
+    // Not enabled - nothing to do
+    if (!mAsyncEnabled.load(std::memory_order_acquire))
+        return;
+
+    // Stop accepting async records; in-flight producers may still land a few
+    // more, which the drain loop flushes before exiting
+    mAsyncEnabled.store(false, std::memory_order_release);
+    mDrainRunning.store(false, std::memory_order_release);
+
+    if (mDrainThread.joinable())
+        mDrainThread.join();
+}
+
+bool Logger::EnableBinaryLog(const std::string& path, size_t maxFileBytes)
+{
+    // Already enabled - nothing to do
+    if (mBinaryLogEnabled.load(std::memory_order_acquire))
+        return true;
+
+    // The writer is created once and reused across enable/disable cycles so
+    // a concurrent Log() never observes the pointer being torn down
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mBinaryLog)
+        mBinaryLog.reset(new BinaryLogWriter());
+
+    if (!mBinaryLog->Open(path, maxFileBytes))
+        return false;
+
+    mBinaryLogEnabled.store(true, std::memory_order_release);
+    return true;
+}
+
+void Logger::DisableBinaryLog()
+{
+    // Not enabled - nothing to do
+    if (!mBinaryLogEnabled.load(std::memory_order_acquire))
+        return;
+
+    // Route new records back to the console first; in-flight Write calls are
+    // safe against Close, which drains every thread's staging buffer
+    mBinaryLogEnabled.store(false, std::memory_order_release);
+    mBinaryLog->Close();
+}
+
+bool Logger::TryEnqueue(std::string&& line)
+{
+    // Vyukov bounded MPMC enqueue: claim a slot by CAS on the enqueue position,
+    // then publish the payload by advancing the slot's sequence number
+    size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        RingCell& cell = mRing[pos & mRingMask];
+        size_t seq = cell.seq.load(std::memory_order_acquire);
+        intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+        if (dif == 0)
+        {
+            // Slot is free - try to claim it
+            if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                cell.line = std::move(line);
+                cell.seq.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+            // CAS failed - pos was updated, loop and retry
+        }
+        else if (dif < 0)
+        {
+            // Slot still holds an unconsumed record - ring is full
+            return false;
+        }
+        else
+        {
+            // Another producer claimed this slot - reload and retry
+            pos = mEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool Logger::TryDequeue(std::string& line)
+{
+    // Vyukov bounded MPMC dequeue: consume the slot when its sequence shows a
+    // published record, then recycle it for the next lap around the ring
+    size_t pos = mDequeuePos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        RingCell& cell = mRing[pos & mRingMask];
+        size_t seq = cell.seq.load(std::memory_order_acquire);
+        intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+        if (dif == 0)
+        {
+            // Record is published - try to claim it
+            if (mDequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                line = std::move(cell.line);
+                cell.seq.store(pos + mRingMask + 1, std::memory_order_release);
+                return true;
+            }
+            // CAS failed - pos was updated, loop and retry
+        }
+        else if (dif < 0)
+        {
+            // Ring is empty
+            return false;
+        }
+        else
+        {
+            // Another consumer claimed this slot - reload and retry
+            pos = mDequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void Logger::DrainLoop()
+{
+    std::string line;
+
+    // Keep draining while running; after shutdown is requested, drain whatever
+    // remains in the ring so no records are lost on a clean DisableAsync()
+    for (;;)
+    {
+        bool gotRecord = TryDequeue(line);
+
+        if (gotRecord)
+        {
+            // Report drops before the record that follows the gap, so the marker
+            // lands where the data was actually lost
+            uint64_t dropped = mDroppedCount.load(std::memory_order_relaxed);
+
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (dropped > mDroppedReported)
+            {
+                std::cout << "[Logger] ... [dropped " +
+                    std::to_string(dropped - mDroppedReported) + " records]\n";
+                mDroppedReported = dropped;
+            }
+            std::cout << line << "\n";
+        }
+        else
+        {
+            // Ring is empty - exit if shutdown was requested, otherwise nap
+            // briefly instead of spinning (1ms keeps drain latency low without
+            // burning a core when idle)
+            if (!mDrainRunning.load(std::memory_order_acquire))
+                return;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
 }
 
 void Logger::Debug(const std::string& tag, const std::string& message)
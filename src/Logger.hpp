@@ -6,6 +6,36 @@
 #include <iostream>
 #include <sstream>
 #include <chrono>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <type_traits>
+
+// Forward declaration - the structured binary backend lives in BinaryLog.hpp
+class BinaryLogWriter;
+
+/**
+ * @def WSLOG_COMPILE_MIN_LEVEL
+ * @brief Compile-time minimum log level (0=Debug, 1=Info, 2=Warning, 3=Error).
+ *
+ * Call sites below this level are removed entirely by the compiler via
+ * `if constexpr`, so Release builds pay nothing - not even the level check -
+ * for Debug logging on the send/receive hot paths.
+ *
+ * Defaults to Info in Release builds (NDEBUG) and Debug otherwise. Override in
+ * the project preprocessor definitions, e.g. WSLOG_COMPILE_MIN_LEVEL=2 to also
+ * strip Info call sites.
+ *
+ * @note Only the lazy (callable-based) logging overloads are elided at compile
+ *       time; the string-based overloads still perform the runtime level check.
+ */
+#ifndef WSLOG_COMPILE_MIN_LEVEL
+#ifdef NDEBUG
+#define WSLOG_COMPILE_MIN_LEVEL 1  // Release: strip Debug call sites
+#else
+#define WSLOG_COMPILE_MIN_LEVEL 0  // Debug builds: keep everything
+#endif
+#endif
 
 /**
  * @class Logger
@@ -64,6 +94,39 @@ public:
      */
     static Logger& Instance();
 
+    /// @brief Compile-time minimum level (see WSLOG_COMPILE_MIN_LEVEL)
+    static constexpr Level kCompileTimeMinLevel =
+        static_cast<Level>(WSLOG_COMPILE_MIN_LEVEL);
+
+    /**
+     * @brief Check at compile time whether a level survives compile-time filtering.
+     *
+     * Used with `if constexpr` in the lazy logging overloads so stripped call
+     * sites generate no code at all.
+     *
+     * @param level The severity level to test
+     * @return true if call sites at this level are compiled in
+     */
+    static constexpr bool IsCompiledIn(Level level)
+    {
+        return static_cast<int>(level) >= static_cast<int>(kCompileTimeMinLevel);
+    }
+
+    /**
+     * @brief Check at runtime whether a level passes the minimum-level filter.
+     *
+     * Lock-free atomic read. Lazy call sites use this to skip message
+     * construction entirely when the record would be filtered anyway.
+     *
+     * @param level The severity level to test
+     * @return true if a record at this level would be emitted
+     */
+    bool ShouldLog(Level level) const
+    {
+        return static_cast<int>(level) >=
+               static_cast<int>(mMinLevel.load(std::memory_order_relaxed));
+    }
+
     /**
      * @brief Set the minimum log level to display.
      * 
@@ -78,6 +141,106 @@ public:
      */
     void SetMinLevel(Level level);
 
+    /**
+     * @brief Switch the logger to asynchronous mode with a background drain thread.
+     *
+     * In synchronous mode (the default) every Log() call writes to std::cout under
+     * a mutex, so the calling thread - including the WebSocket callback thread -
+     * stalls behind console/file I/O. In asynchronous mode, Log() only formats the
+     * record and pushes it into a bounded lock-free MPSC ring buffer; a dedicated
+     * drain thread performs the actual I/O. The hot path never blocks on output.
+     *
+     * Overflow policy is drop-oldest: when the ring is full, the oldest queued
+     * record is discarded to make room for the new one, and the drain thread emits
+     * a "[dropped N records]" marker so data loss is visible in the output.
+     *
+     * @param capacity Ring buffer capacity in records; rounded up to a power of two
+     *                 (default 8192). Larger values tolerate longer I/O stalls
+     *                 before dropping.
+     *
+     * @note Safe to call once during startup, before heavy logging begins.
+     * @note Call DisableAsync() (or let process exit handle it) to flush and stop.
+     *
+     * @example
+     *   Logger::Instance().EnableAsync();       // Before connecting
+     *   ...
+     *   Logger::Instance().DisableAsync();      // Flush on shutdown
+     */
+    void EnableAsync(size_t capacity = 8192);
+
+    /**
+     * @brief Switch back to synchronous mode, flushing all queued records first.
+     *
+     * Blocks until the drain thread has written every record still in the ring
+     * buffer, then joins it. Subsequent Log() calls write synchronously again.
+     *
+     * @note Safe to call even if async mode was never enabled (no-op).
+     */
+    void DisableAsync();
+
+    /**
+     * @brief Check whether asynchronous mode is active.
+     *
+     * @return true if records are being drained by the background thread
+     */
+    bool IsAsyncEnabled() const { return mAsyncEnabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Get the total number of records dropped by the overflow policy.
+     *
+     * @return Count of records discarded because the ring buffer was full
+     */
+    uint64_t GetDroppedCount() const { return mDroppedCount.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Switch to the structured binary backend (file output, no formatting).
+     *
+     * Even in async mode every Log() call still formats its record into text
+     * (GetTimestamp alone does a chrono-to-string conversion per call). With
+     * the binary backend enabled, Log() instead captures the raw steady-clock
+     * ticks, the level byte, an interned tag id and the message bytes into a
+     * per-thread staging buffer - a few dozen nanoseconds - and a rotated
+     * binary file receives the batched output. Use BinaryLogReader offline to
+     * render the file back to the exact console text format.
+     *
+     * While enabled, records bypass the console entirely (including the async
+     * ring buffer); the minimum-level filter still applies.
+     *
+     * @param path Log file path (overwritten; rotation uses "<path>.1")
+     * @param maxFileBytes Rotate the file when it exceeds this size
+     *                     (default 64 MB)
+     * @return true if the file was opened and the backend is active
+     *
+     * @note Records from different threads land in the file in flush order;
+     *       BinaryLogReader re-sorts by timestamp when rendering.
+     *
+     * @example
+     *   Logger::Instance().EnableBinaryLog("session.tixwblg");  // At startup
+     *   ...
+     *   Logger::Instance().DisableBinaryLog();                  // On shutdown
+     *
+     * @see BinaryLogWriter, BinaryLogReader
+     */
+    bool EnableBinaryLog(const std::string& path, size_t maxFileBytes = 64 * 1024 * 1024);
+
+    /**
+     * @brief Switch back to console output, draining and closing the binary log.
+     *
+     * Staged records from every logging thread are flushed to the file before
+     * it closes. Subsequent Log() calls go to the console again (async mode,
+     * if it was enabled, resumes handling them).
+     *
+     * @note Safe to call even if the binary backend was never enabled (no-op).
+     */
+    void DisableBinaryLog();
+
+    /**
+     * @brief Check whether the structured binary backend is active.
+     *
+     * @return true if records are being written to the binary log file
+     */
+    bool IsBinaryLogEnabled() const { return mBinaryLogEnabled.load(std::memory_order_relaxed); }
+
     /**
      * @brief Log a message with specified severity level and tag.
      * 
@@ -129,12 +292,91 @@ public:
      */
     void Error(const std::string& tag, const std::string& message);
 
+    /**
+     * @brief Lazy logging - message is built by a callable only if it will be emitted.
+     *
+     * The eager overloads force every call site to construct the message string
+     * (substr copies, concatenations) before the level check runs. This overload
+     * takes a callable instead; it is invoked only after both the compile-time
+     * filter (WSLOG_COMPILE_MIN_LEVEL, via `if constexpr`) and the runtime
+     * minimum-level check pass. Filtered call sites therefore cost nothing, and
+     * compile-time-stripped ones generate no code at all.
+     *
+     * @tparam level The severity level (compile-time template parameter so
+     *               `if constexpr` can elide the whole call site)
+     * @tparam MakeMessage Callable returning the message (std::string or convertible)
+     * @param tag Component or module identifier
+     * @param makeMessage Callable invoked lazily to build the message
+     *
+     * @example
+     *   Logger::Instance().LogLazy<Logger::Level::Debug>("WsClient", [&] {
+     *       return "[SEND][TEXT] " + pText.substr(0, 100);   // Only built if emitted
+     *   });
+     */
+    template <Level level, typename MakeMessage,
+              std::enable_if_t<std::is_invocable_v<MakeMessage&>, int> = 0>
+    void LogLazy(const std::string& tag, MakeMessage&& makeMessage)
+    {
+        if constexpr (IsCompiledIn(level))
+        {
+            if (ShouldLog(level))
+                Log(level, tag, makeMessage());
+        }
+        else
+        {
+            (void)tag;  // Call site stripped - suppress unused warnings
+        }
+    }
+
+    /**
+     * @brief Lazy debug logging - callable invoked only if the record is emitted.
+     *
+     * Convenience wrapper over LogLazy<Level::Debug>. This is the form hot-path
+     * call sites should use: Release builds (WSLOG_COMPILE_MIN_LEVEL >= 1)
+     * compile these call sites away entirely.
+     *
+     * @param tag Component or module identifier
+     * @param makeMessage Callable invoked lazily to build the diagnostic message
+     */
+    template <typename MakeMessage,
+              std::enable_if_t<std::is_invocable_v<MakeMessage&>, int> = 0>
+    void Debug(const std::string& tag, MakeMessage&& makeMessage)
+    {
+        LogLazy<Level::Debug>(tag, std::forward<MakeMessage>(makeMessage));
+    }
+
+    /**
+     * @brief Lazy info logging - callable invoked only if the record is emitted.
+     *
+     * @param tag Component or module identifier
+     * @param makeMessage Callable invoked lazily to build the message
+     */
+    template <typename MakeMessage,
+              std::enable_if_t<std::is_invocable_v<MakeMessage&>, int> = 0>
+    void Info(const std::string& tag, MakeMessage&& makeMessage)
+    {
+        LogLazy<Level::Info>(tag, std::forward<MakeMessage>(makeMessage));
+    }
+
+    /**
+     * @brief Lazy warning logging - callable invoked only if the record is emitted.
+     *
+     * @param tag Component or module identifier
+     * @param makeMessage Callable invoked lazily to build the message
+     */
+    template <typename MakeMessage,
+              std::enable_if_t<std::is_invocable_v<MakeMessage&>, int> = 0>
+    void Warning(const std::string& tag, MakeMessage&& makeMessage)
+    {
+        LogLazy<Level::Warning>(tag, std::forward<MakeMessage>(makeMessage));
+    }
+
 private:
     /// @brief Private constructor - use Logger::Instance() instead
     Logger() = default;
     
-    /// @brief Private destructor
-    ~Logger() = default;
+    /// @brief Private destructor - stops the drain thread and flushes queued records
+    ~Logger();
 
     /// @brief Prevent copying (singleton pattern)
     Logger(const Logger&) = delete;
@@ -146,7 +388,64 @@ private:
     mutable std::mutex mMutex;
 
     /// @brief Minimum log level to display (messages below this are ignored)
-    Level mMinLevel = Level::Debug;
+    /// @note Atomic so the hot-path level check never takes the output mutex
+    std::atomic<Level> mMinLevel{Level::Debug};
+
+    /**
+     * @struct RingCell
+     * @brief One slot of the lock-free ring buffer (Vyukov bounded queue cell).
+     *
+     * The sequence number encodes the slot state: producers claim a slot when
+     * seq == position, consumers read it when seq == position + 1. This allows
+     * multiple producers to enqueue concurrently without locks.
+     */
+    struct RingCell
+    {
+        std::atomic<size_t> seq{0};  ///< Sequence number for lock-free handoff
+        std::string line;            ///< Fully formatted log line
+    };
+
+    /// @brief Ring buffer storage (allocated by EnableAsync, power-of-two size)
+    std::unique_ptr<RingCell[]> mRing;
+
+    /// @brief Ring capacity minus one, used as an index mask (capacity is a power of two)
+    size_t mRingMask = 0;
+
+    /// @brief Next position producers will claim (monotonically increasing)
+    std::atomic<size_t> mEnqueuePos{0};
+
+    /// @brief Next position the drain thread will consume (monotonically increasing)
+    std::atomic<size_t> mDequeuePos{0};
+
+    /// @brief Whether asynchronous mode is currently active
+    std::atomic<bool> mAsyncEnabled{false};
+
+    /// @brief Whether the drain thread should keep running
+    std::atomic<bool> mDrainRunning{false};
+
+    /// @brief Total records discarded by the drop-oldest overflow policy
+    std::atomic<uint64_t> mDroppedCount{0};
+
+    /// @brief Dropped count already reported via marker lines (drain thread only)
+    uint64_t mDroppedReported = 0;
+
+    /// @brief Background thread performing the actual console I/O in async mode
+    std::thread mDrainThread;
+
+    /// @brief Structured binary backend (created on first EnableBinaryLog, kept for reuse)
+    std::unique_ptr<BinaryLogWriter> mBinaryLog;
+
+    /// @brief Whether the binary backend is active - checked lock-free on every Log()
+    std::atomic<bool> mBinaryLogEnabled{false};
+
+    /// @brief Try to push a formatted line into the ring buffer (lock-free, may fail when full)
+    bool TryEnqueue(std::string&& line);
+
+    /// @brief Try to pop the oldest line from the ring buffer (drain thread / overflow path)
+    bool TryDequeue(std::string& line);
+
+    /// @brief Drain thread main loop - writes queued records to std::cout
+    void DrainLoop();
 
     /**
      * @brief Generate current timestamp as string with milliseconds.
@@ -1,180 +1,674 @@
-// CodeRabbit: Please review this file thoroughly for production readiness
-#include "MessageHandler.hpp"
-#include "Logger.hpp"
-
-/**
- * @file MessageHandler.cpp
- * @brief Implementation of message routing from protocol layer to application logic.
- * 
- * This file implements the MessageRouter class which acts as a dispatcher,
- * routing parsed protocol messages to the appropriate handler methods based
- * on the message type. This decouples the protocol layer from application logic.
- */
-
-MessageRouter::MessageRouter()
-{
-    // Constructor is minimal - all state is initialized in-class
-}
-
-void MessageRouter::SetMessageHandler(IMessageHandler* handler)
-{
-    // Store the handler pointer for later routing
-    // Note: This should be called before messages start arriving
-    mHandler = handler;
-    
-    if (handler)
-    {
-        Logger::Instance().Debug("MessageRouter", 
-            "Message handler attached");
-    }
-    else
-    {
-        Logger::Instance().Debug("MessageRouter", 
-            "Message handler detached (set to null)");
-    }
-}
-
-void MessageRouter::RouteMessage(const Protocol::Message& msg)
-{
-    // Check if a handler is attached
-    if (!mHandler)
-    {
-        Logger::Instance().Warning("MessageRouter", 
-            "No handler set for message routing - message dropped");
-        return;
-    }
-
-    // Route the message to the appropriate handler method based on type
-    switch (msg.type)
-    {
-    // Hello and Acknowledge are both text messages
-    case Protocol::MessageType::Hello:
-        Logger::Instance().Debug("MessageRouter", 
-            "Routing Hello message: " + msg.msgId);
-        mHandler->OnTextMessage(msg);
-        break;
-
-    case Protocol::MessageType::Acknowledge:
-        Logger::Instance().Debug("MessageRouter", 
-            "Routing Acknowledge message: " + msg.msgId);
-        mHandler->OnTextMessage(msg);
-        break;
-
-    // Binary transfer starts with metadata
-    case Protocol::MessageType::BinaryStart:
-        Logger::Instance().Debug("MessageRouter", 
-            "Routing BinaryStart: " + std::to_string(msg.binarySize) + " bytes");
-        mHandler->OnBinaryStart(msg);
-        break;
-
-    // Protocol errors are reported separately
-    case Protocol::MessageType::Error:
-        Logger::Instance().Warning("MessageRouter", 
-            "Routing Error message: " + msg.content);
-        mHandler->OnProtocolError(msg.content);
-        break;
-
-    // Unknown message types are protocol violations - report to application
-    case Protocol::MessageType::Unknown:
-    case Protocol::MessageType::BinaryData:  // Should not arrive as text
-    default:
-        {
-            std::string errorMsg = "Unhandled or invalid message type: " + 
-                                   std::to_string(static_cast<int>(msg.type)) +
-                                   " (msgId: " + msg.msgId + ")";
-            
-            Logger::Instance().Warning("MessageRouter", errorMsg);
-            
-            // Notify application of protocol anomaly so it can react
-            mHandler->OnProtocolError(errorMsg);
-        }
-        break;
-    }
-}
-
-void MessageRouter::RouteBinaryData(const uint8_t* data, size_t size)
-{
-    // Check if a handler is attached
-    if (!mHandler)
-    {
-        Logger::Instance().Warning("MessageRouter", 
-            "No handler set for binary data - data dropped");
-        return;
-    }
-
-    // Sanity checks
-    if (!data || size == 0)
-    {
-        Logger::Instance().Warning("MessageRouter", 
-            std::string("Invalid binary chunk: ") + (data ? "empty" : "null pointer"));
-        return;
-    }
-
-    // Route binary data to handler
-    Logger::Instance().Debug("MessageRouter", 
-        "Routing binary chunk: " + std::to_string(size) + " bytes");
-    mHandler->OnBinaryChunk(data, size);
-}
-
-void MessageRouter::RouteBinaryComplete()
-{
-    // Check if a handler is attached
-    if (!mHandler)
-    {
-        Logger::Instance().Warning("MessageRouter", 
-            "No handler set for binary completion");
-        return;
-    }
-
-    // Notify handler that binary transfer is complete
-    Logger::Instance().Debug("MessageRouter", "Binary transfer completed");
-    mHandler->OnBinaryComplete();
-}
-
-void MessageRouter::RouteProtocolError(const std::string& errorMsg)
-{
-    // Check if a handler is attached
-    if (!mHandler)
-    {
-        Logger::Instance().Warning("MessageRouter", 
-            "No handler set for protocol error: " + errorMsg);
-        return;
-    }
-
-    // Route error to handler
-    Logger::Instance().Warning("MessageRouter", 
-        "Routing protocol error: " + errorMsg);
-    mHandler->OnProtocolError(errorMsg);
-}
-
-void MessageRouter::RoutePing(const std::string& payload)
-{
-    // Check if a handler is attached
-    if (!mHandler)
-    {
-        Logger::Instance().Debug("MessageRouter", 
-            "No handler set for ping notification");
-        return;
-    }
-
-    // Route ping to handler (informational only - pong is auto-sent by IXWebSocket)
-    Logger::Instance().Debug("MessageRouter", 
-        "Routing ping received" + (payload.empty() ? "" : ": " + payload));
-    mHandler->OnPing(payload);
-}
-
-void MessageRouter::RoutePong(const std::string& payload)
-{
-    // Check if a handler is attached
-    if (!mHandler)
-    {
-        Logger::Instance().Debug("MessageRouter", 
-            "No handler set for pong notification");
-        return;
-    }
-
-    // Route pong to handler
-    Logger::Instance().Debug("MessageRouter", 
-        "Routing pong received" + (payload.empty() ? "" : ": " + payload));
-    mHandler->OnPong(payload);
-}
+// CodeRabbit: Please review this file thoroughly for production readiness
+#include "MessageHandler.hpp"
+#include "BufferPool.hpp"
+#include "Logger.hpp"
+
+/**
+ * @file MessageHandler.cpp
+ * @brief Implementation of message routing from protocol layer to application logic.
+ * 
+ * This file implements the MessageRouter class which acts as a dispatcher,
+ * routing parsed protocol messages to the appropriate handler methods based
+ * on the message type. This decouples the protocol layer from application logic.
+ */
+
+MessageRouter::MessageRouter()
+{
+    // Constructor is minimal - all state is initialized in-class
+}
+
+MessageRouter::~MessageRouter()
+{
+    // Drain and stop the executor worker if one is running
+    DisableExecutor();
+}
+
+void MessageRouter::SetMessageHandler(IMessageHandler* handler)
+{
+    // Store the handler pointer for later routing
+    // Note: This should be called before messages start arriving
+    mHandler = handler;
+    
+    if (handler)
+    {
+        Logger::Instance().Debug("MessageRouter", 
+            "Message handler attached");
+    }
+    else
+    {
+        Logger::Instance().Debug("MessageRouter", 
+            "Message handler detached (set to null)");
+    }
+}
+
+void MessageRouter::RouteMessage(const Protocol::Message& msg)
+{
+    // Check if a handler is attached
+    if (!mHandler)
+    {
+        Logger::Instance().Warning("MessageRouter", 
+            "No handler set for message routing - message dropped");
+        return;
+    }
+
+    // Executor mode: queue a copy for the worker instead of dispatching inline.
+    // The copy lands in a recycled Message so steady-state traffic reuses the
+    // same string capacity instead of allocating per event.
+    if (mExecutorEnabled.load(std::memory_order_acquire))
+    {
+        DispatchEvent event;
+        event.kind = DispatchEvent::Kind::Text;
+        event.msg = BufferPool::Instance().AcquireMessage();
+        event.msg.type = msg.type;
+        event.msg.msgId = msg.msgId;
+        event.msg.content = msg.content;
+        event.msg.binarySize = msg.binarySize;
+        event.msg.crc32c = msg.crc32c;
+        event.msg.hasCrc32c = msg.hasCrc32c;
+        if (EnqueueEvent(std::move(event)))
+            return;
+        // Executor shut down mid-call - fall through to inline dispatch
+    }
+
+    DispatchMessage(msg);
+}
+
+void MessageRouter::DispatchMessage(const Protocol::Message& msg)
+{
+    // Route the message to the appropriate handler method based on type
+    switch (msg.type)
+    {
+    // Hello and Acknowledge are both text messages
+    case Protocol::MessageType::Hello:
+        Logger::Instance().Debug("MessageRouter", 
+            "Routing Hello message: " + msg.msgId);
+        mHandler->OnTextMessage(msg);
+        break;
+
+    case Protocol::MessageType::Acknowledge:
+        Logger::Instance().Debug("MessageRouter", 
+            "Routing Acknowledge message: " + msg.msgId);
+        mHandler->OnTextMessage(msg);
+        break;
+
+    // Binary transfer starts with metadata
+    case Protocol::MessageType::BinaryStart:
+        Logger::Instance().Debug("MessageRouter", 
+            "Routing BinaryStart: " + std::to_string(msg.binarySize) + " bytes");
+        mHandler->OnBinaryStart(msg);
+        break;
+
+    // Protocol errors are reported separately
+    case Protocol::MessageType::Error:
+        Logger::Instance().Warning("MessageRouter", 
+            "Routing Error message: " + msg.content);
+        mHandler->OnProtocolError(msg.content);
+        break;
+
+    // Unknown message types are protocol violations - report to application
+    case Protocol::MessageType::Unknown:
+    case Protocol::MessageType::BinaryData:  // Should not arrive as text
+    default:
+        {
+            std::string errorMsg = "Unhandled or invalid message type: " + 
+                                   std::to_string(static_cast<int>(msg.type)) +
+                                   " (msgId: " + msg.msgId + ")";
+            
+            Logger::Instance().Warning("MessageRouter", errorMsg);
+            
+            // Notify application of protocol anomaly so it can react
+            mHandler->OnProtocolError(errorMsg);
+        }
+        break;
+    }
+}
+
+void MessageRouter::RouteMessageView(const Protocol::MessageView& msg)
+{
+    // Check if a handler is attached
+    if (!mHandler)
+    {
+        Logger::Instance().Warning("MessageRouter",
+            "No handler set for message routing - message dropped");
+        return;
+    }
+
+    // Executor mode: views cannot cross threads (their fields point into the
+    // frame buffer), so materialize an owning Message and queue it. A recycled
+    // Message keeps this allocation-free at steady state - the assigns below
+    // reuse the capacity left by earlier messages of similar shape.
+    if (mExecutorEnabled.load(std::memory_order_acquire))
+    {
+        DispatchEvent event;
+        event.kind = DispatchEvent::Kind::Text;
+        event.msg = BufferPool::Instance().AcquireMessage();
+        event.msg.type = msg.type;
+        event.msg.msgId.assign(msg.msgId.data(), msg.msgId.size());
+        event.msg.content.assign(msg.content.data(), msg.content.size());
+        event.msg.binarySize = msg.binarySize;
+        event.msg.crc32c = msg.crc32c;
+        event.msg.hasCrc32c = msg.hasCrc32c;
+        if (EnqueueEvent(std::move(event)))
+            return;
+        // Executor shut down mid-call - fall through to the inline view path
+    }
+
+    // Offer the allocation-free view first; a handler that consumes it here
+    // processes the message with zero heap allocations
+    if (mHandler->OnTextMessageView(msg))
+        return;
+
+    // Handler did not opt in - materialize an owning Message and dispatch
+    // through the traditional type-switched path
+    RouteMessage(Protocol::ToMessage(msg));
+}
+
+void MessageRouter::RouteBinaryData(const uint8_t* data, size_t size)
+{
+    // Check if a handler is attached
+    if (!mHandler)
+    {
+        Logger::Instance().Warning("MessageRouter", 
+            "No handler set for binary data - data dropped");
+        return;
+    }
+
+    // Sanity checks
+    if (!data || size == 0)
+    {
+        Logger::Instance().Warning("MessageRouter", 
+            std::string("Invalid binary chunk: ") + (data ? "empty" : "null pointer"));
+        return;
+    }
+
+    // Executor mode: the caller's buffer may be freed on return, so copy the
+    // chunk into an owned event for the worker
+    if (mExecutorEnabled.load(std::memory_order_acquire))
+    {
+        DispatchEvent event;
+        event.kind = DispatchEvent::Kind::BinaryChunk;
+        event.data = BufferPool::Instance().AcquireBuffer(size);
+        event.data.assign(reinterpret_cast<const char*>(data), size);
+        if (EnqueueEvent(std::move(event)))
+            return;
+    }
+
+    // Route binary data to handler
+    Logger::Instance().Debug("MessageRouter", 
+        "Routing binary chunk: " + std::to_string(size) + " bytes");
+    mHandler->OnBinaryChunk(data, size);
+}
+
+void MessageRouter::RouteBinaryDataOwned(std::string&& data)
+{
+    // Check if a handler is attached
+    if (!mHandler)
+    {
+        Logger::Instance().Warning("MessageRouter",
+            "No handler set for binary data - data dropped");
+        return;
+    }
+
+    // Sanity check - an empty frame carries no data
+    if (data.empty())
+    {
+        Logger::Instance().Warning("MessageRouter",
+            "Invalid binary chunk: empty");
+        return;
+    }
+
+    // Executor mode: the buffer is already owned - move it into the queue
+    if (mExecutorEnabled.load(std::memory_order_acquire))
+    {
+        DispatchEvent event;
+        event.kind = DispatchEvent::Kind::BinaryChunk;
+        event.data = std::move(data);
+        if (EnqueueEvent(std::move(event)))
+            return;
+        data = std::move(event.data);  // Reclaim for inline fallback
+    }
+
+    // Offer buffer ownership to the handler first (zero-copy path)
+    Logger::Instance().Debug("MessageRouter",
+        "Routing owned binary chunk: " + std::to_string(data.size()) + " bytes");
+
+    if (mHandler->OnBinaryChunkOwned(std::move(data)))
+        return;  // Handler took the buffer - no copy needed
+
+    // Handler declined ownership - fall back to the copy-based callback.
+    // Note: OnBinaryChunkOwned must leave the buffer intact when returning false.
+    mHandler->OnBinaryChunk(
+        reinterpret_cast<const uint8_t*>(data.data()),
+        data.size());
+
+    // The buffer is ours once the handler has consumed the copy - recycle it
+    BufferPool::Instance().ReleaseBuffer(std::move(data));
+}
+
+void MessageRouter::RouteBinaryDataOwned(const std::string& streamId, std::string&& data)
+{
+    // Check if a handler is attached
+    if (!mHandler)
+    {
+        Logger::Instance().Warning("MessageRouter",
+            "No handler set for binary data - data dropped");
+        return;
+    }
+
+    // Sanity check - an empty frame carries no data
+    if (data.empty())
+    {
+        Logger::Instance().Warning("MessageRouter",
+            "Invalid binary chunk: empty");
+        return;
+    }
+
+    // Executor mode: the buffer is already owned - move it into the queue
+    if (mExecutorEnabled.load(std::memory_order_acquire))
+    {
+        DispatchEvent event;
+        event.kind = DispatchEvent::Kind::BinaryChunk;
+        event.streamId = streamId;
+        event.data = std::move(data);
+        if (EnqueueEvent(std::move(event)))
+            return;
+        data = std::move(event.data);  // Reclaim for inline fallback
+    }
+
+    DispatchBinaryChunk(streamId, std::move(data));
+}
+
+void MessageRouter::DispatchBinaryChunk(const std::string& streamId, std::string&& data)
+{
+    // Offer buffer ownership to the handler first (zero-copy path)
+    Logger::Instance().Debug("MessageRouter", [&] {
+        return "Routing owned binary chunk for stream '" + streamId + "': " +
+               std::to_string(data.size()) + " bytes"; });
+
+    if (mHandler->OnBinaryChunkOwned(streamId, std::move(data)))
+        return;  // Handler took the buffer - no copy needed
+
+    // Handler declined ownership - fall back to the copy-based stream-aware
+    // callback (which itself defaults to the legacy single-stream one).
+    // Note: OnBinaryChunkOwned must leave the buffer intact when returning false.
+    mHandler->OnBinaryChunk(streamId,
+        reinterpret_cast<const uint8_t*>(data.data()),
+        data.size());
+
+    // The buffer is ours once the handler has consumed the copy - recycle it
+    // so the next chunk of this size class skips the heap entirely
+    BufferPool::Instance().ReleaseBuffer(std::move(data));
+}
+
+void MessageRouter::RouteBinaryComplete(const std::string& streamId)
+{
+    // Check if a handler is attached
+    if (!mHandler)
+    {
+        Logger::Instance().Warning("MessageRouter",
+            "No handler set for binary completion");
+        return;
+    }
+
+    // Executor mode: queue the completion so it stays ordered after the chunks
+    if (mExecutorEnabled.load(std::memory_order_acquire))
+    {
+        DispatchEvent event;
+        event.kind = DispatchEvent::Kind::BinaryComplete;
+        event.streamId = streamId;
+        if (EnqueueEvent(std::move(event)))
+            return;
+    }
+
+    // Notify handler that this stream's transfer is complete
+    Logger::Instance().Debug("MessageRouter", [&streamId] {
+        return "Binary transfer completed for stream '" + streamId + "'"; });
+    mHandler->OnBinaryComplete(streamId);
+}
+
+void MessageRouter::RouteBinaryComplete(const std::string& streamId,
+                                        bool pChecksumValid)
+{
+    // A failed checksum is a protocol-level fault in its own right - surface it
+    // through the error path before the completion so the handler sees both
+    if (!pChecksumValid)
+    {
+        RouteProtocolError("Checksum mismatch on binary stream '" + streamId + "'");
+    }
+
+    // Check if a handler is attached
+    if (!mHandler)
+    {
+        Logger::Instance().Warning("MessageRouter",
+            "No handler set for binary completion");
+        return;
+    }
+
+    // Executor mode: queue the completion so it stays ordered after the chunks
+    if (mExecutorEnabled.load(std::memory_order_acquire))
+    {
+        DispatchEvent event;
+        event.kind = DispatchEvent::Kind::BinaryComplete;
+        event.streamId = streamId;
+        event.hasChecksum = true;
+        event.checksumValid = pChecksumValid;
+        if (EnqueueEvent(std::move(event)))
+            return;
+    }
+
+    // Notify handler with the verdict attached
+    Logger::Instance().Debug("MessageRouter", [&streamId, pChecksumValid] {
+        return "Binary transfer completed for stream '" + streamId +
+               "' (checksum " + (pChecksumValid ? "ok" : "MISMATCH") + ")"; });
+    mHandler->OnBinaryComplete(streamId, pChecksumValid);
+}
+
+void MessageRouter::RouteBinaryComplete()
+{
+    // Check if a handler is attached
+    if (!mHandler)
+    {
+        Logger::Instance().Warning("MessageRouter", 
+            "No handler set for binary completion");
+        return;
+    }
+
+    // Executor mode: queue the completion so it stays ordered after the chunks
+    if (mExecutorEnabled.load(std::memory_order_acquire))
+    {
+        DispatchEvent event;
+        event.kind = DispatchEvent::Kind::BinaryComplete;
+        if (EnqueueEvent(std::move(event)))
+            return;
+    }
+
+    // Notify handler that binary transfer is complete
+    Logger::Instance().Debug("MessageRouter", "Binary transfer completed");
+    mHandler->OnBinaryComplete();
+}
+
+void MessageRouter::RouteProtocolError(const std::string& errorMsg)
+{
+    // Counted regardless of handler/executor state - the stats surface wants
+    // every error that reached the router
+    mProtocolErrors.fetch_add(1, std::memory_order_relaxed);
+
+    // Check if a handler is attached
+    if (!mHandler)
+    {
+        Logger::Instance().Warning("MessageRouter", 
+            "No handler set for protocol error: " + errorMsg);
+        return;
+    }
+
+    // Executor mode: queue the error in sequence with the messages around it
+    if (mExecutorEnabled.load(std::memory_order_acquire))
+    {
+        DispatchEvent event;
+        event.kind = DispatchEvent::Kind::ProtocolError;
+        event.data = errorMsg;
+        if (EnqueueEvent(std::move(event)))
+            return;
+    }
+
+    // Route error to handler
+    Logger::Instance().Warning("MessageRouter", 
+        "Routing protocol error: " + errorMsg);
+    mHandler->OnProtocolError(errorMsg);
+}
+
+void MessageRouter::RoutePing(const std::string& payload)
+{
+    // Check if a handler is attached
+    if (!mHandler)
+    {
+        Logger::Instance().Debug("MessageRouter", 
+            "No handler set for ping notification");
+        return;
+    }
+
+    // Executor mode: queue the notification like any other event
+    if (mExecutorEnabled.load(std::memory_order_acquire))
+    {
+        DispatchEvent event;
+        event.kind = DispatchEvent::Kind::Ping;
+        event.data = payload;
+        if (EnqueueEvent(std::move(event)))
+            return;
+    }
+
+    // Route ping to handler (informational only - pong is auto-sent by IXWebSocket)
+    Logger::Instance().Debug("MessageRouter", 
+        "Routing ping received" + (payload.empty() ? "" : ": " + payload));
+    mHandler->OnPing(payload);
+}
+
+void MessageRouter::RoutePong(const std::string& payload)
+{
+    // Check if a handler is attached
+    if (!mHandler)
+    {
+        Logger::Instance().Debug("MessageRouter", 
+            "No handler set for pong notification");
+        return;
+    }
+
+    // Executor mode: queue the notification like any other event
+    if (mExecutorEnabled.load(std::memory_order_acquire))
+    {
+        DispatchEvent event;
+        event.kind = DispatchEvent::Kind::Pong;
+        event.data = payload;
+        if (EnqueueEvent(std::move(event)))
+            return;
+    }
+
+    // Route pong to handler
+    Logger::Instance().Debug("MessageRouter", 
+        "Routing pong received" + (payload.empty() ? "" : ": " + payload));
+    mHandler->OnPong(payload);
+}
+
+void MessageRouter::RouteReconnected(int attempt)
+{
+    // Check if a handler is attached
+    if (!mHandler)
+    {
+        Logger::Instance().Debug("MessageRouter",
+            "No handler set for reconnection notification");
+        return;
+    }
+
+    // Lifecycle events bypass the executor queue: they are rare, cheap, and
+    // must not wait behind a backlog of data messages
+    Logger::Instance().Info("MessageRouter",
+        "Routing reconnected notification (attempt " + std::to_string(attempt) + ")");
+    mHandler->OnReconnected(attempt);
+}
+
+void MessageRouter::RouteMessageAcked(const std::string& msgId)
+{
+    // Check if a handler is attached
+    if (!mHandler)
+        return;
+
+    // Ack-window events bypass the executor queue like other lifecycle events
+    Logger::Instance().Debug("MessageRouter", [&msgId] {
+        return "Routing ack for message '" + msgId + "'"; });
+    mHandler->OnMessageAcked(msgId);
+}
+
+void MessageRouter::RouteMessageRetransmit(const std::string& msgId, int attempt)
+{
+    // Check if a handler is attached
+    if (!mHandler)
+        return;
+
+    Logger::Instance().Warning("MessageRouter",
+        "Routing retransmit for message '" + msgId + "' (attempt " +
+        std::to_string(attempt) + ")");
+    mHandler->OnMessageRetransmit(msgId, attempt);
+}
+
+void MessageRouter::RouteMessageTimeout(const std::string& msgId)
+{
+    // Check if a handler is attached
+    if (!mHandler)
+        return;
+
+    Logger::Instance().Error("MessageRouter",
+        "Routing delivery timeout for message '" + msgId + "'");
+    mHandler->OnMessageTimeout(msgId);
+}
+
+void MessageRouter::EnableExecutor(size_t queueDepth, OverflowPolicy policy)
+{
+    if (mExecutorEnabled.load(std::memory_order_acquire))
+    {
+        Logger::Instance().Warning("MessageRouter",
+            "EnableExecutor called while executor already running - ignored");
+        return;
+    }
+
+    // A zero-depth queue would make every enqueue an overflow
+    mQueueDepth = (queueDepth > 0) ? queueDepth : 1;
+    mOverflowPolicy = policy;
+    mDroppedEvents.store(0, std::memory_order_relaxed);
+
+    mExecutorEnabled.store(true, std::memory_order_release);
+    mWorker = std::thread(&MessageRouter::ExecutorLoop, this);
+
+    Logger::Instance().Info("MessageRouter",
+        "Executor enabled - depth=" + std::to_string(mQueueDepth) +
+        ", policy=" + (policy == OverflowPolicy::Block ? "block" : "drop-newest"));
+}
+
+void MessageRouter::DisableExecutor()
+{
+    if (!mExecutorEnabled.load(std::memory_order_acquire))
+        return;
+
+    // Flip the flag under the lock so the worker observes it together with
+    // the queue contents, then wake everyone
+    {
+        std::lock_guard<std::mutex> lock(mQueueMutex);
+        mExecutorEnabled.store(false, std::memory_order_release);
+    }
+    mQueueNotEmpty.notify_all();
+    mQueueNotFull.notify_all();
+
+    // The worker drains every already-queued event before exiting
+    if (mWorker.joinable())
+        mWorker.join();
+
+    const uint64_t dropped = mDroppedEvents.load(std::memory_order_relaxed);
+    Logger::Instance().Info("MessageRouter",
+        "Executor disabled" +
+        (dropped > 0 ? " (" + std::to_string(dropped) + " events dropped)" : ""));
+}
+
+bool MessageRouter::EnqueueEvent(DispatchEvent&& event)
+{
+    std::unique_lock<std::mutex> lock(mQueueMutex);
+
+    if (mOverflowPolicy == OverflowPolicy::Block)
+    {
+        // Lossless: wait for the worker to make room (bounded backpressure)
+        mQueueNotFull.wait(lock, [this] {
+            return mQueue.size() < mQueueDepth ||
+                   !mExecutorEnabled.load(std::memory_order_acquire);
+        });
+    }
+    else if (mQueue.size() >= mQueueDepth)
+    {
+        // DropNewest: discard the incoming event and keep the socket thread moving
+        mDroppedEvents.fetch_add(1, std::memory_order_relaxed);
+        return true;  // Consumed (by dropping) - caller must not dispatch inline
+    }
+
+    // If the executor shut down while we waited, tell the caller to dispatch inline
+    if (!mExecutorEnabled.load(std::memory_order_acquire))
+        return false;
+
+    mQueue.push_back(std::move(event));
+    lock.unlock();
+    mQueueNotEmpty.notify_one();
+    return true;
+}
+
+void MessageRouter::ExecutorLoop()
+{
+    Logger::Instance().Debug("MessageRouter", "Executor worker started");
+
+    while (true)
+    {
+        DispatchEvent event;
+        {
+            std::unique_lock<std::mutex> lock(mQueueMutex);
+            mQueueNotEmpty.wait(lock, [this] {
+                return !mQueue.empty() ||
+                       !mExecutorEnabled.load(std::memory_order_acquire);
+            });
+
+            // Exit only once the queue is fully drained (flush-on-disable)
+            if (mQueue.empty())
+                break;
+
+            event = std::move(mQueue.front());
+            mQueue.pop_front();
+        }
+        mQueueNotFull.notify_one();
+
+        // Dispatch outside the lock - a slow handler must never hold the queue
+        DispatchEventNow(std::move(event));
+
+        // Text events keep their Message (DispatchMessage takes it by const
+        // reference) - hand it back to the pool so its string capacity is
+        // reused by the next enqueue
+        if (event.kind == DispatchEvent::Kind::Text)
+            BufferPool::Instance().ReleaseMessage(std::move(event.msg));
+    }
+
+    Logger::Instance().Debug("MessageRouter", "Executor worker stopped");
+}
+
+void MessageRouter::DispatchEventNow(DispatchEvent&& event)
+{
+    // The handler was checked non-null at enqueue time, but guard anyway -
+    // SetMessageHandler(nullptr) may have raced with queued events
+    if (!mHandler)
+        return;
+
+    switch (event.kind)
+    {
+    case DispatchEvent::Kind::Text:
+        DispatchMessage(event.msg);
+        break;
+
+    case DispatchEvent::Kind::BinaryChunk:
+        DispatchBinaryChunk(event.streamId, std::move(event.data));
+        break;
+
+    case DispatchEvent::Kind::BinaryComplete:
+        // An empty stream id means the legacy parameterless completion
+        if (event.hasChecksum)
+            mHandler->OnBinaryComplete(event.streamId, event.checksumValid);
+        else if (event.streamId.empty())
+            mHandler->OnBinaryComplete();
+        else
+            mHandler->OnBinaryComplete(event.streamId);
+        break;
+
+    case DispatchEvent::Kind::ProtocolError:
+        mHandler->OnProtocolError(event.data);
+        break;
+
+    case DispatchEvent::Kind::Ping:
+        mHandler->OnPing(event.data);
+        break;
+
+    case DispatchEvent::Kind::Pong:
+        mHandler->OnPong(event.data);
+        break;
+    }
+}
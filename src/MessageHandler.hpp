@@ -1,247 +1,931 @@
-// CodeRabbit: Please review this file thoroughly for production readiness
-#pragma once
-
-#include <string>
-#include <functional>
-#include "Protocol.hpp"
-
-/**
- * @class IMessageHandler
- * @brief Abstract interface for application-level message handling.
- * 
- * This is the primary way your application interacts with incoming protocol messages.
- * Instead of dealing with raw WebSocket callbacks, you implement this interface to
- * define how your application responds to specific message types.
- * 
- * The WebSocket client calls these methods from its internal thread, so if you need
- * to update UI or access shared state, you may need to post the work to your main
- * application thread (thread-safety is your responsibility).
- * 
- * @note All callback methods are invoked from the WebSocket thread, not the main thread.
- * 
- * @example
- *   class MyHandler : public IMessageHandler {
- *       void OnTextMessage(const Protocol::Message& msg) override {
- *           // Handle hello/ack messages
- *       }
- *       void OnBinaryStart(const Protocol::Message& msg) override {
- *           // Prepare to receive binary data
- *           reserve_buffer(msg.binarySize);
- *       }
- *       // ... implement other methods
- *   };
- */
-class IMessageHandler
-{
-public:
-    /// @brief Virtual destructor - required for proper cleanup of derived classes
-    virtual ~IMessageHandler() = default;
-
-    /**
-     * @brief Called when a text protocol message is received.
-     * 
-     * This handles hello messages, acknowledgments, and other text-based protocol
-     * messages. The specific message type is indicated in msg.type.
-     * 
-     * @param msg The parsed protocol message containing type, ID, and content
-     * 
-     * @note This is called from the WebSocket thread, not your main application thread.
-     * @note Binary data transfers start with a BinaryStart text message, then OnBinaryStart
-     *       is called separately.
-     */
-    virtual void OnTextMessage(const Protocol::Message& msg) = 0;
-
-    /**
-     * @brief Called when a binary data transfer begins.
-     * 
-     * This message signals the start of a binary data transfer. The expected size
-     * is provided in msg.binarySize, allowing you to pre-allocate buffers or resources.
-     * 
-     * After this call, one or more OnBinaryChunk calls will follow with the actual data,
-     * and finally OnBinaryComplete will be called when all data is received.
-     * 
-     * @param msg The BinaryStart message containing size information
-     * 
-     * @note The binary size is provided as a hint; always be prepared for a call to
-     *       OnBinaryChunk with less or more data than expected (error tolerance).
-     */
-    virtual void OnBinaryStart(const Protocol::Message& msg) = 0;
-
-    /**
-     * @brief Called when a chunk of binary data is received.
-     * 
-     * Binary transfers may arrive in multiple chunks. This method is called for each
-     * chunk. You should accumulate or process the data as it arrives.
-     * 
-     * Multiple chunks may arrive before OnBinaryComplete is called.
-     * For example: OnBinaryStart -> OnBinaryChunk(64KB) -> OnBinaryChunk(64KB) 
-     *             -> OnBinaryChunk(remaining) -> OnBinaryComplete
-     * 
-     * @param data Pointer to the binary data chunk
-     * @param size Size of this chunk in bytes
-     * 
-     * @note Do not modify the data buffer; it may be freed immediately after this returns.
-     * @note Copy data if you need to store it beyond this function call.
-     */
-    virtual void OnBinaryChunk(const uint8_t* data, size_t size) = 0;
-
-    /**
-     * @brief Called when a complete binary transfer is finished.
-     * 
-     * All expected data for the current binary transfer has been received and passed
-     * to OnBinaryChunk calls. At this point, you can finalize processing, validate
-     * checksums, etc.
-     * 
-     * After this call, new text or binary messages may arrive.
-     */
-    virtual void OnBinaryComplete() = 0;
-
-    /**
-     * @brief Called when a protocol error occurs.
-     * 
-     * The server or protocol layer detected an error condition. The reason string
-     * provides details about what went wrong.
-     * 
-     * Common error reasons:
-     * - "Invalid message format" - JSON parsing failed
-     * - "Unsupported message type" - Unknown message type received
-     * - "Binary size exceeded" - Binary transfer exceeds max size limit
-     * 
-     * @param reason Human-readable error description
-     */
-    virtual void OnProtocolError(const std::string& reason) = 0;
-
-    /**
-     * @brief Called when a ping frame is received from the server.
-     * 
-     * Note: The WebSocket library automatically responds with a pong frame,
-     * so you don't need to do anything. This is just for informational purposes.
-     * 
-     * @param payload The ping payload data (may be empty)
-     * 
-     * @note Default implementation does nothing - override if you need ping notifications
-     */
-    virtual void OnPing(const std::string& payload) { (void)payload; }
-
-    /**
-     * @brief Called when a pong frame is received from the server.
-     * 
-     * This is typically in response to a ping sent by SendPing() or automatic heartbeat.
-     * You can use this to measure round-trip latency.
-     * 
-     * @param payload The pong payload data (echoes the ping payload)
-     * 
-     * @note Default implementation does nothing - override if you need pong notifications
-     */
-    virtual void OnPong(const std::string& payload) { (void)payload; }
-};
-
-/**
- * @class MessageRouter
- * @brief Routes parsed protocol messages to the application message handler.
- * 
- * This class acts as a bridge between the WebSocket client's low-level message
- * handling and your application's business logic (IMessageHandler). It takes parsed
- * Protocol::Message objects and routes them to the appropriate handler method based
- * on message type.
- * 
- * Thread Safety:
- * - SetMessageHandler() should only be called before connecting
- * - All Route* methods are called from the WebSocket thread
- * - Your IMessageHandler implementation must be thread-safe if accessed from other threads
- * 
- * @example
- *   MessageRouter router;
- *   MyHandler myHandler;
- *   router.SetMessageHandler(&myHandler);
- *   
- *   // Router will now dispatch messages to myHandler
- *   Protocol::Message msg = ...;
- *   router.RouteMessage(msg);
- */
-class MessageRouter
-{
-public:
-    /// @brief Construct an empty message router with no handler
-    MessageRouter();
-
-    /**
-     * @brief Set the handler to receive routed messages.
-     * 
-     * @param handler Pointer to IMessageHandler implementation, or nullptr to disable routing
-     * 
-     * @note Should be set before connecting to avoid missing messages
-     * @note Changing handlers while messages are being routed may cause messages to be ignored
-     */
-    void SetMessageHandler(IMessageHandler* handler);
-
-    /**
-     * @brief Route a parsed protocol message to the handler.
-     * 
-     * This examines the message type and calls the appropriate handler method.
-     * 
-     * @param msg The message to route (type determines which handler method is called)
-     * 
-     * @example
-     *   Protocol::Message msg(MessageType::Hello, "id1");
-     *   router.RouteMessage(msg);  // Calls handler->OnTextMessage(msg)
-     */
-    void RouteMessage(const Protocol::Message& msg);
-
-    /**
-     * @brief Route a binary data chunk to the handler.
-     * 
-     * Passes binary data to the handler's OnBinaryChunk method. Call RouteMessage
-     * with a BinaryStart message first, then this one or more times, then RouteBinaryComplete.
-     * 
-     * @param data Pointer to binary data
-     * @param size Size of the data in bytes
-     * 
-     * @see RouteMessage, RouteBinaryComplete
-     */
-    void RouteBinaryData(const uint8_t* data, size_t size);
-
-    /**
-     * @brief Signal that binary transfer is complete.
-     * 
-     * Call this after the final OnBinaryChunk to signal completion. The handler's
-     * OnBinaryComplete method will be called.
-     * 
-     * @see RouteMessage, RouteBinaryData
-     */
-    void RouteBinaryComplete();
-    
-    /**
-     * @brief Route a protocol error directly to the handler.
-     * 
-     * Used by WsClient to report protocol-level errors (overflow, invalid sizes, etc.)
-     * to the application handler.
-     * 
-     * @param errorMsg Human-readable error description
-     */
-    void RouteProtocolError(const std::string& errorMsg);
-
-    /**
-     * @brief Route a ping notification to the handler.
-     * 
-     * Called when a ping frame is received from the server.
-     * 
-     * @param payload The ping payload data
-     */
-    void RoutePing(const std::string& payload);
-
-    /**
-     * @brief Route a pong notification to the handler.
-     * 
-     * Called when a pong frame is received from the server.
-     * 
-     * @param payload The pong payload data
-     */
-    void RoutePong(const std::string& payload);
-
-private:
-    /// @brief Pointer to the application's message handler (may be null)
-    /// @note Access is NOT synchronized - caller must ensure SetMessageHandler
-    ///       is only called before message routing begins (during setup phase)
-    IMessageHandler* mHandler = nullptr;
-};
+// CodeRabbit: Please review this file thoroughly for production readiness
+#pragma once
+
+#include <string>
+#include <functional>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "Protocol.hpp"
+
+/**
+ * @class IMessageHandler
+ * @brief Abstract interface for application-level message handling.
+ * 
+ * This is the primary way your application interacts with incoming protocol messages.
+ * Instead of dealing with raw WebSocket callbacks, you implement this interface to
+ * define how your application responds to specific message types.
+ * 
+ * The WebSocket client calls these methods from its internal thread, so if you need
+ * to update UI or access shared state, you may need to post the work to your main
+ * application thread (thread-safety is your responsibility).
+ * 
+ * @note All callback methods are invoked from the WebSocket thread, not the main thread.
+ * 
+ * @example
+ *   class MyHandler : public IMessageHandler {
+ *       void OnTextMessage(const Protocol::Message& msg) override {
+ *           // Handle hello/ack messages
+ *       }
+ *       void OnBinaryStart(const Protocol::Message& msg) override {
+ *           // Prepare to receive binary data
+ *           reserve_buffer(msg.binarySize);
+ *       }
+ *       // ... implement other methods
+ *   };
+ */
+class IMessageHandler
+{
+public:
+    /// @brief Virtual destructor - required for proper cleanup of derived classes
+    virtual ~IMessageHandler() = default;
+
+    /**
+     * @brief Called when a text protocol message is received.
+     * 
+     * This handles hello messages, acknowledgments, and other text-based protocol
+     * messages. The specific message type is indicated in msg.type.
+     * 
+     * @param msg The parsed protocol message containing type, ID, and content
+     * 
+     * @note This is called from the WebSocket thread, not your main application thread.
+     * @note Binary data transfers start with a BinaryStart text message, then OnBinaryStart
+     *       is called separately.
+     */
+    virtual void OnTextMessage(const Protocol::Message& msg) = 0;
+
+    /**
+     * @brief Called when a text protocol message is received, as a non-owning view (zero-allocation).
+     *
+     * Opt-in fast path: the message fields are std::string_views into the frame
+     * buffer, so a handler that processes messages inline avoids the per-message
+     * heap allocations that materializing a Protocol::Message costs.
+     *
+     * Return true to indicate the message was fully handled here - the router
+     * then skips materialization and none of the type-specific callbacks
+     * (OnTextMessage, OnBinaryStart, OnProtocolError) fire for it. Return false
+     * (the default) to fall back to the owning-Message dispatch path.
+     *
+     * @param msg The parsed message view; its string fields are only valid for
+     *            the duration of this call
+     * @return true if handled (no further dispatch), false for the default path
+     *
+     * @warning Do not store the view's string_views beyond this call; copy them
+     *          (or use Protocol::ToMessage) if the data must outlive the callback.
+     * @note Called from the WebSocket thread like all other callbacks.
+     */
+    virtual bool OnTextMessageView(const Protocol::MessageView& msg) { (void)msg; return false; }
+
+    /**
+     * @brief Called when a binary data transfer begins.
+     * 
+     * This message signals the start of a binary data transfer. The expected size
+     * is provided in msg.binarySize, allowing you to pre-allocate buffers or resources.
+     * 
+     * After this call, one or more OnBinaryChunk calls will follow with the actual data,
+     * and finally OnBinaryComplete will be called when all data is received.
+     * 
+     * @param msg The BinaryStart message containing size information
+     * 
+     * @note The binary size is provided as a hint; always be prepared for a call to
+     *       OnBinaryChunk with less or more data than expected (error tolerance).
+     */
+    virtual void OnBinaryStart(const Protocol::Message& msg) = 0;
+
+    /**
+     * @brief Called when a chunk of binary data is received.
+     * 
+     * Binary transfers may arrive in multiple chunks. This method is called for each
+     * chunk. You should accumulate or process the data as it arrives.
+     * 
+     * Multiple chunks may arrive before OnBinaryComplete is called.
+     * For example: OnBinaryStart -> OnBinaryChunk(64KB) -> OnBinaryChunk(64KB) 
+     *             -> OnBinaryChunk(remaining) -> OnBinaryComplete
+     * 
+     * @param data Pointer to the binary data chunk
+     * @param size Size of this chunk in bytes
+     * 
+     * @note Do not modify the data buffer; it may be freed immediately after this returns.
+     * @note Copy data if you need to store it beyond this function call.
+     */
+    virtual void OnBinaryChunk(const uint8_t* data, size_t size) = 0;
+
+    /**
+     * @brief Called when a chunk of binary data is received, with its stream id.
+     *
+     * Multi-stream variant of OnBinaryChunk. When several binary transfers are
+     * pipelined on one connection, the stream id (the msgId of the announcing
+     * BinaryStart message) identifies which transfer this chunk belongs to.
+     *
+     * @param streamId msgId of the BinaryStart message that opened this transfer
+     *                 (empty if the chunk arrived with no announced transfer)
+     * @param data Pointer to the binary data chunk
+     * @param size Size of this chunk in bytes
+     *
+     * @note Default implementation forwards to the single-stream OnBinaryChunk,
+     *       so handlers that don't pipeline transfers need not override this.
+     * @note Same lifetime rules as OnBinaryChunk: copy the data if you keep it.
+     */
+    virtual void OnBinaryChunk(const std::string& streamId, const uint8_t* data, size_t size)
+    {
+        (void)streamId;
+        OnBinaryChunk(data, size);
+    }
+
+    /**
+     * @brief Zero-copy chunk delivery with stream id (multi-stream variant).
+     *
+     * Combines the ownership-handoff semantics of OnBinaryChunkOwned with the
+     * stream identification of the multi-stream callbacks.
+     *
+     * @param streamId msgId of the BinaryStart message that opened this transfer
+     * @param data The frame buffer, moved in from the receive path
+     * @return true if ownership was taken, false to fall back to the copy-based path
+     *
+     * @note Default implementation forwards to the single-stream OnBinaryChunkOwned.
+     */
+    virtual bool OnBinaryChunkOwned(const std::string& streamId, std::string&& data)
+    {
+        (void)streamId;
+        return OnBinaryChunkOwned(std::move(data));
+    }
+
+    /**
+     * @brief Called when a chunk of binary data is received, offering buffer ownership (zero-copy).
+     *
+     * This is the zero-copy alternative to OnBinaryChunk. The frame buffer received
+     * from the WebSocket is moved into this call, so a handler that takes it avoids
+     * the copy that OnBinaryChunk would otherwise force (its buffer may be freed on
+     * return, so handlers must memcpy there).
+     *
+     * Return true to take ownership of the buffer: move it somewhere (e.g. into a
+     * queue or file-writer) and the data is yours with no further copies. Return
+     * false to decline, in which case the router falls back to the copy-based
+     * OnBinaryChunk with the same bytes.
+     *
+     * @param data The frame buffer, moved in from the receive path. Only consume it
+     *             (std::move it out) when returning true.
+     * @return true if ownership was taken (OnBinaryChunk will NOT be called for this
+     *         chunk), false to receive the chunk through OnBinaryChunk instead
+     *
+     * @note Default implementation returns false, preserving existing copy-based behavior.
+     * @note Called from the WebSocket thread like all other callbacks.
+     *
+     * @example
+     *   bool OnBinaryChunkOwned(std::string&& data) override {
+     *       mChunks.push_back(std::move(data));  // Zero-copy handoff
+     *       return true;
+     *   }
+     */
+    virtual bool OnBinaryChunkOwned(std::string&& data) { (void)data; return false; }
+
+    /**
+     * @brief Called when a complete binary transfer is finished.
+     * 
+     * All expected data for the current binary transfer has been received and passed
+     * to OnBinaryChunk calls. At this point, you can finalize processing, validate
+     * checksums, etc.
+     * 
+     * After this call, new text or binary messages may arrive.
+     */
+    virtual void OnBinaryComplete() = 0;
+
+    /**
+     * @brief Called when a specific binary stream finishes (multi-stream variant).
+     *
+     * @param streamId msgId of the BinaryStart message that opened this transfer
+     *
+     * @note Default implementation forwards to the parameterless OnBinaryComplete.
+     */
+    virtual void OnBinaryComplete(const std::string& streamId)
+    {
+        (void)streamId;
+        OnBinaryComplete();
+    }
+
+    /**
+     * @brief Called when a checksummed binary stream finishes.
+     *
+     * Used for transfers whose BinaryStart carried a crc32c field: the receive
+     * path verifies the payload incrementally as chunks arrive and reports the
+     * verdict here. A mismatch is also routed to OnProtocolError first.
+     *
+     * @param streamId msgId of the BinaryStart message that opened this transfer
+     * @param pChecksumValid true if the received bytes match the announced CRC-32C
+     *
+     * @note Default implementation ignores the verdict and forwards to
+     *       OnBinaryComplete(streamId).
+     */
+    virtual void OnBinaryComplete(const std::string& streamId, bool pChecksumValid)
+    {
+        (void)pChecksumValid;
+        OnBinaryComplete(streamId);
+    }
+
+    /**
+     * @brief Called when a protocol error occurs.
+     * 
+     * The server or protocol layer detected an error condition. The reason string
+     * provides details about what went wrong.
+     * 
+     * Common error reasons:
+     * - "Invalid message format" - JSON parsing failed
+     * - "Unsupported message type" - Unknown message type received
+     * - "Binary size exceeded" - Binary transfer exceeds max size limit
+     * 
+     * @param reason Human-readable error description
+     */
+    virtual void OnProtocolError(const std::string& reason) = 0;
+
+    /**
+     * @brief Called when a ping frame is received from the server.
+     * 
+     * Note: The WebSocket library automatically responds with a pong frame,
+     * so you don't need to do anything. This is just for informational purposes.
+     * 
+     * @param payload The ping payload data (may be empty)
+     * 
+     * @note Default implementation does nothing - override if you need ping notifications
+     */
+    virtual void OnPing(const std::string& payload) { (void)payload; }
+
+    /**
+     * @brief Called when a pong frame is received from the server.
+     * 
+     * This is typically in response to a ping sent by SendPing() or automatic heartbeat.
+     * You can use this to measure round-trip latency.
+     * 
+     * @param payload The pong payload data (echoes the ping payload)
+     * 
+     * @note Default implementation does nothing - override if you need pong notifications
+     */
+    virtual void OnPong(const std::string& payload) { (void)payload; }
+
+    /**
+     * @brief Called when the built-in reconnection engine re-establishes the connection.
+     *
+     * Fires after an unexpected disconnect was recovered automatically (see
+     * Protocol::Config::enableAutoReconnect). Use this to replay unacknowledged
+     * messages, re-send a Hello, or refresh application session state - the
+     * server may have lost everything it knew about this client.
+     *
+     * @param attempt Which reconnect attempt succeeded (1 = first retry)
+     *
+     * @note Not called for the initial Connect(), only for automatic recoveries.
+     * @note Default implementation does nothing - override if you need the notification
+     */
+    virtual void OnReconnected(int attempt) { (void)attempt; }
+
+    /**
+     * @brief Called when a tracked message is acknowledged by the server.
+     *
+     * Fires for messages sent through WsClient::SendTextWithAck when the
+     * matching Acknowledge arrives, retiring the entry from the send window.
+     *
+     * @param msgId msgId of the message that was acknowledged
+     *
+     * @note The Acknowledge message itself is still routed through
+     *       OnTextMessage as before - this is an additional notification.
+     * @note Default implementation does nothing - override to track completion
+     */
+    virtual void OnMessageAcked(const std::string& msgId) { (void)msgId; }
+
+    /**
+     * @brief Called when a tracked message is retransmitted after a timeout.
+     *
+     * The original payload has already been resent and the deadline rearmed.
+     *
+     * @param msgId msgId of the retransmitted message
+     * @param attempt Retransmit attempt number (1 = first resend)
+     *
+     * @note Default implementation does nothing - override for visibility
+     */
+    virtual void OnMessageRetransmit(const std::string& msgId, int attempt)
+    {
+        (void)msgId;
+        (void)attempt;
+    }
+
+    /**
+     * @brief Called when a tracked message exhausted its retransmit budget.
+     *
+     * The message has been dropped from the send window; the application
+     * decides whether to re-send, surface an error, or give up.
+     *
+     * @param msgId msgId of the message that was never acknowledged
+     *
+     * @note Default implementation does nothing - override to handle delivery failure
+     */
+    virtual void OnMessageTimeout(const std::string& msgId) { (void)msgId; }
+};
+
+/**
+ * @class MessageRouter
+ * @brief Routes parsed protocol messages to the application message handler.
+ * 
+ * This class acts as a bridge between the WebSocket client's low-level message
+ * handling and your application's business logic (IMessageHandler). It takes parsed
+ * Protocol::Message objects and routes them to the appropriate handler method based
+ * on message type.
+ * 
+ * Thread Safety:
+ * - SetMessageHandler() should only be called before connecting
+ * - All Route* methods are called from the WebSocket thread
+ * - Your IMessageHandler implementation must be thread-safe if accessed from other threads
+ * 
+ * @example
+ *   MessageRouter router;
+ *   MyHandler myHandler;
+ *   router.SetMessageHandler(&myHandler);
+ *   
+ *   // Router will now dispatch messages to myHandler
+ *   Protocol::Message msg = ...;
+ *   router.RouteMessage(msg);
+ */
+class MessageRouter
+{
+public:
+    /**
+     * @enum OverflowPolicy
+     * @brief What Route* calls do when the executor queue is full.
+     */
+    enum class OverflowPolicy
+    {
+        Block,      ///< Socket thread waits for space (preserves every message, re-introduces backpressure at the queue bound)
+        DropNewest  ///< The incoming event is discarded and counted (socket reads never stall)
+    };
+
+    /// @brief Construct an empty message router with no handler
+    MessageRouter();
+
+    /// @brief Destructor - stops the executor worker if one is running
+    ~MessageRouter();
+
+    /**
+     * @brief Set the handler to receive routed messages.
+     * 
+     * @param handler Pointer to IMessageHandler implementation, or nullptr to disable routing
+     * 
+     * @note Should be set before connecting to avoid missing messages
+     * @note Changing handlers while messages are being routed may cause messages to be ignored
+     */
+    void SetMessageHandler(IMessageHandler* handler);
+
+    /**
+     * @brief Route a parsed protocol message to the handler.
+     * 
+     * This examines the message type and calls the appropriate handler method.
+     * 
+     * @param msg The message to route (type determines which handler method is called)
+     * 
+     * @example
+     *   Protocol::Message msg(MessageType::Hello, "id1");
+     *   router.RouteMessage(msg);  // Calls handler->OnTextMessage(msg)
+     */
+    void RouteMessage(const Protocol::Message& msg);
+
+    /**
+     * @brief Route a parsed message view to the handler (zero-allocation fast path).
+     *
+     * Offers the view to the handler via OnTextMessageView first. If the handler
+     * consumes it (returns true), dispatch ends with zero allocations. Otherwise
+     * the view is materialized into an owning Protocol::Message and dispatched
+     * through RouteMessage exactly as before, so handlers that don't opt in see
+     * no behavioral change.
+     *
+     * @param msg The message view to route (fields point into the frame buffer)
+     *
+     * @see RouteMessage, IMessageHandler::OnTextMessageView
+     */
+    void RouteMessageView(const Protocol::MessageView& msg);
+
+    /**
+     * @brief Route a binary data chunk to the handler.
+     * 
+     * Passes binary data to the handler's OnBinaryChunk method. Call RouteMessage
+     * with a BinaryStart message first, then this one or more times, then RouteBinaryComplete.
+     * 
+     * @param data Pointer to binary data
+     * @param size Size of the data in bytes
+     * 
+     * @see RouteMessage, RouteBinaryComplete
+     */
+    void RouteBinaryData(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Route a binary data chunk to the handler with buffer ownership transfer (zero-copy).
+     *
+     * Offers the frame buffer to the handler via OnBinaryChunkOwned. If the handler
+     * takes ownership (returns true) no copy is made. If it declines (the default),
+     * this falls back to the copy-based OnBinaryChunk path so existing handlers keep
+     * working unchanged.
+     *
+     * @param data The frame buffer, moved in from the receive path
+     *
+     * @see RouteBinaryData for the copy-based equivalent
+     */
+    void RouteBinaryDataOwned(std::string&& data);
+
+    /**
+     * @brief Route an owned binary chunk to the handler with its stream id.
+     *
+     * Multi-stream variant of RouteBinaryDataOwned: identifies which pipelined
+     * transfer the chunk belongs to via the stream id from its BinaryStart
+     * message. Falls back to the copy-based stream-aware OnBinaryChunk if the
+     * handler declines ownership.
+     *
+     * @param streamId msgId of the transfer this chunk belongs to (may be empty)
+     * @param data The frame buffer, moved in from the receive path
+     */
+    void RouteBinaryDataOwned(const std::string& streamId, std::string&& data);
+
+    /**
+     * @brief Signal that binary transfer is complete.
+     * 
+     * Call this after the final OnBinaryChunk to signal completion. The handler's
+     * OnBinaryComplete method will be called.
+     * 
+     * @see RouteMessage, RouteBinaryData
+     */
+    void RouteBinaryComplete();
+
+    /**
+     * @brief Signal that a specific binary stream is complete (multi-stream variant).
+     *
+     * @param streamId msgId of the transfer that finished
+     *
+     * @see RouteBinaryComplete
+     */
+    void RouteBinaryComplete(const std::string& streamId);
+
+    /**
+     * @brief Signal that a checksummed binary stream is complete.
+     *
+     * Routes a protocol error first when the checksum did not match, then the
+     * completion with the verdict attached.
+     *
+     * @param streamId msgId of the transfer that finished
+     * @param pChecksumValid whether the payload matched the announced CRC-32C
+     *
+     * @see RouteBinaryComplete
+     */
+    void RouteBinaryComplete(const std::string& streamId, bool pChecksumValid);
+    
+    /**
+     * @brief Route a protocol error directly to the handler.
+     * 
+     * Used by WsClient to report protocol-level errors (overflow, invalid sizes, etc.)
+     * to the application handler.
+     * 
+     * @param errorMsg Human-readable error description
+     */
+    void RouteProtocolError(const std::string& errorMsg);
+
+    /**
+     * @brief Route a ping notification to the handler.
+     * 
+     * Called when a ping frame is received from the server.
+     * 
+     * @param payload The ping payload data
+     */
+    void RoutePing(const std::string& payload);
+
+    /**
+     * @brief Route a pong notification to the handler.
+     * 
+     * Called when a pong frame is received from the server.
+     * 
+     * @param payload The pong payload data
+     */
+    void RoutePong(const std::string& payload);
+
+    /**
+     * @brief Route a reconnection notification to the handler.
+     *
+     * Called by the reconnection engine after an unexpected disconnect was
+     * recovered automatically.
+     *
+     * @param attempt Which reconnect attempt succeeded (1 = first retry)
+     *
+     * @note Dispatched inline even in executor mode - connection lifecycle
+     *       events are rare and must not queue behind a message backlog
+     */
+    void RouteReconnected(int attempt);
+
+    /**
+     * @brief Route an ack-window notification to the handler.
+     *
+     * @param msgId msgId of the acknowledged message
+     *
+     * @note Dispatched inline even in executor mode, like other lifecycle events
+     */
+    void RouteMessageAcked(const std::string& msgId);
+
+    /**
+     * @brief Route a retransmit notification to the handler.
+     *
+     * @param msgId msgId of the retransmitted message
+     * @param attempt Retransmit attempt number (1 = first resend)
+     */
+    void RouteMessageRetransmit(const std::string& msgId, int attempt);
+
+    /**
+     * @brief Route a delivery-failure notification to the handler.
+     *
+     * @param msgId msgId of the message that exhausted its retransmit budget
+     */
+    void RouteMessageTimeout(const std::string& msgId);
+
+    /**
+     * @brief Switch the router into executor mode (handler runs off the socket thread).
+     *
+     * By default every Route* call invokes the handler inline on the WebSocket
+     * thread, so a slow handler (database write, disk I/O) stalls frame
+     * reception and TCP backpressure builds up. In executor mode, routed
+     * events are instead moved into a bounded queue and dispatched on a
+     * dedicated worker thread: the socket thread only pays a queue push per
+     * message and keeps reading at line rate regardless of handler cost.
+     *
+     * Events are dispatched strictly in arrival order (single worker per
+     * router, i.e. per connection), so the ordering guarantees of inline
+     * dispatch are preserved.
+     *
+     * @param queueDepth Maximum queued events before the overflow policy kicks
+     *                   in (default 1024)
+     * @param policy What to do when the queue is full: Block the socket thread
+     *               until the worker catches up (default - lossless), or
+     *               DropNewest to discard and count the incoming event
+     *
+     * @note Call before connecting; enabling mid-stream is not synchronized
+     *       against in-flight Route* calls.
+     * @note In executor mode the zero-allocation view path (OnTextMessageView)
+     *       and the borrowed-pointer chunk path are not available - events
+     *       must own their data to cross threads, so views are materialized
+     *       and borrowed chunks copied at enqueue time.
+     */
+    void EnableExecutor(size_t queueDepth = 1024,
+                        OverflowPolicy policy = OverflowPolicy::Block);
+
+    /**
+     * @brief Return to inline dispatch, draining queued events first.
+     *
+     * Blocks until the worker has dispatched everything already queued, then
+     * joins it. Safe to call when the executor is not running (no-op).
+     */
+    void DisableExecutor();
+
+    /// @brief Check whether executor mode is active
+    bool IsExecutorEnabled() const { return mExecutorEnabled.load(std::memory_order_acquire); }
+
+    /// @brief Get the number of events discarded by the DropNewest overflow policy
+    uint64_t GetExecutorDroppedCount() const { return mDroppedEvents.load(std::memory_order_relaxed); }
+
+    /// @brief Get the number of protocol errors routed through RouteProtocolError
+    uint64_t GetProtocolErrorCount() const { return mProtocolErrors.load(std::memory_order_relaxed); }
+
+private:
+    /// @brief Pointer to the application's message handler (may be null)
+    /// @note Access is NOT synchronized - caller must ensure SetMessageHandler
+    ///       is only called before message routing begins (during setup phase)
+    IMessageHandler* mHandler = nullptr;
+
+    /**
+     * @struct DispatchEvent
+     * @brief One queued unit of handler work in executor mode.
+     *
+     * Owns all of its data (no views, no borrowed pointers) so it can be
+     * moved across threads safely.
+     */
+    struct DispatchEvent
+    {
+        /// @brief Which handler callback this event maps to
+        enum class Kind
+        {
+            Text,            ///< Parsed protocol message (msg)
+            BinaryChunk,     ///< Binary payload (streamId + data)
+            BinaryComplete,  ///< End of a binary transfer (streamId, may be empty)
+            ProtocolError,   ///< Protocol error (data = reason)
+            Ping,            ///< Ping notification (data = payload)
+            Pong             ///< Pong notification (data = payload)
+        };
+
+        Kind kind = Kind::Text;
+        Protocol::Message msg;  ///< Payload for Text events
+        std::string streamId;   ///< Stream id for binary events (empty = legacy single-stream)
+        std::string data;       ///< Chunk bytes / error reason / ping-pong payload
+        bool hasChecksum = false;   ///< BinaryComplete: transfer carried a crc32c
+        bool checksumValid = false; ///< BinaryComplete: verdict when hasChecksum
+    };
+
+    /// @brief Dispatch a parsed message to the handler (the type switch)
+    void DispatchMessage(const Protocol::Message& msg);
+
+    /// @brief Dispatch an owned binary chunk (zero-copy offer, copy fallback)
+    void DispatchBinaryChunk(const std::string& streamId, std::string&& data);
+
+    /// @brief Dispatch one queued event to the handler (worker thread)
+    void DispatchEventNow(DispatchEvent&& event);
+
+    /// @brief Move an event into the executor queue, honoring the overflow policy.
+    /// @return true if queued (or dropped per policy); false if the executor shut
+    ///         down mid-call and the event should be dispatched inline instead
+    bool EnqueueEvent(DispatchEvent&& event);
+
+    /// @brief Worker thread body - pops and dispatches events until drained + disabled
+    void ExecutorLoop();
+
+    /// @brief Bounded event queue (protected by mQueueMutex)
+    std::deque<DispatchEvent> mQueue;
+
+    /// @brief Mutex protecting the executor queue
+    std::mutex mQueueMutex;
+
+    /// @brief Signaled when the queue gains an event (worker waits on this)
+    std::condition_variable mQueueNotEmpty;
+
+    /// @brief Signaled when the queue loses an event (Block-policy producers wait on this)
+    std::condition_variable mQueueNotFull;
+
+    /// @brief Maximum number of queued events before the overflow policy applies
+    size_t mQueueDepth = 1024;
+
+    /// @brief Active overflow policy
+    OverflowPolicy mOverflowPolicy = OverflowPolicy::Block;
+
+    /// @brief Whether executor mode is active (checked lock-free on every Route* call)
+    std::atomic<bool> mExecutorEnabled{false};
+
+    /// @brief Events discarded under the DropNewest policy
+    std::atomic<uint64_t> mDroppedEvents{0};
+
+    /// @brief Protocol errors routed through RouteProtocolError (stats surface)
+    std::atomic<uint64_t> mProtocolErrors{0};
+
+    /// @brief Dedicated dispatch worker (one per router = ordered per connection)
+    std::thread mWorker;
+};
+
+/**
+ * @namespace RouterDetail
+ * @brief Detection traits for the optional fast-path methods a static handler may provide.
+ *
+ * MessageRouterT accepts any handler type with the core callback set
+ * (OnTextMessage, OnBinaryStart, OnBinaryChunk, OnBinaryComplete,
+ * OnProtocolError, OnPing, OnPong) - it does not have to derive from
+ * IMessageHandler. These traits let the router use the opt-in zero-copy /
+ * zero-allocation callbacks when the handler defines them and compile them
+ * out entirely when it does not.
+ */
+namespace RouterDetail
+{
+    template <typename T, typename = void>
+    struct HasTextMessageView : std::false_type {};
+
+    template <typename T>
+    struct HasTextMessageView<T, std::void_t<decltype(
+        std::declval<T&>().OnTextMessageView(std::declval<const Protocol::MessageView&>()))>>
+        : std::true_type {};
+
+    template <typename T, typename = void>
+    struct HasChunkOwnedStream : std::false_type {};
+
+    template <typename T>
+    struct HasChunkOwnedStream<T, std::void_t<decltype(
+        std::declval<T&>().OnBinaryChunkOwned(std::declval<const std::string&>(),
+                                              std::declval<std::string&&>()))>>
+        : std::true_type {};
+
+    template <typename T, typename = void>
+    struct HasChunkStream : std::false_type {};
+
+    template <typename T>
+    struct HasChunkStream<T, std::void_t<decltype(
+        std::declval<T&>().OnBinaryChunk(std::declval<const std::string&>(),
+                                         std::declval<const uint8_t*>(),
+                                         std::declval<size_t>()))>>
+        : std::true_type {};
+
+    template <typename T, typename = void>
+    struct HasCompleteStream : std::false_type {};
+
+    template <typename T>
+    struct HasCompleteStream<T, std::void_t<decltype(
+        std::declval<T&>().OnBinaryComplete(std::declval<const std::string&>()))>>
+        : std::true_type {};
+}
+
+/**
+ * @class MessageRouterT
+ * @brief Compile-time statically-dispatched alternative to MessageRouter.
+ *
+ * MessageRouter calls the handler through the virtual IMessageHandler
+ * interface, so every received message pays an indirect call the compiler
+ * cannot inline or devirtualize - this sits on the hottest path in the
+ * program. MessageRouterT instead takes the handler type as a template
+ * parameter and calls its methods directly, so in release builds the type
+ * switch and the handler body inline into one flat dispatch routine.
+ *
+ * The handler does NOT need to derive from IMessageHandler - any type with
+ * the core callback set works, and the optional fast-path callbacks
+ * (OnTextMessageView, stream-aware OnBinaryChunk/OnBinaryChunkOwned/
+ * OnBinaryComplete) are detected at compile time and compiled out when
+ * absent. For full inlining, prefer a plain (non-virtual) handler type, or
+ * mark the overrides final so the compiler can devirtualize.
+ *
+ * The virtual MessageRouter remains the dynamic option (runtime handler
+ * swapping, executor mode); this template is for call sites that know the
+ * handler type at compile time and want zero dispatch overhead.
+ *
+ * @tparam Handler The concrete handler type (held by reference, not owned)
+ *
+ * @note Header-only by design - the template must be visible at the call
+ *       site for inlining to happen.
+ * @note Per-message Debug logging is intentionally omitted on the hot paths;
+ *       only anomalies (invalid types) are logged.
+ *
+ * @example
+ *   struct FastHandler {  // Plain struct - no virtuals anywhere
+ *       void OnTextMessage(const Protocol::Message& msg) { ... }
+ *       void OnBinaryStart(const Protocol::Message& msg) { ... }
+ *       void OnBinaryChunk(const uint8_t* data, size_t size) { ... }
+ *       void OnBinaryComplete() { ... }
+ *       void OnProtocolError(const std::string& reason) { ... }
+ *       void OnPing(const std::string&) {}
+ *       void OnPong(const std::string&) {}
+ *   };
+ *   FastHandler handler;
+ *   MessageRouterT<FastHandler> router(handler);
+ *   router.RouteMessageView(Protocol::ParseJsonMessageView(frame));
+ */
+template <typename Handler>
+class MessageRouterT
+{
+public:
+    /**
+     * @brief Bind the router to a handler instance.
+     *
+     * @param handler The handler to dispatch to; must outlive the router
+     */
+    explicit MessageRouterT(Handler& handler)
+        : mHandler(handler)
+    {
+    }
+
+    /**
+     * @brief Route a parsed protocol message to the handler (static dispatch).
+     *
+     * Same type switch as MessageRouter::RouteMessage, but every call resolves
+     * at compile time.
+     *
+     * @param msg The message to route
+     */
+    void RouteMessage(const Protocol::Message& msg)
+    {
+        switch (msg.type)
+        {
+        case Protocol::MessageType::Hello:
+        case Protocol::MessageType::Acknowledge:
+            mHandler.OnTextMessage(msg);
+            break;
+
+        case Protocol::MessageType::BinaryStart:
+            mHandler.OnBinaryStart(msg);
+            break;
+
+        case Protocol::MessageType::Error:
+            mHandler.OnProtocolError(msg.content);
+            break;
+
+        case Protocol::MessageType::Unknown:
+        case Protocol::MessageType::BinaryData:  // Should not arrive as text
+        default:
+            {
+                std::string errorMsg = "Unhandled or invalid message type: " +
+                                       std::to_string(static_cast<int>(msg.type)) +
+                                       " (msgId: " + msg.msgId + ")";
+                mHandler.OnProtocolError(errorMsg);
+            }
+            break;
+        }
+    }
+
+    /**
+     * @brief Route a parsed message view (zero-allocation when the handler opts in).
+     *
+     * If the handler defines OnTextMessageView the offer compiles to a direct
+     * call; if not, the offer does not exist in the generated code at all.
+     *
+     * @param msg The message view to route
+     */
+    void RouteMessageView(const Protocol::MessageView& msg)
+    {
+        if constexpr (RouterDetail::HasTextMessageView<Handler>::value)
+        {
+            if (mHandler.OnTextMessageView(msg))
+                return;
+        }
+        RouteMessage(Protocol::ToMessage(msg));
+    }
+
+    /**
+     * @brief Route a binary data chunk (static dispatch).
+     *
+     * @param data Pointer to binary data
+     * @param size Size of the data in bytes
+     */
+    void RouteBinaryData(const uint8_t* data, size_t size)
+    {
+        if (!data || size == 0)
+            return;
+        mHandler.OnBinaryChunk(data, size);
+    }
+
+    /**
+     * @brief Route an owned binary chunk with its stream id (static dispatch).
+     *
+     * Uses whichever of the zero-copy / stream-aware / legacy chunk callbacks
+     * the handler provides, selected at compile time.
+     *
+     * @param streamId msgId of the transfer this chunk belongs to (may be empty)
+     * @param data The frame buffer, moved in from the receive path
+     */
+    void RouteBinaryDataOwned(const std::string& streamId, std::string&& data)
+    {
+        if (data.empty())
+            return;
+
+        if constexpr (RouterDetail::HasChunkOwnedStream<Handler>::value)
+        {
+            if (mHandler.OnBinaryChunkOwned(streamId, std::move(data)))
+                return;  // Handler took the buffer - no copy needed
+        }
+
+        if constexpr (RouterDetail::HasChunkStream<Handler>::value)
+        {
+            mHandler.OnBinaryChunk(streamId,
+                reinterpret_cast<const uint8_t*>(data.data()), data.size());
+        }
+        else
+        {
+            mHandler.OnBinaryChunk(
+                reinterpret_cast<const uint8_t*>(data.data()), data.size());
+        }
+    }
+
+    /**
+     * @brief Signal that a binary stream is complete (static dispatch).
+     *
+     * @param streamId msgId of the transfer that finished (empty = legacy form)
+     */
+    void RouteBinaryComplete(const std::string& streamId = std::string())
+    {
+        if constexpr (RouterDetail::HasCompleteStream<Handler>::value)
+        {
+            if (!streamId.empty())
+            {
+                mHandler.OnBinaryComplete(streamId);
+                return;
+            }
+        }
+        mHandler.OnBinaryComplete();
+    }
+
+    /**
+     * @brief Route a protocol error to the handler (static dispatch).
+     *
+     * @param errorMsg Human-readable error description
+     */
+    void RouteProtocolError(const std::string& errorMsg)
+    {
+        mHandler.OnProtocolError(errorMsg);
+    }
+
+    /**
+     * @brief Route a ping notification to the handler (static dispatch).
+     *
+     * @param payload The ping payload data
+     */
+    void RoutePing(const std::string& payload)
+    {
+        mHandler.OnPing(payload);
+    }
+
+    /**
+     * @brief Route a pong notification to the handler (static dispatch).
+     *
+     * @param payload The pong payload data
+     */
+    void RoutePong(const std::string& payload)
+    {
+        mHandler.OnPong(payload);
+    }
+
+private:
+    /// @brief The bound handler (reference - the caller owns the instance)
+    Handler& mHandler;
+};
@@ -1,181 +1,663 @@
-// CodeRabbit: Please review this file thoroughly for production readiness
-#include "Protocol.hpp"
-#include "Logger.hpp"
-
-/**
- * @file Protocol.cpp
- * @brief Implementation of protocol parsing and serialization for TallyIX WebSocket.
- * 
- * This file contains the core logic for converting between wire format (JSON)
- * and the typed Protocol::Message structure. It uses simple string manipulation
- * to avoid external dependencies while maintaining clarity and robustness.
- */
-
-// Protocol namespace implementation
-namespace Protocol
-{
-    /**
-     * @brief Helper function to extract a value from JSON by key.
-     * 
-     * This function searches for a key in JSON format and extracts its value.
-     * It handles both string values (quoted) and numeric values (unquoted).
-     * 
-     * @param json The JSON string to search in
-     * @param key The key to find (without quotes)
-     * @return The extracted value as a string, or empty string if not found
-     * 
-     * @note This is a simple implementation that works for basic JSON without
-     *       nested objects or special character escaping. For more complex JSON,
-     *       consider using a proper JSON library like nlohmann/json.
-     */
-    std::string GetJsonValue(const std::string& json, const std::string& key)
-    {
-        // Build the search pattern: "key":
-        std::string searchKey = "\"" + key + "\":";
-        size_t pos = json.find(searchKey);
-        
-        // Key not found in JSON
-        if (pos == std::string::npos)
-            return "";
-
-        // Move position past the key pattern
-        pos += searchKey.length();
-
-        // Skip any whitespace after the colon
-        while (pos < json.length() && (json[pos] == ' ' || json[pos] == '\t'))
-            pos++;
-
-        // Handle string values (enclosed in quotes)
-        if (pos < json.length() && json[pos] == '"')
-        {
-            pos++;  // Skip opening quote
-            size_t end = json.find('"', pos);
-            if (end != std::string::npos)
-                return json.substr(pos, end - pos);
-        }
-        // Handle numeric values (not quoted)
-        else
-        {
-            size_t end = pos;
-            // Continue until we hit a comma or closing brace
-            while (end < json.length() && json[end] != ',' && json[end] != '}')
-                end++;
-            return json.substr(pos, end - pos);
-        }
-
-        return "";
-    }
-
-    std::string MessageTypeToString(MessageType type)
-    {
-        switch (type)
-        {
-        case MessageType::Hello:       return "Hello";
-        case MessageType::BinaryStart: return "BinaryStart";
-        case MessageType::BinaryData:  return "BinaryData";
-        case MessageType::Acknowledge: return "Acknowledge";
-        case MessageType::Error:       return "Error";
-        case MessageType::Unknown:
-        default:                       return "Unknown";
-        }
-    }
-
-    bool IsValidMessage(const Message& msg)
-    {
-        // A valid message must have a known type and a message ID
-        return msg.type != MessageType::Unknown && !msg.msgId.empty();
-    }
-
-    Message ParseJsonMessage(const std::string& json)
-    {
-        Message msg;
-        
-        // Extract type string from JSON
-        std::string typeStr = GetJsonValue(json, "type");
-
-        // Convert type string to MessageType enum
-        if (typeStr == "hello")
-            msg.type = MessageType::Hello;
-        else if (typeStr == "binary_start")
-            msg.type = MessageType::BinaryStart;
-        else if (typeStr == "binary_data")
-            msg.type = MessageType::BinaryData;
-        else if (typeStr == "ack")
-            msg.type = MessageType::Acknowledge;
-        else if (typeStr == "error")
-            msg.type = MessageType::Error;
-        else
-        {
-            msg.type = MessageType::Unknown;
-            Logger::Instance().Warning("Protocol", 
-                "Unknown message type: " + typeStr);
-        }
-
-        // Extract message ID
-        msg.msgId = GetJsonValue(json, "msg_id");
-        
-        // Extract message content
-        msg.content = GetJsonValue(json, "content");
-
-        // Extract binary size (for BinaryStart messages)
-        std::string sizeStr = GetJsonValue(json, "size");
-        if (!sizeStr.empty())
-        {
-            try
-            {
-                // Convert string to size_t (unsigned long long)
-                msg.binarySize = std::stoul(sizeStr);
-            }
-            catch (const std::exception& e)
-            {
-                // Handle conversion failure (non-numeric value)
-                Logger::Instance().Warning("Protocol", 
-                    std::string("Failed to parse binary size: ") + e.what());
-                msg.binarySize = 0;
-            }
-        }
-
-        return msg;
-    }
-
-    std::string SerializeJsonMessage(const Message& msg)
-    {
-        // Convert MessageType enum to string representation
-        std::string typeStr;
-        switch (msg.type)
-        {
-        case MessageType::Hello:
-            typeStr = "hello";
-            break;
-        case MessageType::BinaryStart:
-            typeStr = "binary_start";
-            break;
-        case MessageType::BinaryData:
-            typeStr = "binary_data";
-            break;
-        case MessageType::Acknowledge:
-            typeStr = "ack";
-            break;
-        case MessageType::Error:
-            typeStr = "error";
-            break;
-        default:
-            typeStr = "unknown";
-        }
-
-        // Build JSON string with required fields
-        std::string json = "{\"type\":\"" + typeStr + "\",\"msg_id\":\"" + msg.msgId + "\"";
-
-        // Add optional content field if present
-        if (!msg.content.empty())
-            json += ",\"content\":\"" + msg.content + "\"";
-
-        // Add binary size field if it's a BinaryStart message
-        if (msg.binarySize > 0)
-            json += ",\"size\":" + std::to_string(msg.binarySize);
-
-        // Close the JSON object
-        json += "}";
-        return json;
-    }
-}
+// CodeRabbit: Please review this file thoroughly for production readiness
+#include "Protocol.hpp"
+#include "Logger.hpp"
+
+#include <string_view>
+#include <charconv>
+
+/**
+ * @file Protocol.cpp
+ * @brief Implementation of protocol parsing and serialization for TallyIX WebSocket.
+ * 
+ * This file contains the core logic for converting between wire format (JSON)
+ * and the typed Protocol::Message structure. It uses simple string manipulation
+ * to avoid external dependencies while maintaining clarity and robustness.
+ */
+
+// Protocol namespace implementation
+namespace Protocol
+{
+    namespace
+    {
+        /**
+         * @struct JsonFieldIndex
+         * @brief Offsets of the known protocol fields inside one JSON message.
+         *
+         * Filled by IndexJsonFields in a single pass over the input. Each field
+         * is a std::string_view into the original JSON string (no substr
+         * allocations); an empty view means the field was absent.
+         *
+         * @warning The views are only valid while the original JSON string is alive.
+         */
+        struct JsonFieldIndex
+        {
+            std::string_view type;     ///< Value of "type" (e.g. "hello")
+            std::string_view msgId;    ///< Value of "msg_id"
+            std::string_view content;  ///< Value of "content"
+            std::string_view size;     ///< Value of "size" (unparsed digits)
+            std::string_view crc;      ///< Value of "crc32c" (unparsed digits)
+        };
+
+        /**
+         * @brief Single-pass tokenizer over a protocol JSON message.
+         *
+         * Walks the input exactly once, recording where each known field's value
+         * lives. This replaces the previous approach of one full json.find()
+         * scan per field (four O(n) passes plus a substr allocation each), which
+         * showed up at the top of profiles at high message rates.
+         *
+         * Handles the same subset of JSON as the rest of this file: a flat
+         * object with quoted string values and unquoted numeric values, no
+         * nested objects and no escaped quotes.
+         *
+         * @param json The JSON message to index
+         * @return Field index with views into the input (empty views for absent fields)
+         */
+        JsonFieldIndex IndexJsonFields(std::string_view json)
+        {
+            JsonFieldIndex idx;
+            size_t pos = 0;
+            const size_t n = json.size();
+
+            while (pos < n)
+            {
+                // Find the opening quote of the next key
+                while (pos < n && json[pos] != '"')
+                    ++pos;
+                if (pos >= n)
+                    break;
+
+                // Read the key up to its closing quote
+                const size_t keyStart = ++pos;
+                while (pos < n && json[pos] != '"')
+                    ++pos;
+                if (pos >= n)
+                    break;
+                const std::string_view key = json.substr(keyStart, pos - keyStart);
+                ++pos;  // Skip closing quote
+
+                // Skip whitespace and the colon separating key from value
+                while (pos < n && (json[pos] == ' ' || json[pos] == '\t' || json[pos] == ':'))
+                    ++pos;
+
+                std::string_view value;
+                if (pos < n && json[pos] == '"')
+                {
+                    // String value (enclosed in quotes)
+                    const size_t valueStart = ++pos;
+                    while (pos < n && json[pos] != '"')
+                        ++pos;
+                    value = json.substr(valueStart, pos - valueStart);
+                    if (pos < n)
+                        ++pos;  // Skip closing quote
+                }
+                else
+                {
+                    // Numeric value - continue until comma or closing brace
+                    const size_t valueStart = pos;
+                    while (pos < n && json[pos] != ',' && json[pos] != '}')
+                        ++pos;
+                    value = json.substr(valueStart, pos - valueStart);
+
+                    // Trim trailing whitespace from the unquoted value
+                    while (!value.empty() &&
+                           (value.back() == ' ' || value.back() == '\t'))
+                        value.remove_suffix(1);
+                }
+
+                // Record the fields the protocol knows about; anything else is
+                // skipped without cost (forward compatibility)
+                if (key == "type")
+                    idx.type = value;
+                else if (key == "msg_id")
+                    idx.msgId = value;
+                else if (key == "content")
+                    idx.content = value;
+                else if (key == "size")
+                    idx.size = value;
+                else if (key == "crc32c")
+                    idx.crc = value;
+            }
+
+            return idx;
+        }
+
+        /**
+         * @brief Convert a wire-format type token to the MessageType enum.
+         *
+         * @param typeStr The value of the "type" field (e.g. "hello")
+         * @return Corresponding enum value, or Unknown if unrecognized
+         */
+        MessageType TypeFromWireString(std::string_view typeStr)
+        {
+            if (typeStr == "hello")
+                return MessageType::Hello;
+            if (typeStr == "binary_start")
+                return MessageType::BinaryStart;
+            if (typeStr == "binary_data")
+                return MessageType::BinaryData;
+            if (typeStr == "ack")
+                return MessageType::Acknowledge;
+            if (typeStr == "error")
+                return MessageType::Error;
+            return MessageType::Unknown;
+        }
+    }
+
+    std::string MessageTypeToString(MessageType type)
+    {
+        switch (type)
+        {
+        case MessageType::Hello:       return "Hello";
+        case MessageType::BinaryStart: return "BinaryStart";
+        case MessageType::BinaryData:  return "BinaryData";
+        case MessageType::Acknowledge: return "Acknowledge";
+        case MessageType::Error:       return "Error";
+        case MessageType::Unknown:
+        default:                       return "Unknown";
+        }
+    }
+
+    bool IsValidMessage(const Message& msg)
+    {
+        // A valid message must have a known type and a message ID
+        return msg.type != MessageType::Unknown && !msg.msgId.empty();
+    }
+
+    bool IsValidMessage(const MessageView& msg)
+    {
+        // Same rules as the owning overload
+        return msg.type != MessageType::Unknown && !msg.msgId.empty();
+    }
+
+    MessageView ParseJsonMessageView(std::string_view json)
+    {
+        MessageView msg;
+
+        // Index all fields in a single pass over the message; the views in the
+        // index (and therefore in the returned MessageView) point straight into
+        // the caller's buffer, so nothing is allocated here
+        const JsonFieldIndex idx = IndexJsonFields(json);
+
+        // Convert type token to MessageType enum
+        msg.type = TypeFromWireString(idx.type);
+        if (msg.type == MessageType::Unknown)
+        {
+            Logger::Instance().Warning("Protocol",
+                "Unknown message type: " + std::string(idx.type));
+        }
+
+        // String fields stay as views into the frame buffer
+        msg.msgId = idx.msgId;
+        msg.content = idx.content;
+
+        // Extract binary size (for BinaryStart messages) directly from the
+        // digit span - no intermediate substr string needed
+        if (!idx.size.empty())
+        {
+            const char* first = idx.size.data();
+            const char* last = first + idx.size.size();
+            const auto result = std::from_chars(first, last, msg.binarySize);
+            if (result.ec != std::errc())
+            {
+                // Handle conversion failure (non-numeric value)
+                Logger::Instance().Warning("Protocol",
+                    "Failed to parse binary size: " + std::string(idx.size));
+                msg.binarySize = 0;
+            }
+        }
+
+        // Extract the optional payload checksum (BinaryStart messages with
+        // integrity checking) the same zero-allocation way
+        if (!idx.crc.empty())
+        {
+            const char* first = idx.crc.data();
+            const char* last = first + idx.crc.size();
+            const auto result = std::from_chars(first, last, msg.crc32c);
+            if (result.ec == std::errc())
+            {
+                msg.hasCrc32c = true;
+            }
+            else
+            {
+                Logger::Instance().Warning("Protocol",
+                    "Failed to parse crc32c: " + std::string(idx.crc));
+                msg.crc32c = 0;
+            }
+        }
+
+        return msg;
+    }
+
+    Message ToMessage(const MessageView& view)
+    {
+        // Copy the viewed fields into an owning Message
+        Message msg;
+        msg.type = view.type;
+        msg.msgId = std::string(view.msgId);
+        msg.content = std::string(view.content);
+        msg.binarySize = view.binarySize;
+        msg.crc32c = view.crc32c;
+        msg.hasCrc32c = view.hasCrc32c;
+        return msg;
+    }
+
+    Message ParseJsonMessage(const std::string& json)
+    {
+        // Thin wrapper over the zero-allocation view parser: parse into views,
+        // then materialize owning strings for callers that need them
+        return ToMessage(ParseJsonMessageView(json));
+    }
+
+    void SerializeJsonMessage(const Message& msg, std::string& out)
+    {
+        // Convert MessageType enum to its wire token
+        std::string_view typeStr;
+        switch (msg.type)
+        {
+        case MessageType::Hello:
+            typeStr = "hello";
+            break;
+        case MessageType::BinaryStart:
+            typeStr = "binary_start";
+            break;
+        case MessageType::BinaryData:
+            typeStr = "binary_data";
+            break;
+        case MessageType::Acknowledge:
+            typeStr = "ack";
+            break;
+        case MessageType::Error:
+            typeStr = "error";
+            break;
+        default:
+            typeStr = "unknown";
+        }
+
+        // Render the binary size into a stack buffer up front so its digit
+        // count participates in the exact-size computation below
+        char sizeDigits[24];
+        size_t sizeDigitCount = 0;
+        if (msg.binarySize > 0)
+        {
+            const auto result = std::to_chars(
+                sizeDigits, sizeDigits + sizeof(sizeDigits), msg.binarySize);
+            sizeDigitCount = static_cast<size_t>(result.ptr - sizeDigits);
+        }
+
+        // Same treatment for the optional payload checksum
+        char crcDigits[12];
+        size_t crcDigitCount = 0;
+        if (msg.hasCrc32c)
+        {
+            const auto result = std::to_chars(
+                crcDigits, crcDigits + sizeof(crcDigits), msg.crc32c);
+            crcDigitCount = static_cast<size_t>(result.ptr - crcDigits);
+        }
+
+        // Compute the exact serialized length:
+        //   {"type":"T","msg_id":"I"[,"content":"C"][,"size":N]}
+        size_t total = 9 + typeStr.size()       // {"type":"T
+                     + 12 + msg.msgId.size()    // ","msg_id":"I
+                     + 1                        // closing quote of msg_id
+                     + 1;                       // }
+        if (!msg.content.empty())
+            total += 12 + msg.content.size() + 1;  // ,"content":"C"
+        if (sizeDigitCount > 0)
+            total += 8 + sizeDigitCount;           // ,"size":N
+        if (crcDigitCount > 0)
+            total += 10 + crcDigitCount;           // ,"crc32c":N
+
+        out.clear();
+
+        // Fast path: the common control-message shape (no content) is small
+        // enough to assemble on the stack and hand to the buffer in one append
+        char stack[128];
+        if (msg.content.empty() && total <= sizeof(stack))
+        {
+            char* p = stack;
+            auto put = [&p](std::string_view piece)
+            {
+                std::char_traits<char>::copy(p, piece.data(), piece.size());
+                p += piece.size();
+            };
+
+            put("{\"type\":\"");
+            put(typeStr);
+            put("\",\"msg_id\":\"");
+            put(msg.msgId);
+            put("\"");
+            if (sizeDigitCount > 0)
+            {
+                put(",\"size\":");
+                put(std::string_view(sizeDigits, sizeDigitCount));
+            }
+            if (crcDigitCount > 0)
+            {
+                put(",\"crc32c\":");
+                put(std::string_view(crcDigits, crcDigitCount));
+            }
+            put("}");
+
+            out.append(stack, static_cast<size_t>(p - stack));
+            return;
+        }
+
+        // General path: reserve the exact size once, then append each piece.
+        // A reused buffer keeps its capacity across calls, so steady-state
+        // serialization performs no allocations and no reallocation churn.
+        out.reserve(total);
+
+        out.append("{\"type\":\"");
+        out.append(typeStr);
+        out.append("\",\"msg_id\":\"");
+        out.append(msg.msgId);
+        out.append("\"");
+
+        // Add optional content field if present
+        if (!msg.content.empty())
+        {
+            out.append(",\"content\":\"");
+            out.append(msg.content);
+            out.append("\"");
+        }
+
+        // Add binary size field if it's a BinaryStart message
+        if (sizeDigitCount > 0)
+        {
+            out.append(",\"size\":");
+            out.append(sizeDigits, sizeDigitCount);
+        }
+
+        // Add the payload checksum if integrity checking is in use
+        if (crcDigitCount > 0)
+        {
+            out.append(",\"crc32c\":");
+            out.append(crcDigits, crcDigitCount);
+        }
+
+        // Close the JSON object
+        out.append("}");
+    }
+
+    std::string SerializeJsonMessage(const Message& msg)
+    {
+        // Thin wrapper for callers that don't manage a reusable buffer; the
+        // buffer-writer overload computes the exact size, so this still does
+        // exactly one allocation per message
+        std::string json;
+        SerializeJsonMessage(msg, json);
+        return json;
+    }
+
+    namespace
+    {
+        /// Leading bytes of every binary-encoded control frame (0xF5 never
+        /// occurs in valid UTF-8, keeping accidental matches in raw chunks rare)
+        constexpr unsigned char kBinaryMagic0 = 0xF5;
+        constexpr unsigned char kBinaryMagic1 = 'W';
+
+        /// Second magic byte of framed data chunks (same 0xF5 lead byte)
+        constexpr unsigned char kChunkMagic1 = 'C';
+
+        /// Fixed header size: magic(2) + version + type + flags + msgIdLen(u16) +
+        /// contentLen(u32)
+        constexpr size_t kBinaryHeaderSize = 11;
+
+        /// Fixed chunk header size: magic(2) + version + streamIdLen(u16) +
+        /// sequence(u32) + offset(u64) + payloadLen(u32)
+        constexpr size_t kChunkHeaderSize = 21;
+
+        /// Flag bits in header byte 4
+        constexpr uint8_t kFlagHasSize = 0x01;
+        constexpr uint8_t kFlagHasCrc = 0x02;
+
+        /// @brief Append a little-endian uint16 to the output buffer
+        void AppendU16(std::string& out, uint16_t value)
+        {
+            out.push_back(static_cast<char>(value & 0xFF));
+            out.push_back(static_cast<char>((value >> 8) & 0xFF));
+        }
+
+        /// @brief Append a little-endian uint32 to the output buffer
+        void AppendU32(std::string& out, uint32_t value)
+        {
+            for (int i = 0; i < 4; ++i)
+                out.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+        }
+
+        /// @brief Append a little-endian uint64 to the output buffer
+        void AppendU64(std::string& out, uint64_t value)
+        {
+            for (int i = 0; i < 8; ++i)
+                out.push_back(static_cast<char>((value >> (i * 8)) & 0xFF));
+        }
+
+        /// @brief Decode a little-endian uint16 from raw frame bytes
+        uint16_t ReadU16(const char* bytes)
+        {
+            return static_cast<uint16_t>(
+                static_cast<unsigned char>(bytes[0]) |
+                (static_cast<unsigned char>(bytes[1]) << 8));
+        }
+
+        /// @brief Decode a little-endian uint32 from raw frame bytes
+        uint32_t ReadU32(const char* bytes)
+        {
+            uint32_t value = 0;
+            for (int i = 3; i >= 0; --i)
+                value = (value << 8) | static_cast<unsigned char>(bytes[i]);
+            return value;
+        }
+
+        /// @brief Decode a little-endian uint64 from raw frame bytes
+        uint64_t ReadU64(const char* bytes)
+        {
+            uint64_t value = 0;
+            for (int i = 7; i >= 0; --i)
+                value = (value << 8) | static_cast<unsigned char>(bytes[i]);
+            return value;
+        }
+    }
+
+    bool IsBinaryProtocolFrame(std::string_view frame)
+    {
+        return frame.size() >= kBinaryHeaderSize &&
+               static_cast<unsigned char>(frame[0]) == kBinaryMagic0 &&
+               static_cast<unsigned char>(frame[1]) == kBinaryMagic1 &&
+               static_cast<unsigned char>(frame[2]) == kBinaryProtocolVersion;
+    }
+
+    MessageView ParseBinaryMessageView(std::string_view frame)
+    {
+        MessageView msg;
+
+        if (!IsBinaryProtocolFrame(frame))
+            return msg;  // type stays Unknown
+
+        const uint8_t rawType = static_cast<uint8_t>(frame[3]);
+        if (rawType > static_cast<uint8_t>(MessageType::Unknown))
+        {
+            Logger::Instance().Warning("Protocol",
+                "Binary frame with invalid type: " + std::to_string(rawType));
+            return msg;
+        }
+
+        const uint8_t flags = static_cast<uint8_t>(frame[4]);
+        const uint16_t msgIdLen = ReadU16(frame.data() + 5);
+        const uint32_t contentLen = ReadU32(frame.data() + 7);
+
+        // Every field offset is known once the flags are read - validate the
+        // total against the actual frame size before touching anything
+        size_t offset = kBinaryHeaderSize;
+        if (flags & kFlagHasSize)
+            offset += 8;
+        if (flags & kFlagHasCrc)
+            offset += 4;
+        if (frame.size() != offset + msgIdLen + contentLen)
+        {
+            Logger::Instance().Warning("Protocol",
+                "Binary frame size mismatch: " + std::to_string(frame.size()) +
+                " bytes for declared " +
+                std::to_string(offset + msgIdLen + contentLen));
+            return msg;
+        }
+
+        size_t cursor = kBinaryHeaderSize;
+        if (flags & kFlagHasSize)
+        {
+            msg.binarySize = static_cast<size_t>(ReadU64(frame.data() + cursor));
+            cursor += 8;
+        }
+        if (flags & kFlagHasCrc)
+        {
+            msg.crc32c = ReadU32(frame.data() + cursor);
+            msg.hasCrc32c = true;
+            cursor += 4;
+        }
+
+        msg.type = static_cast<MessageType>(rawType);
+        msg.msgId = frame.substr(cursor, msgIdLen);
+        msg.content = frame.substr(cursor + msgIdLen, contentLen);
+        return msg;
+    }
+
+    void SerializeBinaryMessage(const Message& msg, std::string& out)
+    {
+        // The header stores the id length as u16 and the content length as u32;
+        // anything beyond that cannot be represented in this encoding
+        if (msg.msgId.size() > 0xFFFF || msg.content.size() > 0xFFFFFFFFull)
+        {
+            Logger::Instance().Error("Protocol",
+                "Message too large for binary encoding (msgId " +
+                std::to_string(msg.msgId.size()) + " bytes, content " +
+                std::to_string(msg.content.size()) + " bytes)");
+            out.clear();
+            return;
+        }
+
+        uint8_t flags = 0;
+        size_t total = kBinaryHeaderSize + msg.msgId.size() + msg.content.size();
+        if (msg.binarySize > 0)
+        {
+            flags |= kFlagHasSize;
+            total += 8;
+        }
+        if (msg.hasCrc32c)
+        {
+            flags |= kFlagHasCrc;
+            total += 4;
+        }
+
+        // Exact-size reservation - a reused buffer reaches its high-water
+        // capacity once and then serializes allocation-free
+        out.clear();
+        out.reserve(total);
+
+        out.push_back(static_cast<char>(kBinaryMagic0));
+        out.push_back(static_cast<char>(kBinaryMagic1));
+        out.push_back(static_cast<char>(kBinaryProtocolVersion));
+        out.push_back(static_cast<char>(msg.type));
+        out.push_back(static_cast<char>(flags));
+        AppendU16(out, static_cast<uint16_t>(msg.msgId.size()));
+        AppendU32(out, static_cast<uint32_t>(msg.content.size()));
+        if (flags & kFlagHasSize)
+            AppendU64(out, static_cast<uint64_t>(msg.binarySize));
+        if (flags & kFlagHasCrc)
+            AppendU32(out, msg.crc32c);
+        out.append(msg.msgId);
+        out.append(msg.content);
+    }
+
+    std::string SerializeBinaryMessage(const Message& msg)
+    {
+        std::string frame;
+        SerializeBinaryMessage(msg, frame);
+        return frame;
+    }
+
+    bool VersionSupportsBinary(std::string_view version)
+    {
+        int major = 0;
+        const auto result = std::from_chars(
+            version.data(), version.data() + version.size(), major);
+        return result.ec == std::errc() && major >= 2;
+    }
+
+    bool IsBinaryChunkFrame(std::string_view frame)
+    {
+        return frame.size() >= kChunkHeaderSize &&
+               static_cast<unsigned char>(frame[0]) == kBinaryMagic0 &&
+               static_cast<unsigned char>(frame[1]) == kChunkMagic1 &&
+               static_cast<unsigned char>(frame[2]) == kBinaryProtocolVersion;
+    }
+
+    BinaryChunkView ParseBinaryChunkView(std::string_view frame)
+    {
+        BinaryChunkView chunk;
+
+        if (!IsBinaryChunkFrame(frame))
+            return chunk;  // valid stays false
+
+        const uint16_t streamIdLen = ReadU16(frame.data() + 3);
+        const uint32_t payloadLen = ReadU32(frame.data() + 17);
+
+        // All offsets are fixed - validate the total against the actual frame
+        // size before touching anything
+        if (frame.size() != kChunkHeaderSize + streamIdLen + payloadLen)
+        {
+            Logger::Instance().Warning("Protocol",
+                "Chunk frame size mismatch: " + std::to_string(frame.size()) +
+                " bytes for declared " +
+                std::to_string(kChunkHeaderSize + streamIdLen + payloadLen));
+            return chunk;
+        }
+
+        chunk.sequence = ReadU32(frame.data() + 5);
+        chunk.offset = ReadU64(frame.data() + 9);
+        chunk.streamId = frame.substr(kChunkHeaderSize, streamIdLen);
+        chunk.payload = frame.substr(kChunkHeaderSize + streamIdLen, payloadLen);
+        chunk.valid = true;
+        return chunk;
+    }
+
+    void SerializeBinaryChunk(std::string_view streamId, uint32_t sequence,
+                              uint64_t offset, const void* data, size_t size,
+                              std::string& out)
+    {
+        // The header stores the id length as u16 and the payload length as
+        // u32; anything beyond that cannot be represented in this framing
+        if (streamId.size() > 0xFFFF || size > 0xFFFFFFFFull)
+        {
+            Logger::Instance().Error("Protocol",
+                "Chunk too large for framing (streamId " +
+                std::to_string(streamId.size()) + " bytes, payload " +
+                std::to_string(size) + " bytes)");
+            out.clear();
+            return;
+        }
+
+        // Exact-size reservation - a reused buffer reaches its high-water
+        // capacity once and then frames allocation-free
+        out.clear();
+        out.reserve(kChunkHeaderSize + streamId.size() + size);
+
+        out.push_back(static_cast<char>(kBinaryMagic0));
+        out.push_back(static_cast<char>(kChunkMagic1));
+        out.push_back(static_cast<char>(kBinaryProtocolVersion));
+        AppendU16(out, static_cast<uint16_t>(streamId.size()));
+        AppendU32(out, sequence);
+        AppendU64(out, offset);
+        AppendU32(out, static_cast<uint32_t>(size));
+        out.append(streamId);
+        out.append(static_cast<const char*>(data), size);
+    }
+
+    std::string SerializeBinaryChunk(std::string_view streamId, uint32_t sequence,
+                                     uint64_t offset, const void* data, size_t size)
+    {
+        std::string frame;
+        SerializeBinaryChunk(streamId, sequence, offset, data, size, frame);
+        return frame;
+    }
+}
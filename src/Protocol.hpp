@@ -1,174 +1,622 @@
-// CodeRabbit: Please review this file thoroughly for production readiness
-#pragma once
-
-#include <string>
-#include <memory>
-
-/**
- * @namespace Protocol
- * @brief Encapsulates all protocol-level definitions and utilities for TallyIX WebSocket communication.
- * 
- * This namespace handles:
- * - Message type definitions (enum class MessageType)
- * - Data structures for protocol messages (Message, Config)
- * - JSON parsing and serialization functions
- * - Protocol configuration and limits
- * 
- * The protocol is designed to be extensible and human-readable using JSON format.
- * All binary data transfers are preceded by a BinaryStart metadata message.
- */
-namespace Protocol
-{
-    /**
-     * @enum MessageType
-     * @brief Enumeration of all supported protocol message types.
-     * 
-     * These types define the possible message types that can be sent or received
-     * in the TallyIX WebSocket protocol. Each type has specific handling rules.
-     */
-    enum class MessageType
-    {
-        Hello,           ///< Initial handshake message sent when connection is established
-        BinaryStart,     ///< Signals the start of binary data transfer with size metadata
-        BinaryData,      ///< Raw binary payload (data chunk)
-        Acknowledge,     ///< ACK message confirming receipt of a message
-        Error,           ///< Error response from the server
-        Unknown          ///< Unknown or unhandled message type (for future extensibility)
-    };
-
-    /**
-     * @struct Message
-     * @brief Represents a parsed protocol message with type, ID, content, and size metadata.
-     * 
-     * This is the primary data structure for all protocol communication. When a message
-     * is received (via JSON), it's converted to this typed structure for easier handling.
-     */
-    struct Message
-    {
-        MessageType type;        ///< The type of message (Hello, BinaryStart, etc.)
-        std::string msgId;       ///< Unique message identifier (e.g., "msg_001")
-        std::string content;     ///< Message content/payload (for text messages)
-        size_t binarySize = 0;   ///< Expected size of binary data (used in BinaryStart messages)
-
-        /// @brief Default constructor - initializes message as Unknown type
-        Message() : type(MessageType::Unknown) {}
-        
-        /// @brief Constructor with message type, ID, and optional content
-        /// @param t The message type
-        /// @param id Unique message identifier
-        /// @param c Optional message content (default empty string)
-        Message(MessageType t, const std::string& id, const std::string& c = "")
-            : type(t), msgId(id), content(c) {}
-    };
-
-    /**
-     * @struct Config
-     * @brief Configuration parameters for protocol behavior and limits.
-     * 
-     * These settings control timeouts, maximum payload sizes, and other protocol behaviors.
-     * They should be configured during initialization based on your application's needs.
-     * 
-     * @warning Due to internal copies during send operations, actual memory usage may be
-     *          2-3x the maxBinaryPayloadSize for large transfers. Plan accordingly.
-     */
-    struct Config
-    {
-        /// Connection timeout in milliseconds - how long to wait for server to accept connection
-        int connectionTimeoutMs = 10000;
-        
-        /// Message timeout in milliseconds - how long to wait for responses to sent messages
-        /// @note Currently reserved for future use - not enforced in current implementation
-        int messageTimeoutMs = 5000;
-        
-        /// Maximum binary payload size in bytes (100MB default) - prevents out-of-memory errors
-        /// Adjust based on your hardware and expected message sizes
-        /// @warning Memory usage during transfer may be 2-3x this value due to internal copies
-        /// @note Must be > 0 and <= 1GB for safety
-        size_t maxBinaryPayloadSize = 100 * 1024 * 1024;
-        
-        /// Per-message deflate compression (RFC 7692)
-        /// When enabled, messages are compressed before transmission to reduce bandwidth
-        /// @note Requires both client and server to support compression
-        bool enableCompression = false;
-        
-        /// Automatic ping/pong heartbeat interval in seconds (0 = disabled)
-        /// Sends periodic ping frames to keep the connection alive
-        /// Useful when behind load balancers that kill idle connections
-        /// @note Set to 0 to disable automatic heartbeat
-        int pingIntervalSeconds = 0;
-        
-        /// Protocol version string for compatibility checking (semantic versioning)
-        /// @note Currently reserved for future use - not validated in current implementation
-        std::string protocolVersion = "1.0";
-        
-        /// @brief Validate configuration values for safety
-        /// @return true if all values are within acceptable bounds
-        bool IsValid() const 
-        {
-            return connectionTimeoutMs > 0 && 
-                   messageTimeoutMs > 0 &&
-                   maxBinaryPayloadSize > 0 && 
-                   maxBinaryPayloadSize <= 1024ULL * 1024 * 1024 &&  // 1GB max
-                   pingIntervalSeconds >= 0;
-        }
-    };
-
-    /**
-     * @brief Convert MessageType enum to human-readable string.
-     * 
-     * Useful for debugging and logging purposes. Returns the string representation
-     * of the message type (e.g., "Hello", "BinaryStart", etc.).
-     * 
-     * @param type The MessageType enum value to convert
-     * @return String representation of the message type
-     */
-    std::string MessageTypeToString(MessageType type);
-
-    /**
-     * @brief Check if a message is valid (has required fields).
-     * 
-     * A valid message must have:
-     * - A known type (not Unknown)
-     * - A non-empty message ID
-     * 
-     * @param msg The message to validate
-     * @return true if the message is valid, false otherwise
-     */
-    bool IsValidMessage(const Message& msg);
-
-    /**
-     * @brief Parses a JSON-formatted string into a typed Protocol::Message.
-     * 
-     * This function extracts protocol message information from JSON format and converts
-     * it into a strongly-typed Message structure. It handles:
-     * - Type string to MessageType enum conversion
-     * - String values (msg_id, content)
-     * - Numeric values (size for binary transfers)
-     * 
-     * @param json The JSON string to parse (e.g., "{\"type\":\"hello\",\"msg_id\":\"123\"}")
-     * @return A Protocol::Message object with extracted data; type is Unknown if parsing fails
-     * 
-     * @note This uses simple string manipulation without external JSON libraries.
-     *       Keep content simple to avoid parsing issues (no escaped quotes, etc.).
-     */
-    Message ParseJsonMessage(const std::string& json);
-
-    /**
-     * @brief Serializes a Protocol::Message into JSON format for transmission.
-     * 
-     * This function converts a typed Message structure into JSON format suitable for
-     * transmission over WebSocket. It handles:
-     * - MessageType to type string conversion
-     * - Escaping and quoting of fields
-     * - Conditional inclusion of optional fields
-     * 
-     * @param msg The Message to serialize
-     * @return A JSON string representation of the message
-     * 
-     * @example
-     *   Protocol::Message msg(MessageType::Hello, "msg_001", "Hello");
-     *   std::string json = SerializeJsonMessage(msg);
-     *   // Result: {"type":"hello","msg_id":"msg_001","content":"Hello"}
-     */
-    std::string SerializeJsonMessage(const Message& msg);
-}
+// CodeRabbit: Please review this file thoroughly for production readiness
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <memory>
+#include <cstdint>
+
+/**
+ * @namespace Protocol
+ * @brief Encapsulates all protocol-level definitions and utilities for TallyIX WebSocket communication.
+ * 
+ * This namespace handles:
+ * - Message type definitions (enum class MessageType)
+ * - Data structures for protocol messages (Message, Config)
+ * - JSON parsing and serialization functions
+ * - Protocol configuration and limits
+ * 
+ * The protocol is designed to be extensible and human-readable using JSON format.
+ * All binary data transfers are preceded by a BinaryStart metadata message.
+ */
+namespace Protocol
+{
+    /**
+     * @enum MessageType
+     * @brief Enumeration of all supported protocol message types.
+     * 
+     * These types define the possible message types that can be sent or received
+     * in the TallyIX WebSocket protocol. Each type has specific handling rules.
+     */
+    enum class MessageType
+    {
+        Hello,           ///< Initial handshake message sent when connection is established
+        BinaryStart,     ///< Signals the start of binary data transfer with size metadata
+        BinaryData,      ///< Raw binary payload (data chunk)
+        Acknowledge,     ///< ACK message confirming receipt of a message
+        Error,           ///< Error response from the server
+        Unknown          ///< Unknown or unhandled message type (for future extensibility)
+    };
+
+    /**
+     * @struct Message
+     * @brief Represents a parsed protocol message with type, ID, content, and size metadata.
+     * 
+     * This is the primary data structure for all protocol communication. When a message
+     * is received (via JSON), it's converted to this typed structure for easier handling.
+     */
+    struct Message
+    {
+        MessageType type;        ///< The type of message (Hello, BinaryStart, etc.)
+        std::string msgId;       ///< Unique message identifier (e.g., "msg_001")
+        std::string content;     ///< Message content/payload (for text messages)
+        size_t binarySize = 0;   ///< Expected size of binary data (used in BinaryStart messages)
+        uint32_t crc32c = 0;     ///< CRC-32C of the announced binary payload (BinaryStart, optional)
+        bool hasCrc32c = false;  ///< Whether crc32c was present/should be serialized
+
+        /// @brief Default constructor - initializes message as Unknown type
+        Message() : type(MessageType::Unknown) {}
+        
+        /// @brief Constructor with message type, ID, and optional content
+        /// @param t The message type
+        /// @param id Unique message identifier
+        /// @param c Optional message content (default empty string)
+        Message(MessageType t, const std::string& id, const std::string& c = "")
+            : type(t), msgId(id), content(c) {}
+    };
+
+    /**
+     * @struct MessageView
+     * @brief Non-owning view of a parsed protocol message (zero-allocation).
+     *
+     * Parallel to Message, but the string fields are std::string_views pointing
+     * into the original frame buffer instead of heap-owning std::strings. Filling
+     * one via ParseJsonMessageView performs no allocations at all, so handlers
+     * that only inspect the type and id can process messages allocation-free on
+     * the WebSocket callback thread.
+     *
+     * @warning The views are only valid while the frame buffer they point into is
+     *          alive. Copy the fields (or convert with ToMessage) before storing
+     *          anything beyond the callback.
+     *
+     * @see ParseJsonMessageView, ToMessage
+     */
+    struct MessageView
+    {
+        MessageType type = MessageType::Unknown;  ///< The type of message (Hello, BinaryStart, etc.)
+        std::string_view msgId;                   ///< Unique message identifier (view into frame)
+        std::string_view content;                 ///< Message content/payload (view into frame)
+        size_t binarySize = 0;                    ///< Expected size of binary data (BinaryStart messages)
+        uint32_t crc32c = 0;                      ///< CRC-32C of the announced binary payload (optional)
+        bool hasCrc32c = false;                   ///< Whether crc32c was present in the frame
+    };
+
+    /**
+     * @enum CompressionHint
+     * @brief Per-call compression preference for the Send* hint overloads.
+     *
+     * Lets callers that know their payload override the connection-level
+     * policy: a pre-compressed image is never worth deflating, a large text
+     * blob almost always is.
+     *
+     * @see Config::enableAdaptiveCompression
+     */
+    enum class CompressionHint
+    {
+        Default,   ///< Follow the configured policy (adaptive mode if enabled)
+        Always,    ///< Compress this payload regardless of policy
+        Never      ///< Send this payload uncompressed regardless of policy
+    };
+
+    /**
+     * @struct Config
+     * @brief Configuration parameters for protocol behavior and limits.
+     * 
+     * These settings control timeouts, maximum payload sizes, and other protocol behaviors.
+     * They should be configured during initialization based on your application's needs.
+     * 
+     * @warning Due to internal copies during send operations, actual memory usage may be
+     *          2-3x the maxBinaryPayloadSize for large transfers. Plan accordingly.
+     */
+    struct Config
+    {
+        /// Connection timeout in milliseconds - how long to wait for server to accept connection
+        int connectionTimeoutMs = 10000;
+        
+        /// Message timeout in milliseconds - how long to wait for responses to sent messages
+        /// Enforced by the ack window engine (ackWindowSize > 0): a tracked
+        /// message unacknowledged for this long is retransmitted, and reported
+        /// via IMessageHandler::OnMessageTimeout once maxRetransmits is spent
+        int messageTimeoutMs = 5000;
+        
+        /// Maximum binary payload size in bytes (100MB default) - prevents out-of-memory errors
+        /// Adjust based on your hardware and expected message sizes
+        /// @warning Memory usage during transfer may be 2-3x this value due to internal copies
+        /// @note Must be > 0 and <= 1GB for safety
+        size_t maxBinaryPayloadSize = 100 * 1024 * 1024;
+        
+        /// Per-message deflate compression (RFC 7692)
+        /// When enabled, messages are compressed before transmission to reduce bandwidth
+        /// @note Requires both client and server to support compression
+        bool enableCompression = false;
+        
+        /// Adaptive per-message compression policy
+        /// When enabled, each outbound payload is classified before sending:
+        /// payloads below compressionMinSizeBytes (deflate overhead exceeds
+        /// the savings) or whose sampled entropy exceeds
+        /// compressionMaxEntropyBitsPerByte (already compressed/encrypted
+        /// data) go out uncompressed, everything else compressed. Per-call
+        /// CompressionHint overrides win over the classifier.
+        /// @warning Applied by driving the library's deflate toggle between
+        ///          messages - compression must have been negotiated with the
+        ///          server at the handshake (enableCompression) for any frame
+        ///          to actually compress
+        bool enableAdaptiveCompression = false;
+        
+        /// Smallest payload worth compressing in adaptive mode, in bytes
+        /// Below this the deflate headers and CPU cost outweigh the savings
+        size_t compressionMinSizeBytes = 256;
+        
+        /// Entropy ceiling for adaptive compression, in bits per byte (0-8)
+        /// Payloads whose sampled byte entropy exceeds this are treated as
+        /// incompressible (media, archives, ciphertext) and sent as-is.
+        /// JSON and logs typically measure 4-5.5; compressed data 7.8+
+        double compressionMaxEntropyBitsPerByte = 7.0;
+        
+        /// Automatic ping/pong heartbeat interval in seconds (0 = disabled)
+        /// Sends periodic ping frames to keep the connection alive
+        /// Useful when behind load balancers that kill idle connections
+        /// @note Set to 0 to disable automatic heartbeat
+        int pingIntervalSeconds = 0;
+        
+        /// Automatic reconnection after an unexpected disconnect or error
+        /// When enabled, WsClient retries the last URL with jittered exponential
+        /// backoff until it reconnects (or maxReconnectAttempts is exhausted).
+        /// A user-initiated Close() never triggers reconnection.
+        /// @note The application is notified via IMessageHandler::OnReconnected
+        bool enableAutoReconnect = false;
+        
+        /// Delay before the first reconnect attempt in milliseconds
+        /// Kept small by default so a server blip recovers in well under a second
+        int reconnectInitialDelayMs = 100;
+        
+        /// Upper bound on the reconnect delay in milliseconds
+        /// The exponential backoff never waits longer than this between attempts
+        int reconnectMaxDelayMs = 10000;
+        
+        /// Multiplier applied to the delay after each failed reconnect attempt
+        /// @note Must be >= 1.0 (1.0 = constant delay, 2.0 = classic doubling)
+        double reconnectBackoffMultiplier = 2.0;
+        
+        /// Random jitter fraction (0.0 - 1.0) applied to each reconnect delay
+        /// Each wait is scaled by a random factor in [1-jitter, 1+jitter] so a
+        /// fleet of clients doesn't reconnect in lockstep after a server restart
+        double reconnectJitterFactor = 0.2;
+        
+        /// Maximum reconnect attempts per outage before giving up (0 = unlimited)
+        /// When exhausted, the failure is reported via OnProtocolError
+        int maxReconnectAttempts = 0;
+        
+        /// Send high watermark in bytes (0 = unlimited, no backpressure)
+        /// When the bytes queued for sending (WsClient::GetBufferedAmount)
+        /// reach this level, the connection is considered backed up: producers
+        /// can pace themselves with WsClient::WaitForDrain, and sends can be
+        /// made to fail fast via rejectSendsOverWatermark below
+        size_t sendHighWatermarkBytes = 0;
+        
+        /// Reject binary sends while the high watermark is exceeded
+        /// When true, SendBinary/SendFile return false instead of growing the
+        /// send queue past sendHighWatermarkBytes, keeping memory bounded
+        /// against a slow link. When false (default) the watermark is advisory
+        /// only - producers throttle themselves via WaitForDrain
+        /// @note Has no effect while sendHighWatermarkBytes is 0
+        bool rejectSendsOverWatermark = false;
+        
+        /// Priority-aware send scheduling (QoS)
+        /// When enabled, outbound traffic is staged through a two-class
+        /// scheduler: bulk binary payloads are chopped into chunks of
+        /// priorityChunkSizeBytes, and control frames (text, ping) jump the
+        /// queue between chunks - so acks and heartbeats keep low-millisecond
+        /// latency even while a 100MB transfer is in flight.
+        /// When false (default) sends go straight to the socket queue as before
+        bool enablePrioritySend = false;
+        
+        /// Chunk size in bytes for bulk binary payloads under the priority scheduler
+        /// Smaller chunks = lower control-frame latency, more per-frame overhead
+        /// @note Must be > 0; only used while enablePrioritySend is true
+        size_t priorityChunkSizeBytes = 64 * 1024;
+        
+        /// Send window for acknowledgment tracking (0 = ack tracking disabled)
+        /// When > 0, WsClient::SendTextWithAck tracks unacknowledged msgIds up
+        /// to this many in flight, so the application can pipeline messages
+        /// instead of waiting out one round trip each. Arriving Acknowledge
+        /// messages retire entries; messageTimeoutMs is enforced per entry
+        size_t ackWindowSize = 0;
+        
+        /// Built-in RTT probe (requires pingIntervalSeconds > 0)
+        /// When enabled, WsClient schedules its own sequence-numbered pings at
+        /// the heartbeat interval, matches each pong back to its ping, and
+        /// maintains a rolling round-trip distribution queryable via
+        /// WsClient::GetStats().pingToPong - continuous link-quality data
+        /// without any application code.
+        /// @note Replaces the library heartbeat (the probe pings double as
+        ///       keepalive), so there is no double pinging
+        bool enableRttProbe = false;
+        
+        /// Retransmit attempts per tracked message before it is reported failed
+        /// Each expiry of messageTimeoutMs resends the original payload and
+        /// rearms the deadline; after this many resends the message is dropped
+        /// and OnMessageTimeout fires
+        /// @note Only used while ackWindowSize is > 0
+        int maxRetransmits = 2;
+        
+        /// Coalesce SendTextBatch messages into one WebSocket frame
+        /// When enabled, a batch is packed as an RFC 7464-style JSON text
+        /// sequence (each record prefixed with a 0x1E record separator and
+        /// terminated with a newline) and sent as a single frame - one frame
+        /// header and one queue operation for hundreds of telemetry messages.
+        /// The receive path unpacks such frames transparently before parsing,
+        /// so handlers see individual messages either way
+        /// @note Both peers must run a client with batch-aware unpacking;
+        ///       leave disabled when talking to older peers
+        bool enableBatchCoalescing = false;
+        
+        /// Graceful shutdown deadline in milliseconds
+        /// How long Close() (and each pending close in CloseAll) waits for the
+        /// library's internal thread to confirm shutdown before giving up and
+        /// forcing the Disconnected state. Lower values bound worst-case drain
+        /// latency at the cost of occasionally abandoning a slow close
+        int shutdownTimeoutMs = 5000;
+        
+        /// Protocol version string for compatibility checking (semantic versioning)
+        /// Version 2.x additionally advertises support for the compact binary
+        /// control-message encoding (see enableBinaryProtocol)
+        std::string protocolVersion = "1.0";
+        
+        /// Compact binary protocol mode for control messages
+        /// When enabled (and protocolVersion is 2.0 or later), the client
+        /// accepts binary-encoded control frames and switches its own control
+        /// messages from JSON to the fixed-layout binary encoding once the
+        /// peer's Hello advertises a 2.x version (content token "ver=2.0").
+        /// Cuts control-plane bytes and parse cost by roughly an order of
+        /// magnitude at high ack volumes; peers that never advertise 2.x
+        /// simply keep talking JSON (transparent fallback)
+        bool enableBinaryProtocol = false;
+
+        /// Addressed chunk framing for binary transfers
+        /// When enabled, the receive path recognizes framed chunks (stream id,
+        /// sequence number, byte offset - see Protocol::SerializeBinaryChunk)
+        /// and reassembles them through a bounded reorder window, so chunks
+        /// may arrive out of order: striped across the connections of a
+        /// WsClientPool (SendBinaryStriped) or reordered by parallel network
+        /// paths. Unframed chunks keep the strict in-order crediting, so the
+        /// two styles coexist on one connection
+        /// @note Both peers must enable framing for striped transfers
+        bool enableChunkFraming = false;
+
+        /// Reorder window budget per binary stream, in bytes
+        /// Out-of-order framed chunks are buffered until the gap before them
+        /// fills; a stream whose buffered backlog exceeds this is aborted
+        /// (bounds memory against a stalled or malicious connection). Size it
+        /// to cover the worst expected skew between striped connections
+        /// @note Must be > 0; only used while enableChunkFraming is true
+        size_t chunkReassemblyWindowBytes = 16 * 1024 * 1024;
+
+        /// @brief Validate configuration values for safety
+        /// @return true if all values are within acceptable bounds
+        bool IsValid() const 
+        {
+            return connectionTimeoutMs > 0 && 
+                   messageTimeoutMs > 0 &&
+                   maxBinaryPayloadSize > 0 && 
+                   maxBinaryPayloadSize <= 1024ULL * 1024 * 1024 &&  // 1GB max
+                   pingIntervalSeconds >= 0 &&
+                   compressionMaxEntropyBitsPerByte > 0.0 &&
+                   compressionMaxEntropyBitsPerByte <= 8.0 &&
+                   reconnectInitialDelayMs > 0 &&
+                   reconnectMaxDelayMs >= reconnectInitialDelayMs &&
+                   reconnectBackoffMultiplier >= 1.0 &&
+                   reconnectJitterFactor >= 0.0 &&
+                   reconnectJitterFactor <= 1.0 &&
+                   maxReconnectAttempts >= 0 &&
+                   priorityChunkSizeBytes > 0 &&
+                   maxRetransmits >= 0 &&
+                   shutdownTimeoutMs > 0 &&
+                   chunkReassemblyWindowBytes > 0;
+        }
+    };
+
+    /**
+     * @brief Convert MessageType enum to human-readable string.
+     * 
+     * Useful for debugging and logging purposes. Returns the string representation
+     * of the message type (e.g., "Hello", "BinaryStart", etc.).
+     * 
+     * @param type The MessageType enum value to convert
+     * @return String representation of the message type
+     */
+    std::string MessageTypeToString(MessageType type);
+
+    /**
+     * @brief Check if a message is valid (has required fields).
+     * 
+     * A valid message must have:
+     * - A known type (not Unknown)
+     * - A non-empty message ID
+     * 
+     * @param msg The message to validate
+     * @return true if the message is valid, false otherwise
+     */
+    bool IsValidMessage(const Message& msg);
+
+    /**
+     * @brief Parses a JSON-formatted string into a typed Protocol::Message.
+     * 
+     * This function extracts protocol message information from JSON format and converts
+     * it into a strongly-typed Message structure. It handles:
+     * - Type string to MessageType enum conversion
+     * - String values (msg_id, content)
+     * - Numeric values (size for binary transfers)
+     * 
+     * @param json The JSON string to parse (e.g., "{\"type\":\"hello\",\"msg_id\":\"123\"}")
+     * @return A Protocol::Message object with extracted data; type is Unknown if parsing fails
+     * 
+     * @note This uses simple string manipulation without external JSON libraries.
+     *       Keep content simple to avoid parsing issues (no escaped quotes, etc.).
+     */
+    Message ParseJsonMessage(const std::string& json);
+
+    /**
+     * @brief Parses a JSON-formatted string into a non-owning MessageView (zero-allocation).
+     *
+     * Allocation-free counterpart of ParseJsonMessage: the input is walked once
+     * and the string fields of the returned view point directly into the frame
+     * buffer. Intended for the hot receive path, where materializing a Message
+     * with heap-owning strings per frame is measurable overhead.
+     *
+     * @param json The JSON string to parse; must outlive the returned view
+     * @return A MessageView with fields referencing the input; type is Unknown if parsing fails
+     *
+     * @warning The returned view is invalidated as soon as the input string is
+     *          modified or destroyed.
+     *
+     * @see ParseJsonMessage, ToMessage
+     */
+    MessageView ParseJsonMessageView(std::string_view json);
+
+    /**
+     * @brief Materialize an owning Message from a MessageView.
+     *
+     * Copies the viewed fields into heap-owning strings, producing a Message that
+     * is safe to store beyond the lifetime of the original frame buffer.
+     *
+     * @param view The view to materialize
+     * @return An owning Message with identical field values
+     */
+    Message ToMessage(const MessageView& view);
+
+    /**
+     * @brief Check if a message view is valid (has required fields).
+     *
+     * Same rules as the Message overload: a known type and a non-empty id.
+     *
+     * @param msg The message view to validate
+     * @return true if the message is valid, false otherwise
+     */
+    bool IsValidMessage(const MessageView& msg);
+
+    /**
+     * @brief Serializes a Protocol::Message into JSON format for transmission.
+     * 
+     * This function converts a typed Message structure into JSON format suitable for
+     * transmission over WebSocket. It handles:
+     * - MessageType to type string conversion
+     * - Escaping and quoting of fields
+     * - Conditional inclusion of optional fields
+     * 
+     * @param msg The Message to serialize
+     * @return A JSON string representation of the message
+     * 
+     * @example
+     *   Protocol::Message msg(MessageType::Hello, "msg_001", "Hello");
+     *   std::string json = SerializeJsonMessage(msg);
+     *   // Result: {"type":"hello","msg_id":"msg_001","content":"Hello"}
+     */
+    std::string SerializeJsonMessage(const Message& msg);
+
+    /**
+     * @brief Serializes a Protocol::Message into a caller-owned reusable buffer.
+     *
+     * Allocation-conscious counterpart of the returning overload, intended for
+     * steady-state send loops that serialize tens of thousands of messages per
+     * second. The output buffer is cleared, reserved to the exact serialized
+     * size computed up front, and filled - so a buffer reused across calls
+     * reaches its high-water capacity once and serialization then runs with
+     * zero allocations. Small messages without content (the common Acknowledge
+     * shape) are additionally assembled on the stack and written with a single
+     * append.
+     *
+     * @param msg The Message to serialize
+     * @param out Caller-owned output buffer; overwritten with the JSON text
+     *
+     * @example
+     *   std::string buffer;                          // Reused across the loop
+     *   for (const auto& ack : acks) {
+     *       Protocol::SerializeJsonMessage(ack, buffer);
+     *       client.SendText(buffer);                 // No serializer allocations
+     *   }
+     */
+    void SerializeJsonMessage(const Message& msg, std::string& out);
+
+    /// Wire version of the compact binary control-message encoding
+    constexpr uint8_t kBinaryProtocolVersion = 1;
+
+    /**
+     * @brief Check whether a binary frame is a compact-encoded control message.
+     *
+     * Tests the two-byte magic and version that every binary-encoded control
+     * frame starts with, distinguishing control messages from raw binary data
+     * chunks on the same connection.
+     *
+     * @param frame The binary frame payload
+     * @return true if the frame carries the binary control-message encoding
+     *
+     * @warning The check is probabilistic for raw chunks: a data chunk whose
+     *          first bytes happen to match the magic (the leading byte 0xF5
+     *          never occurs in valid UTF-8 and is rare in real payloads) would
+     *          be misclassified. Only consulted while binary protocol mode is
+     *          enabled.
+     */
+    bool IsBinaryProtocolFrame(std::string_view frame);
+
+    /**
+     * @brief Parse a compact binary control frame into a non-owning MessageView.
+     *
+     * Counterpart of ParseJsonMessageView for the binary encoding. All fields
+     * sit at fixed (or fixed-computable) offsets, so parsing is constant-time
+     * plus two pointer assignments for the string views - no scanning.
+     *
+     * Frame layout (all integers little-endian):
+     *   [0]  u8  magic (0xF5)
+     *   [1]  u8  'W'
+     *   [2]  u8  encoding version (kBinaryProtocolVersion)
+     *   [3]  u8  MessageType
+     *   [4]  u8  flags (bit0: size present, bit1: crc32c present)
+     *   [5]  u16 msgId length
+     *   [7]  u32 content length
+     *   [11] u64 binary size        (if flags bit0)
+     *   [..] u32 crc32c             (if flags bit1)
+     *   [..] msgId bytes, content bytes
+     *
+     * @param frame The binary frame; must outlive the returned view
+     * @return A MessageView referencing the input; type is Unknown if the
+     *         frame is malformed or truncated
+     *
+     * @see SerializeBinaryMessage, ParseJsonMessageView
+     */
+    MessageView ParseBinaryMessageView(std::string_view frame);
+
+    /**
+     * @brief Serialize a message into the compact binary encoding.
+     *
+     * Produces an 11-byte header plus the raw field bytes - typically 20-30
+     * bytes where the JSON form runs 60-80 - with no quoting or escaping work.
+     *
+     * @param msg The Message to serialize
+     * @return The binary frame payload (send as a binary WebSocket frame)
+     */
+    std::string SerializeBinaryMessage(const Message& msg);
+
+    /**
+     * @brief Serialize a message into the binary encoding, reusing a buffer.
+     *
+     * Buffer-reuse counterpart mirroring the JSON serializer pair: the output
+     * is cleared, reserved to the exact frame size, and filled, so a reused
+     * buffer serializes with zero allocations at steady state.
+     *
+     * @param msg The Message to serialize
+     * @param out Caller-owned output buffer; overwritten with the frame bytes
+     */
+    void SerializeBinaryMessage(const Message& msg, std::string& out);
+
+    /**
+     * @brief Whether a protocol version string advertises binary-mode support.
+     *
+     * Parses the leading major version number; 2.x and later support the
+     * compact binary control encoding.
+     *
+     * @param version Semantic version string (e.g., "2.0")
+     * @return true if the major version is 2 or higher
+     */
+    bool VersionSupportsBinary(std::string_view version);
+
+    /**
+     * @struct BinaryChunkView
+     * @brief Non-owning view of one framed binary chunk (zero-allocation).
+     *
+     * Framed chunks carry their own addressing - stream id, sequence number,
+     * and byte offset - so they can arrive out of order (striped across the
+     * connections of a pool, or reordered by multiple network paths) and
+     * still be committed to the right place. Unframed chunks, by contrast,
+     * are credited to the oldest stream in strict arrival order.
+     *
+     * @warning The views point into the frame buffer; copy them before
+     *          storing anything beyond the callback.
+     *
+     * @see ParseBinaryChunkView, SerializeBinaryChunk
+     */
+    struct BinaryChunkView
+    {
+        std::string_view streamId;   ///< msgId of the announcing BinaryStart
+        uint32_t sequence = 0;       ///< Chunk ordinal within the stream (0-based)
+        uint64_t offset = 0;         ///< Byte offset of this chunk's payload
+        std::string_view payload;    ///< The chunk payload bytes
+        bool valid = false;          ///< false if the frame was malformed
+    };
+
+    /**
+     * @brief Check whether a binary frame is a framed (addressed) data chunk.
+     *
+     * Tests the chunk magic that every framed chunk starts with (0xF5 'C',
+     * sharing the 0xF5 lead byte with the control encoding but a distinct
+     * second byte). Only consulted while chunk framing is enabled.
+     *
+     * @param frame The binary frame payload
+     * @return true if the frame carries the chunk framing header
+     *
+     * @warning Probabilistic against raw unframed chunks, exactly like
+     *          IsBinaryProtocolFrame - see the warning there.
+     */
+    bool IsBinaryChunkFrame(std::string_view frame);
+
+    /**
+     * @brief Parse a framed binary chunk into a non-owning view.
+     *
+     * Frame layout (all integers little-endian):
+     *   [0]  u8  magic (0xF5)
+     *   [1]  u8  'C'
+     *   [2]  u8  encoding version (kBinaryProtocolVersion)
+     *   [3]  u16 streamId length
+     *   [5]  u32 sequence number
+     *   [9]  u64 payload byte offset within the stream
+     *   [17] u32 payload length
+     *   [21] streamId bytes, payload bytes
+     *
+     * @param frame The binary frame; must outlive the returned view
+     * @return A BinaryChunkView referencing the input; valid is false if the
+     *         frame is malformed or truncated
+     */
+    BinaryChunkView ParseBinaryChunkView(std::string_view frame);
+
+    /**
+     * @brief Serialize one framed binary chunk, reusing a buffer.
+     *
+     * Prefixes the payload with the 21-byte chunk header plus the stream id.
+     * The output is cleared, reserved to the exact frame size, and filled, so
+     * a reused buffer frames chunks with zero allocations at steady state.
+     *
+     * @param streamId msgId of the announcing BinaryStart (<= 65535 bytes)
+     * @param sequence Chunk ordinal within the stream
+     * @param offset Byte offset of the payload within the stream
+     * @param data Payload bytes
+     * @param size Payload size in bytes (<= 4GB)
+     * @param out Caller-owned output buffer; overwritten with the frame bytes
+     */
+    void SerializeBinaryChunk(std::string_view streamId, uint32_t sequence,
+                              uint64_t offset, const void* data, size_t size,
+                              std::string& out);
+
+    /**
+     * @brief Serialize one framed binary chunk.
+     *
+     * @param streamId msgId of the announcing BinaryStart (<= 65535 bytes)
+     * @param sequence Chunk ordinal within the stream
+     * @param offset Byte offset of the payload within the stream
+     * @param data Payload bytes
+     * @param size Payload size in bytes (<= 4GB)
+     * @return The framed chunk (send as a binary WebSocket frame); empty on
+     *         unrepresentable input
+     */
+    std::string SerializeBinaryChunk(std::string_view streamId, uint32_t sequence,
+                                     uint64_t offset, const void* data, size_t size);
+}
@@ -0,0 +1,279 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#include "TimerWheel.hpp"
+#include "Logger.hpp"
+
+#include <algorithm>
+
+/**
+ * @file TimerWheel.cpp
+ * @brief Implementation of the shared hashed timer wheel.
+ *
+ * The wheel is a fixed ring of millisecond slots; a timer lands in slot
+ * (deadline & mask) and carries its absolute deadline so entries from future
+ * laps can share the slot. Insert and cancel are a hash lookup plus a list
+ * splice - O(1) - and the worker sleeps on a condition variable until the
+ * earliest armed deadline rather than polling a fixed tick, so an idle wheel
+ * produces no wakeups at all.
+ */
+
+TimerWheel& TimerWheel::Instance()
+{
+    // Static local variable - initialized only once, thread-safe in C++11 and
+    // later (same pattern as Logger)
+    static TimerWheel instance;
+    return instance;
+}
+
+TimerWheel::TimerWheel()
+    : mSlots(kWheelSize),
+      mEpoch(std::chrono::steady_clock::now())
+{
+}
+
+TimerWheel::~TimerWheel()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mShutdown = true;
+    }
+    mCV.notify_all();
+
+    if (mWorker.joinable())
+        mWorker.join();
+}
+
+uint64_t TimerWheel::Schedule(uint64_t pDelayMs, std::function<void()> pCallback)
+{
+    if (!pCallback)
+    {
+        Logger::Instance().Warning("TimerWheel",
+            "Schedule rejected: empty callback");
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    StartWorkerLocked();
+
+    // A zero delay still waits out the current tick - timers never fire
+    // synchronously from Schedule
+    const uint64_t delay = (pDelayMs > 0) ? pDelayMs : 1;
+    return InsertLocked(NowTick() + delay, 0, std::move(pCallback));
+}
+
+uint64_t TimerWheel::ScheduleRepeating(uint64_t pIntervalMs,
+                                       std::function<void()> pCallback)
+{
+    if (pIntervalMs == 0 || !pCallback)
+    {
+        Logger::Instance().Warning("TimerWheel",
+            "ScheduleRepeating rejected: zero interval or empty callback");
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    StartWorkerLocked();
+    return InsertLocked(NowTick() + pIntervalMs, pIntervalMs, std::move(pCallback));
+}
+
+bool TimerWheel::Cancel(uint64_t pTimerId)
+{
+    if (pTimerId == 0)
+        return false;
+
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    bool removed = false;
+    auto indexed = mIndex.find(pTimerId);
+    if (indexed != mIndex.end())
+    {
+        mSlots[indexed->second.first].erase(indexed->second.second);
+        mIndex.erase(indexed);
+        removed = true;
+
+        // A cancelled earliest deadline leaves mEarliestTick stale (too
+        // early); the worker absorbs that as one empty wakeup and rescans
+    }
+
+    // If this timer's callback is mid-flight on the worker, wait it out so
+    // the caller may tear down captured state the moment Cancel returns.
+    // Self-cancel from inside the callback must not wait for itself.
+    if (mFiringId == pTimerId &&
+        std::this_thread::get_id() != mWorker.get_id())
+    {
+        mFiredCV.wait(lock, [this, pTimerId] {
+            return mFiringId != pTimerId;
+        });
+    }
+
+    return removed;
+}
+
+size_t TimerWheel::GetActiveCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mIndex.size();
+}
+
+uint64_t TimerWheel::NowTick() const
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - mEpoch).count());
+}
+
+uint64_t TimerWheel::InsertLocked(uint64_t pDeadlineTick, uint64_t pIntervalMs,
+                                  std::function<void()> pCallback)
+{
+    const uint64_t id = mNextId++;
+    const size_t slot = static_cast<size_t>(pDeadlineTick & kWheelMask);
+
+    Timer timer;
+    timer.id = id;
+    timer.deadlineTick = pDeadlineTick;
+    timer.intervalMs = pIntervalMs;
+    timer.callback = std::move(pCallback);
+
+    mSlots[slot].push_back(std::move(timer));
+    mIndex[id] = { slot, std::prev(mSlots[slot].end()) };
+
+    // Only an earlier-than-known deadline needs to interrupt the worker's
+    // sleep; later deadlines are picked up on its next natural wakeup
+    if (pDeadlineTick < mEarliestTick)
+    {
+        mEarliestTick = pDeadlineTick;
+        mCV.notify_all();
+    }
+
+    return id;
+}
+
+void TimerWheel::StartWorkerLocked()
+{
+    if (mWorkerStarted)
+        return;
+
+    mWorkerStarted = true;
+    mWorker = std::thread(&TimerWheel::WorkerLoop, this);
+}
+
+void TimerWheel::WorkerLoop()
+{
+    Logger::Instance().Debug("TimerWheel", "Timer wheel worker started");
+
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    while (!mShutdown)
+    {
+        // Empty wheel: sleep with no deadline at all - an idle process costs
+        // zero wakeups
+        if (mEarliestTick == kNoDeadline)
+        {
+            mCV.wait(lock, [this] {
+                return mShutdown || mEarliestTick != kNoDeadline;
+            });
+            continue;
+        }
+
+        // Sleep until the earliest armed deadline, waking early only for
+        // shutdown or a newly armed earlier timer
+        const uint64_t target = mEarliestTick;
+        if (mCV.wait_until(lock,
+                mEpoch + std::chrono::milliseconds(target),
+                [this, target] {
+                    return mShutdown || mEarliestTick < target;
+                }))
+        {
+            continue;  // Re-evaluate with the new earliest deadline
+        }
+
+        // Collect everything due first, then fire outside the lock. Firing
+        // inline would let a concurrent Cancel invalidate the slot iterator
+        // under our feet while the lock is dropped for the callback.
+        const uint64_t nowTick = NowTick();
+        if (nowTick <= mCurrentTick)
+            continue;  // Spurious wakeup before the tick boundary
+
+        std::vector<Timer> due;
+
+        // Nothing lives before the earliest deadline - skip the empty span
+        // (matters after long idle periods)
+        if (mEarliestTick > mCurrentTick + 1)
+            mCurrentTick = mEarliestTick - 1;
+
+        // One full lap visits every slot, so walking further is redundant
+        const uint64_t steps =
+            std::min(nowTick - mCurrentTick, static_cast<uint64_t>(kWheelSize));
+
+        for (uint64_t i = 1; i <= steps; ++i)
+        {
+            std::list<Timer>& slot = mSlots[(mCurrentTick + i) & kWheelMask];
+
+            for (auto it = slot.begin(); it != slot.end();)
+            {
+                if (it->deadlineTick > nowTick)
+                {
+                    // Future lap - stays parked in this slot
+                    ++it;
+                    continue;
+                }
+
+                Timer timer = std::move(*it);
+                it = slot.erase(it);
+                mIndex.erase(timer.id);
+
+                // Repeating timers rearm before firing (deadline-to-deadline,
+                // so the series doesn't drift), which also means a Cancel
+                // issued from inside the callback finds and removes the next
+                // occurrence cleanly
+                if (timer.intervalMs > 0)
+                {
+                    const uint64_t next = timer.deadlineTick + timer.intervalMs;
+                    const size_t nextSlot = static_cast<size_t>(next & kWheelMask);
+
+                    Timer rearmed;
+                    rearmed.id = timer.id;
+                    rearmed.deadlineTick = next;
+                    rearmed.intervalMs = timer.intervalMs;
+                    rearmed.callback = timer.callback;
+
+                    mSlots[nextSlot].push_back(std::move(rearmed));
+                    mIndex[timer.id] = { nextSlot,
+                                         std::prev(mSlots[nextSlot].end()) };
+                }
+
+                due.push_back(std::move(timer));
+            }
+        }
+
+        mCurrentTick = nowTick;
+
+        // Recompute the earliest deadline for the next sleep. O(armed timers),
+        // but only paid when something actually fired - inserts and cancels
+        // stay O(1)
+        mEarliestTick = kNoDeadline;
+        for (const auto& slot : mSlots)
+        {
+            for (const Timer& timer : slot)
+                mEarliestTick = std::min(mEarliestTick, timer.deadlineTick);
+        }
+
+        // Fire the batch with the lock dropped; mFiringId lets Cancel wait
+        // out the in-flight callback instead of racing its captured state
+        for (Timer& timer : due)
+        {
+            if (mShutdown)
+                break;
+
+            mFiringId = timer.id;
+            lock.unlock();
+
+            timer.callback();
+
+            lock.lock();
+            mFiringId = 0;
+            mFiredCV.notify_all();
+        }
+    }
+
+    Logger::Instance().Debug("TimerWheel", "Timer wheel worker stopped");
+}
@@ -0,0 +1,198 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+
+/**
+ * @class TimerWheel
+ * @brief Shared hashed timer wheel - one thread serves every timer in the process.
+ *
+ * Each WsClient used to run its own timer threads: an RTT probe scheduler, an
+ * ack-deadline monitor ticking every 50ms, and a reconnection worker sleeping
+ * out backoff delays. Per client that is three mostly-idle threads; a fleet of
+ * hundreds of clients burns thousands of stacks and a steady stream of
+ * wakeups on work that is almost always "check a clock, go back to sleep".
+ *
+ * TimerWheel collapses all of that into one process-wide worker. Timers hash
+ * into a fixed ring of millisecond slots (deadline modulo wheel size), so
+ * Schedule and Cancel are O(1) regardless of how many timers are armed. The
+ * worker sleeps until the earliest armed deadline - not on a fixed tick - so
+ * an idle fleet costs no wakeups at all, and the worker thread itself is only
+ * started once the first timer is scheduled.
+ *
+ * Callback contract:
+ * - Callbacks run on the wheel thread, one at a time. Keep them short: a slow
+ *   callback delays every other timer in the process (hand real work off to
+ *   another thread, as the WsClient send paths already do).
+ * - Cancel returns only after any in-flight invocation of that timer's
+ *   callback has finished (unless called from the callback itself), so state
+ *   captured by the callback may be destroyed as soon as Cancel returns.
+ * - Repeating timers are rearmed before their callback runs; cancelling from
+ *   inside the callback therefore stops the series cleanly.
+ *
+ * Thread Safety:
+ * - Schedule/ScheduleRepeating/Cancel/GetActiveCount: any thread
+ * - Never call Cancel while holding a lock the timer's callback also takes -
+ *   Cancel may block on that callback finishing
+ *
+ * @note Resolution is one millisecond; a timer may fire up to one tick late
+ *       (plus scheduler latency), which is well inside the slack of heartbeat
+ *       intervals, ack timeouts, and reconnect backoff delays.
+ *
+ * @example
+ *   // Heartbeat every 30s without a dedicated thread
+ *   uint64_t id = TimerWheel::Instance().ScheduleRepeating(30000, [this] {
+ *       SendHeartbeat(); });
+ *   ...
+ *   TimerWheel::Instance().Cancel(id);  // Safe: callback can't be in flight after this
+ *
+ * @see WsClient - RTT probes, ack deadlines, and reconnect backoff all run here
+ */
+class TimerWheel
+{
+public:
+    /**
+     * @brief Get the process-wide timer wheel instance.
+     *
+     * @return Reference to the singleton (worker thread starts lazily on
+     *         first Schedule)
+     */
+    static TimerWheel& Instance();
+
+    // Non-copyable, non-movable (owns the worker thread)
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    /**
+     * @brief Arm a one-shot timer.
+     *
+     * @param pDelayMs Delay before the callback fires, in milliseconds
+     *                 (0 rounds up to the next tick)
+     * @param pCallback Invoked once on the wheel thread when the delay expires
+     * @return Timer id for Cancel (never 0)
+     */
+    uint64_t Schedule(uint64_t pDelayMs, std::function<void()> pCallback);
+
+    /**
+     * @brief Arm a repeating timer firing every pIntervalMs until cancelled.
+     *
+     * @param pIntervalMs Interval between invocations in milliseconds (must be > 0)
+     * @param pCallback Invoked on the wheel thread at each interval
+     * @return Timer id for Cancel, or 0 if the interval was invalid
+     *
+     * @note Intervals are measured deadline-to-deadline, so a slow callback
+     *       does not drift the schedule (it can, however, make a fire late).
+     */
+    uint64_t ScheduleRepeating(uint64_t pIntervalMs, std::function<void()> pCallback);
+
+    /**
+     * @brief Disarm a timer.
+     *
+     * If the timer's callback is executing on the wheel thread right now,
+     * this blocks until it returns - after Cancel, the callback is guaranteed
+     * not to be running and will never run again. Calling Cancel from inside
+     * the callback itself does not block (the current invocation completes).
+     *
+     * @param pTimerId Id returned by Schedule/ScheduleRepeating (0 is a no-op)
+     * @return true if the timer was still armed and has been removed
+     *
+     * @warning Do not hold a lock the callback takes while calling this -
+     *          see the class-level thread-safety notes.
+     */
+    bool Cancel(uint64_t pTimerId);
+
+    /**
+     * @brief Get the number of currently armed timers.
+     *
+     * @return Armed timer count (diagnostic - racy by nature)
+     */
+    size_t GetActiveCount() const;
+
+private:
+    TimerWheel();
+    ~TimerWheel();
+
+    /**
+     * @struct Timer
+     * @brief One armed timer parked in its wheel slot.
+     */
+    struct Timer
+    {
+        uint64_t id = 0;            ///< Handle returned to the caller
+        uint64_t deadlineTick = 0;  ///< Absolute tick (ms since the wheel epoch)
+        uint64_t intervalMs = 0;    ///< Repeat interval (0 = one-shot)
+        std::function<void()> callback;  ///< Invoked on the wheel thread
+    };
+
+    /// Slots per lap - power of two so the slot index is a mask, ~1s per lap
+    static constexpr size_t kWheelSize = 1024;
+
+    /// Slot index mask (deadlineTick & kWheelMask)
+    static constexpr uint64_t kWheelMask = kWheelSize - 1;
+
+    /// Sentinel for "no armed deadline"
+    static constexpr uint64_t kNoDeadline = UINT64_MAX;
+
+    /// @brief Milliseconds elapsed since the wheel epoch (current absolute tick)
+    uint64_t NowTick() const;
+
+    /// @brief Park a timer in its slot and index it; wakes the worker if it
+    ///        became the earliest deadline. Returns the new timer id.
+    uint64_t InsertLocked(uint64_t pDeadlineTick, uint64_t pIntervalMs,
+                          std::function<void()> pCallback);
+
+    /// @brief Start the worker thread if it isn't running yet
+    void StartWorkerLocked();
+
+    /// @brief Worker body - sleeps to the earliest deadline, fires due timers
+    void WorkerLoop();
+
+    /// @brief Wheel slots - each holds the timers hashing to that tick
+    std::vector<std::list<Timer>> mSlots;
+
+    /// @brief Timer id -> (slot index, position in slot) for O(1) Cancel
+    std::unordered_map<uint64_t,
+        std::pair<size_t, std::list<Timer>::iterator>> mIndex;
+
+    /// @brief Protects the wheel state (slots, index, deadlines, flags)
+    mutable std::mutex mMutex;
+
+    /// @brief Wakes the worker (earlier deadline armed, or shutdown)
+    std::condition_variable mCV;
+
+    /// @brief Signals callback completion - what Cancel waits on
+    std::condition_variable mFiredCV;
+
+    /// @brief The single shared worker thread (started on first Schedule)
+    std::thread mWorker;
+
+    /// @brief Set by the destructor to stop the worker
+    bool mShutdown = false;
+
+    /// @brief Whether the worker thread has been started
+    bool mWorkerStarted = false;
+
+    /// @brief Next timer id (starts at 1 so 0 can mean "no timer")
+    uint64_t mNextId = 1;
+
+    /// @brief Last tick the worker has fully processed
+    uint64_t mCurrentTick = 0;
+
+    /// @brief Earliest armed deadline tick (kNoDeadline when the wheel is empty)
+    uint64_t mEarliestTick = kNoDeadline;
+
+    /// @brief Id of the timer whose callback is executing (0 = none)
+    uint64_t mFiringId = 0;
+
+    /// @brief Time base for tick arithmetic (fixed at construction)
+    std::chrono::steady_clock::time_point mEpoch;
+};
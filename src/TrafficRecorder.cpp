@@ -0,0 +1,132 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#include "TrafficRecorder.hpp"
+#include "Logger.hpp"
+
+#include <cstring>
+
+/**
+ * @file TrafficRecorder.cpp
+ * @brief Implementation of the wire traffic capture log.
+ *
+ * The record encoding is assembled with explicit little-endian byte writes,
+ * so logs captured on any host replay identically everywhere.
+ */
+
+namespace
+{
+    /// @brief Append a uint32 in little-endian byte order
+    void AppendU32(std::string& out, uint32_t value)
+    {
+        char bytes[4];
+        bytes[0] = static_cast<char>(value & 0xFF);
+        bytes[1] = static_cast<char>((value >> 8) & 0xFF);
+        bytes[2] = static_cast<char>((value >> 16) & 0xFF);
+        bytes[3] = static_cast<char>((value >> 24) & 0xFF);
+        out.append(bytes, 4);
+    }
+
+    /// @brief Append a uint64 in little-endian byte order
+    void AppendU64(std::string& out, uint64_t value)
+    {
+        char bytes[8];
+        for (int i = 0; i < 8; ++i)
+            bytes[i] = static_cast<char>((value >> (i * 8)) & 0xFF);
+        out.append(bytes, 8);
+    }
+}
+
+TrafficRecorder::TrafficRecorder() = default;
+
+TrafficRecorder::~TrafficRecorder()
+{
+    Close();
+}
+
+bool TrafficRecorder::Open(const std::string& pPath)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (mFile.is_open())
+    {
+        Logger::Instance().Warning("TrafficRecorder",
+            "Open called while already recording - ignored");
+        return false;
+    }
+
+    mFile.open(pPath, std::ios::binary | std::ios::trunc);
+    if (!mFile)
+    {
+        Logger::Instance().Error("TrafficRecorder",
+            "Failed to open log file: " + pPath);
+        return false;
+    }
+
+    // Header: magic + version
+    mFile.write(kMagic, sizeof(kMagic));
+    mFile.put(static_cast<char>(kFormatVersion));
+
+    mBuffer.clear();
+    mBuffer.reserve(kFlushThreshold + 64 * 1024);
+    mStart = std::chrono::steady_clock::now();
+    mFrameCount.store(0, std::memory_order_relaxed);
+    mByteCount.store(0, std::memory_order_relaxed);
+    mOpen.store(true, std::memory_order_release);
+
+    Logger::Instance().Info("TrafficRecorder", "Recording to " + pPath);
+    return true;
+}
+
+void TrafficRecorder::Record(Direction pDirection, bool pIsBinary,
+                             const void* pData, size_t pSize)
+{
+    // Lock-free early out keeps the disabled case off the mutex entirely
+    if (!mOpen.load(std::memory_order_acquire))
+        return;
+
+    const uint64_t timestampUs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - mStart).count());
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (!mFile.is_open())
+        return;
+
+    mBuffer.push_back(static_cast<char>(pDirection));
+    mBuffer.push_back(static_cast<char>(pIsBinary ? 1 : 0));
+    AppendU64(mBuffer, timestampUs);
+    AppendU32(mBuffer, static_cast<uint32_t>(pSize));
+    mBuffer.append(reinterpret_cast<const char*>(pData), pSize);
+
+    mFrameCount.fetch_add(1, std::memory_order_relaxed);
+    mByteCount.fetch_add(pSize, std::memory_order_relaxed);
+
+    if (mBuffer.size() >= kFlushThreshold)
+        FlushLocked();
+}
+
+void TrafficRecorder::Close()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (!mFile.is_open())
+        return;
+
+    mOpen.store(false, std::memory_order_release);
+    FlushLocked();
+    mFile.close();
+
+    Logger::Instance().Info("TrafficRecorder",
+        "Recording closed: " +
+        std::to_string(mFrameCount.load(std::memory_order_relaxed)) + " frames, " +
+        std::to_string(mByteCount.load(std::memory_order_relaxed)) + " payload bytes");
+}
+
+void TrafficRecorder::FlushLocked()
+{
+    if (mBuffer.empty())
+        return;
+
+    mFile.write(mBuffer.data(), static_cast<std::streamsize>(mBuffer.size()));
+    mBuffer.clear();
+}
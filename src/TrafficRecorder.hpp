@@ -0,0 +1,141 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#pragma once
+
+#include <string>
+#include <fstream>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @class TrafficRecorder
+ * @brief Captures wire frames to a compact length-prefixed binary log.
+ *
+ * Hooked into WsClient's send and receive paths (see WsClient::StartRecording),
+ * the recorder appends every frame - direction, capture timestamp, binary
+ * flag, payload - to a log file that TrafficReplayer can later feed back
+ * through the parser and router. That turns a production session into a
+ * repeatable offline workload: parser and handler changes can be profiled
+ * against real traces without standing up a server or regenerating traffic.
+ *
+ * File format (little-endian):
+ * - 8-byte header: magic "TIXWREC" + format version byte
+ * - Records, each:
+ *   - uint8  direction (0 = outbound, 1 = inbound)
+ *   - uint8  flags (bit 0 = binary frame)
+ *   - uint64 timestamp in microseconds since capture start (steady clock)
+ *   - uint32 payload size
+ *   - payload bytes
+ *
+ * Writes are buffered in memory and flushed in large blocks, so recording on
+ * the hot receive path costs a mutex and a memcpy per frame, not a syscall.
+ *
+ * Thread Safety:
+ * - Record is safe from any number of threads (socket thread, sender threads)
+ * - Open and Close are intended for one controlling thread
+ *
+ * @see TrafficReplayer, WsClient::StartRecording
+ */
+class TrafficRecorder
+{
+public:
+    /**
+     * @enum Direction
+     * @brief Which way a recorded frame crossed the wire.
+     */
+    enum class Direction : uint8_t
+    {
+        Outbound = 0,  ///< Sent by this client
+        Inbound = 1    ///< Received from the peer
+    };
+
+    /// @brief File header: 7 magic bytes + format version
+    static constexpr char kMagic[7] = {'T', 'I', 'X', 'W', 'R', 'E', 'C'};
+
+    /// @brief Current format version byte
+    static constexpr uint8_t kFormatVersion = 1;
+
+    /// @brief Constructor - no file is opened yet
+    TrafficRecorder();
+
+    /// @brief Destructor - flushes and closes the log if still open
+    ~TrafficRecorder();
+
+    // Non-copyable, non-movable (owns the file and is shared by reference)
+    TrafficRecorder(const TrafficRecorder&) = delete;
+    TrafficRecorder& operator=(const TrafficRecorder&) = delete;
+
+    /**
+     * @brief Open (truncate) the log file and write the header.
+     *
+     * The capture clock starts here: record timestamps are microseconds since
+     * this call.
+     *
+     * @param pPath Log file path (overwritten if it exists)
+     * @return true if the file is ready for recording
+     */
+    bool Open(const std::string& pPath);
+
+    /**
+     * @brief Append one frame to the log.
+     *
+     * Cheap enough for the hot paths: the frame is memcpy'd into the in-memory
+     * buffer under a mutex; actual file writes happen in large blocks.
+     * Silently ignored when no file is open.
+     *
+     * @param pDirection Outbound (sent) or Inbound (received)
+     * @param pIsBinary true for binary frames, false for text
+     * @param pData Payload bytes
+     * @param pSize Payload size in bytes
+     */
+    void Record(Direction pDirection, bool pIsBinary, const void* pData, size_t pSize);
+
+    /**
+     * @brief Flush buffered records and close the log file.
+     *
+     * Safe to call when no file is open.
+     */
+    void Close();
+
+    /// @brief Frames recorded since Open
+    uint64_t GetFrameCount() const
+    {
+        return mFrameCount.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Payload bytes recorded since Open
+    uint64_t GetByteCount() const
+    {
+        return mByteCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    /// @brief Flush the in-memory buffer to the file (mMutex must be held)
+    void FlushLocked();
+
+    /// @brief Buffer this many bytes before touching the file
+    static constexpr size_t kFlushThreshold = 256 * 1024;
+
+    /// @brief The log file (open between Open and Close)
+    std::ofstream mFile;
+
+    /// @brief In-memory staging buffer for records (protected by mMutex)
+    std::string mBuffer;
+
+    /// @brief Serializes Record/Close against each other
+    std::mutex mMutex;
+
+    /// @brief Set while a file is open - checked before taking the mutex
+    std::atomic<bool> mOpen{false};
+
+    /// @brief Capture start, the zero point of record timestamps
+    std::chrono::steady_clock::time_point mStart;
+
+    /// @brief Frames recorded since Open
+    std::atomic<uint64_t> mFrameCount{0};
+
+    /// @brief Payload bytes recorded since Open
+    std::atomic<uint64_t> mByteCount{0};
+};
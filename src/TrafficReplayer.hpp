@@ -0,0 +1,118 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#pragma once
+
+#include <string>
+#include <fstream>
+#include <cstdint>
+
+#include "TrafficRecorder.hpp"
+
+// Forward declaration - replay drives the router from MessageHandler.hpp
+class MessageRouter;
+
+/**
+ * @class TrafficReplayer
+ * @brief Feeds a captured traffic log back through the parse/dispatch pipeline.
+ *
+ * Reads a TrafficRecorder log and replays its inbound frames exactly as the
+ * live receive path would handle them: text frames go through
+ * Protocol::ParseJsonMessage and MessageRouter::RouteMessage, binary frames
+ * through RouteBinaryDataOwned. Outbound frames are skipped - they were this
+ * client's own sends. No network is involved, so a production trace becomes a
+ * deterministic workload for profiling parser and handler changes.
+ *
+ * Replay speed:
+ * - 0.0: as fast as possible (throughput profiling)
+ * - 1.0: recorded timing, reproduced from the captured timestamps
+ * - N:   N times faster than recorded (accelerated soak)
+ *
+ * @example
+ *   MessageRouter router;
+ *   router.SetMessageHandler(&myHandler);
+ *
+ *   TrafficReplayer replayer;
+ *   replayer.Open("session.tixwrec");
+ *   auto stats = replayer.Replay(router, 0.0);   // Full speed
+ *
+ * @see TrafficRecorder, WsClient::StartRecording
+ */
+class TrafficReplayer
+{
+public:
+    /**
+     * @struct Frame
+     * @brief One decoded log record.
+     */
+    struct Frame
+    {
+        TrafficRecorder::Direction direction = TrafficRecorder::Direction::Inbound;
+        bool isBinary = false;       ///< true for binary frames
+        uint64_t timestampUs = 0;    ///< Microseconds since capture start
+        std::string payload;         ///< The frame payload
+    };
+
+    /**
+     * @struct ReplayStats
+     * @brief Outcome of one Replay run.
+     */
+    struct ReplayStats
+    {
+        uint64_t framesReplayed = 0;   ///< Inbound frames fed to the router
+        uint64_t framesSkipped = 0;    ///< Outbound frames passed over
+        uint64_t bytesReplayed = 0;    ///< Payload bytes fed to the router
+        uint64_t parseFailures = 0;    ///< Text frames that parsed to Unknown
+        double elapsedSeconds = 0.0;   ///< Wall time of the replay
+    };
+
+    /// @brief Constructor - no file is opened yet
+    TrafficReplayer();
+
+    /// @brief Destructor - closes the log if still open
+    ~TrafficReplayer();
+
+    // Non-copyable, non-movable (owns the file stream)
+    TrafficReplayer(const TrafficReplayer&) = delete;
+    TrafficReplayer& operator=(const TrafficReplayer&) = delete;
+
+    /**
+     * @brief Open a capture log and validate its header.
+     *
+     * @param pPath Path to a file written by TrafficRecorder
+     * @return true if the file opened and the magic/version matched
+     */
+    bool Open(const std::string& pPath);
+
+    /**
+     * @brief Read the next record from the log.
+     *
+     * @param pFrame Receives the decoded frame
+     * @return true if a frame was read, false at end of log or on a truncated record
+     */
+    bool ReadNext(Frame& pFrame);
+
+    /**
+     * @brief Seek back to the first record.
+     *
+     * @return true if the log is open and was rewound
+     */
+    bool Rewind();
+
+    /**
+     * @brief Replay all inbound frames through a router.
+     *
+     * Runs on the calling thread; with a speed factor > 0 the thread sleeps
+     * between frames to reproduce (or scale) the recorded inter-frame gaps.
+     *
+     * @param pRouter Router whose handler receives the replayed traffic
+     * @param pSpeedFactor 0 = as fast as possible, 1 = recorded speed, N = N times faster
+     * @return Counters for the run
+     */
+    ReplayStats Replay(MessageRouter& pRouter, double pSpeedFactor = 0.0);
+
+    /// @brief Close the log file (safe when not open)
+    void Close();
+
+private:
+    /// @brief The log file (open between Open and Close)
+    std::ifstream mFile;
+};
@@ -1,615 +1,3521 @@
-// CodeRabbit: Please review this file thoroughly for production readiness
-#include "WsClient.hpp"
-#include "Logger.hpp"
-
-#include <iostream>
-#include <vector>
-#include <thread>
-
-// IXWebSocket library includes - provides low-level WebSocket protocol handling
-#include <ixwebsocket/IXNetSystem.h>
-#include <ixwebsocket/IXWebSocket.h>
-
-/**
- * @file WsClient.cpp
- * @brief Implementation of production-grade WebSocket client with thread safety.
- * 
- * This file implements the WsClient class using the Pimpl (Pointer to Implementation)
- * pattern to hide implementation details. The Impl class contains:
- * - The actual ix::WebSocket instance (from IXWebSocket library)
- * - Protocol configuration
- * - State management with mutex and condition variable
- * - Message router for dispatching to application handlers
- * - Binary transfer state tracking
- */
-
-/**
- * @class WsClient::Impl
- * @brief Private implementation class containing all WebSocket details.
- * 
- * Hidden from public API to avoid exposing IXWebSocket library headers.
- * Uses Pimpl pattern for cleaner interface and easier maintenance.
- */
-class WsClient::Impl
-{
-public:
-    /// The underlying IXWebSocket instance from IXWebSocket library
-    ix::WebSocket ws;
-    
-    /// Protocol configuration (timeouts, limits, etc.)
-    Protocol::Config config;
-    
-    /// Current connection state (Disconnected, Connecting, Connected, etc.)
-    ConnectionState state = ConnectionState::Disconnected;
-    
-    /// Mutex protecting the connection state from concurrent access
-    std::mutex stateMutex;
-    
-    /// Mutex protecting binary transfer state variables
-    std::mutex binaryMutex;
-    
-    /// Condition variable for synchronizing state changes (used in WaitForConnection)
-    std::condition_variable stateCV;
-    
-    /// Condition variable for synchronizing shutdown completion
-    std::condition_variable shutdownCV;
-    
-    /// Flag indicating that the WebSocket internal thread has completed shutdown
-    bool shutdownComplete = false;
-    
-    /// Message router for dispatching parsed messages to application handlers
-    MessageRouter messageRouter;
-    
-    /// Track bytes received for binary transfer reassembly (protected by binaryMutex)
-    size_t binaryBytesReceived = 0;
-    
-    /// Expected total bytes for current binary transfer (protected by binaryMutex)
-    size_t binaryExpectedSize = 0;
-    
-    /// Reset binary transfer state (call when connection closes or transfer completes)
-    void ResetBinaryState()
-    {
-        std::lock_guard<std::mutex> lock(binaryMutex);
-        binaryBytesReceived = 0;
-        binaryExpectedSize = 0;
-    }
-};
-
-WsClient::WsClient(const Protocol::Config& config)
-    : mImpl(std::make_unique<Impl>())
-{
-    // Store the configuration in the implementation
-    mImpl->config = config;
-    
-    Logger::Instance().Debug("WsClient", 
-        "WebSocket client created - timeout=" + 
-        std::to_string(config.connectionTimeoutMs) + "ms");
-}
-
-WsClient::~WsClient()
-{
-    // Ensure connection is closed before destroying
-    Close();
-    
-    Logger::Instance().Debug("WsClient", "WebSocket client destroyed");
-}
-
-bool WsClient::Open()
-{
-    // Initialize the network system (must be done once for the entire application)
-    if (!ix::initNetSystem())
-    {
-        Logger::Instance().Error("WsClient", 
-            "Failed to initialize network system");
-        return false;
-    }
-
-    // Disable automatic reconnection - we handle reconnection at application level
-    mImpl->ws.disableAutomaticReconnection();
-
-    // Configure ping/pong heartbeat if enabled (keeps connection alive through load balancers)
-    if (mImpl->config.pingIntervalSeconds > 0)
-    {
-        mImpl->ws.setPingInterval(mImpl->config.pingIntervalSeconds);
-        Logger::Instance().Debug("WsClient", 
-            "Heartbeat enabled: " + std::to_string(mImpl->config.pingIntervalSeconds) + " seconds");
-    }
-
-    // Configure per-message deflate compression if enabled
-    if (mImpl->config.enableCompression)
-    {
-        mImpl->ws.enablePerMessageDeflate();
-        Logger::Instance().Debug("WsClient", 
-            "Per-message deflate compression enabled");
-    }
-    else
-    {
-        mImpl->ws.disablePerMessageDeflate();
-    }
-
-    // Set up the message callback - called from IXWebSocket's internal thread
-    // when any message event occurs (open, message, close, error)
-    mImpl->ws.setOnMessageCallback(
-        [this](const ix::WebSocketMessagePtr& msg)
-        {
-            // Dispatch the event to appropriate callback based on message type
-            switch (msg->type)
-            {
-            case ix::WebSocketMessageType::Open:
-                OnOpen();  // Connection established
-                break;
-
-            case ix::WebSocketMessageType::Message:
-                // msg->str contains the message (text or binary)
-                // msg->binary indicates if it's binary (true) or text (false)
-                OnMessage(msg->str, msg->binary);
-                break;
-
-            case ix::WebSocketMessageType::Close:
-                OnClose();  // Connection closed by server
-                break;
-
-            case ix::WebSocketMessageType::Error:
-                // msg->errorInfo.reason contains error description
-                OnError(msg->errorInfo.reason);
-                break;
-
-            case ix::WebSocketMessageType::Ping:
-                // Ping received - pong is automatically sent by IXWebSocket
-                Logger::Instance().Debug("WsClient", 
-                    "[RECV][PING] " + (msg->str.empty() ? "(empty)" : msg->str));
-                mImpl->messageRouter.RoutePing(msg->str);
-                break;
-
-            case ix::WebSocketMessageType::Pong:
-                // Pong received (response to our ping)
-                Logger::Instance().Debug("WsClient", 
-                    "[RECV][PONG] " + (msg->str.empty() ? "(empty)" : msg->str));
-                mImpl->messageRouter.RoutePong(msg->str);
-                break;
-
-            default:
-                // Unknown message type - shouldn't happen
-                break;
-            }
-        });
-
-    Logger::Instance().Info("WsClient", 
-        "Network system initialized successfully");
-    return true;
-}
-
-bool WsClient::Connect(const std::string& pUrl)
-{
-    // Lock the state mutex to prevent race conditions
-    {
-        std::lock_guard<std::mutex> lock(mImpl->stateMutex);
-        
-        // Check if already connecting or connected
-        if (mImpl->state != ConnectionState::Disconnected)
-        {
-            Logger::Instance().Warning("WsClient", 
-                "Cannot connect: already in state " + 
-                std::to_string(static_cast<int>(mImpl->state)));
-            return false;
-        }
-        
-        // Transition to Connecting state
-        mImpl->state = ConnectionState::Connecting;
-    }
-
-    // Set the URL and start connection (non-blocking)
-    mImpl->ws.setUrl(pUrl);
-    mImpl->ws.start();
-    
-    Logger::Instance().Info("WsClient", 
-        "Connection initiated to " + pUrl);
-    return true;
-}
-
-bool WsClient::WaitForConnection(int timeoutMs)
-{
-    // Create unique_lock (unlike lock_guard, this works with condition variables)
-    std::unique_lock<std::mutex> lock(mImpl->stateMutex);
-    
-    // Early return if already connected or in invalid state for waiting
-    if (mImpl->state == ConnectionState::Connected)
-    {
-        Logger::Instance().Debug("WsClient", 
-            "WaitForConnection: Already connected");
-        return true;
-    }
-    
-    if (mImpl->state != ConnectionState::Connecting)
-    {
-        Logger::Instance().Warning("WsClient", 
-            "WaitForConnection: Invalid state - expected Connecting, got " + 
-            std::to_string(static_cast<int>(mImpl->state)));
-        return false;
-    }
-    
-    // Wait until one of these happens:
-    // 1. Timeout expires (returns false)
-    // 2. State becomes Connected (returns true)
-    // 3. State becomes Error (returns false - don't keep waiting)
-    // 4. Spurious wakeup (we loop again due to predicate check)
-    bool stateChanged = mImpl->stateCV.wait_for(lock, 
-        std::chrono::milliseconds(timeoutMs),
-        [this]() { 
-            return mImpl->state == ConnectionState::Connected ||
-                   mImpl->state == ConnectionState::Error ||
-                   mImpl->state == ConnectionState::Disconnected;
-        });
-
-    // Check final state after waiting
-    if (mImpl->state == ConnectionState::Connected)
-    {
-        Logger::Instance().Info("WsClient", 
-            "Successfully connected to server");
-        return true;
-    }
-    
-    // Determine reason for failure
-    if (mImpl->state == ConnectionState::Error)
-    {
-        Logger::Instance().Error("WsClient", 
-            "Connection failed with error");
-    }
-    else if (!stateChanged)
-    {
-        Logger::Instance().Error("WsClient", 
-            "Connection timeout after " + 
-            std::to_string(timeoutMs) + "ms");
-    }
-    else
-    {
-        Logger::Instance().Error("WsClient", 
-            "Connection failed - unexpected state: " + 
-            std::to_string(static_cast<int>(mImpl->state)));
-    }
-    
-    return false;
-}
-
-bool WsClient::SendText(const std::string& pText)
-{
-    // Check connection state before attempting to send
-    // NOTE: There is an intentional TOCTOU (time-of-check-time-of-use) gap here.
-    // The connection state could change between this check and the actual send below.
-    // This is acceptable because:
-    // 1. IXWebSocket handles sends on closed connections gracefully (returns error)
-    // 2. Holding the lock during I/O would risk deadlock with callbacks
-    // 3. The state check is a fast-path optimization, not a guarantee
-    {
-        std::lock_guard<std::mutex> lock(mImpl->stateMutex);
-        if (mImpl->state != ConnectionState::Connected)
-        {
-            Logger::Instance().Warning("WsClient", 
-                "Cannot send text: not connected (state=" + 
-                std::to_string(static_cast<int>(mImpl->state)) + ")");
-            return false;
-        }
-    }
-
-    // Queue the message for sending (IXWebSocket handles async transmission)
-    mImpl->ws.send(pText);
-    
-    Logger::Instance().Debug("WsClient", 
-        "[SEND][TEXT] " + pText.substr(0, 100) +  // Log first 100 chars
-        (pText.length() > 100 ? "..." : ""));
-    
-    return true;
-}
-
-bool WsClient::SendBinary(const void* pData, size_t pSize)
-{
-    // Validate parameters
-    if (!pData || pSize == 0)
-    {
-        Logger::Instance().Warning("WsClient", 
-            "Cannot send binary: invalid data " + 
-            (pData ? std::to_string(pSize) : "null pointer"));
-        return false;
-    }
-
-    // Check connection state before attempting to send
-    // NOTE: Intentional TOCTOU gap - see SendText() for detailed explanation
-    {
-        std::lock_guard<std::mutex> lock(mImpl->stateMutex);
-        if (mImpl->state != ConnectionState::Connected)
-        {
-            Logger::Instance().Warning("WsClient", 
-                "Cannot send binary: not connected");
-            return false;
-        }
-    }
-
-    // Validate against maximum payload size
-    if (pSize > mImpl->config.maxBinaryPayloadSize)
-    {
-        Logger::Instance().Error("WsClient", 
-            "Binary payload exceeds max size: " + 
-            std::to_string(pSize) + " > " + 
-            std::to_string(mImpl->config.maxBinaryPayloadSize));
-        return false;
-    }
-
-    // Convert void* to char* and create string from binary data
-    const char* data = reinterpret_cast<const char*>(pData);
-    mImpl->ws.sendBinary(std::string(data, pSize));
-    
-    Logger::Instance().Debug("WsClient", 
-        "[SEND][BINARY] " + std::to_string(pSize) + " bytes");
-    
-    return true;
-}
-
-bool WsClient::SendPing(const std::string& payload)
-{
-    // Check connection state before attempting to send
-    {
-        std::lock_guard<std::mutex> lock(mImpl->stateMutex);
-        if (mImpl->state != ConnectionState::Connected)
-        {
-            Logger::Instance().Warning("WsClient", 
-                "Cannot send ping: not connected");
-            return false;
-        }
-    }
-
-    // Send the ping frame (payload limited to 125 bytes per RFC 6455)
-    std::string trimmedPayload = payload.substr(0, 125);
-    mImpl->ws.ping(trimmedPayload);
-    
-    Logger::Instance().Debug("WsClient", 
-        "[SEND][PING] " + (trimmedPayload.empty() ? "(empty)" : trimmedPayload));
-    
-    return true;
-}
-
-void WsClient::EnableCompression()
-{
-    mImpl->ws.enablePerMessageDeflate();
-    Logger::Instance().Info("WsClient", 
-        "Per-message deflate compression enabled");
-}
-
-void WsClient::DisableCompression()
-{
-    mImpl->ws.disablePerMessageDeflate();
-    Logger::Instance().Info("WsClient", 
-        "Per-message deflate compression disabled");
-}
-
-WsClient::ConnectionState WsClient::GetState() const
-{
-    // Atomic read of current state
-    std::lock_guard<std::mutex> lock(mImpl->stateMutex);
-    return mImpl->state;
-}
-
-std::string WsClient::GetStateString() const
-{
-    ConnectionState state = GetState();
-    switch (state)
-    {
-    case ConnectionState::Disconnected: return "Disconnected";
-    case ConnectionState::Connecting:   return "Connecting";
-    case ConnectionState::Connected:    return "Connected";
-    case ConnectionState::Closing:      return "Closing";
-    case ConnectionState::Error:        return "Error";
-    default:                            return "Unknown";
-    }
-}
-
-void WsClient::SetMessageHandler(IMessageHandler* handler)
-{
-    // Pass the handler to the message router
-    mImpl->messageRouter.SetMessageHandler(handler);
-    
-    if (handler)
-    {
-        Logger::Instance().Debug("WsClient", 
-            "Message handler set");
-    }
-}
-
-void WsClient::Close()
-{
-    // Gracefully close the connection
-    {
-        std::lock_guard<std::mutex> lock(mImpl->stateMutex);
-        
-        // Silently succeed if already disconnected
-        if (mImpl->state == ConnectionState::Disconnected)
-            return;
-        
-        // Mark as closing and reset shutdown completion flag
-        mImpl->state = ConnectionState::Closing;
-        mImpl->shutdownComplete = false;
-    }
-
-    // Stop the WebSocket connection
-    mImpl->ws.stop();
-    
-    // Wait for the internal thread to exit gracefully with proper synchronization
-    // IXWebSocket will trigger OnClose callback when the thread has completed shutdown
-    {
-        std::unique_lock<std::mutex> lock(mImpl->stateMutex);
-        
-        // Wait up to 5 seconds for shutdown completion
-        bool completed = mImpl->shutdownCV.wait_for(
-            lock, 
-            std::chrono::milliseconds(5000),
-            [this] { return mImpl->shutdownComplete; }
-        );
-        
-        if (!completed)
-        {
-            Logger::Instance().Warning("WsClient", 
-                "Shutdown timeout - internal thread may still be running");
-        }
-    }
-
-    Logger::Instance().Info("WsClient", 
-        "Connection closed");
-}
-
-//
-// Private callback handlers - invoked from IXWebSocket's internal thread
-// All state modifications are protected by mutex
-//
-
-void WsClient::OnOpen()
-{
-    // Connection established - update state and notify waiters
-    {
-        std::lock_guard<std::mutex> lock(mImpl->stateMutex);
-        mImpl->state = ConnectionState::Connected;
-    }
-    
-    // Notify all threads waiting in WaitForConnection()
-    mImpl->stateCV.notify_all();
-
-    Logger::Instance().Info("WsClient", 
-        "Connected to server");
-}
-
-void WsClient::OnMessage(const std::string& pMsg, bool pIsBinary)
-{
-    if (pIsBinary)
-    {
-        // Binary data received - reassemble multipart binary transfers
-        Logger::Instance().Debug("WsClient", 
-            "[RECV][BINARY] " + std::to_string(pMsg.size()) + " bytes");
-        
-        // Thread-safe update of binary transfer state
-        bool transferComplete = false;
-        {
-            std::lock_guard<std::mutex> lock(mImpl->binaryMutex);
-            
-            // Check for integer overflow before adding
-            if (pMsg.size() > SIZE_MAX - mImpl->binaryBytesReceived)
-            {
-                Logger::Instance().Error("WsClient", 
-                    "Binary transfer overflow detected - resetting");
-                mImpl->binaryBytesReceived = 0;
-                mImpl->binaryExpectedSize = 0;
-                mImpl->messageRouter.RouteProtocolError(
-                    "Binary transfer size overflow - possible attack or corruption");
-                return;
-            }
-            
-            // Update total bytes received for this transfer
-            mImpl->binaryBytesReceived += pMsg.size();
-            
-            // Check if binary transfer is complete
-            // (received >= expected size from BinaryStart message)
-            if (mImpl->binaryBytesReceived >= mImpl->binaryExpectedSize &&
-                mImpl->binaryExpectedSize > 0)
-            {
-                transferComplete = true;
-            }
-        }
-        
-        // Route binary chunk to application handler (outside lock to avoid deadlock)
-        mImpl->messageRouter.RouteBinaryData(
-            reinterpret_cast<const uint8_t*>(pMsg.data()), 
-            pMsg.size());
-
-        if (transferComplete)
-        {
-            // Notify handler that transfer is complete
-            mImpl->messageRouter.RouteBinaryComplete();
-            
-            // Reset for next binary transfer (thread-safe)
-            mImpl->ResetBinaryState();
-        }
-    }
-    else
-    {
-        // Text message received (usually JSON protocol)
-        Logger::Instance().Debug("WsClient", 
-            "[RECV][TEXT] " + pMsg.substr(0, 100) + 
-            (pMsg.length() > 100 ? "..." : ""));
-        
-        // Parse JSON to protocol message
-        Protocol::Message msg = Protocol::ParseJsonMessage(pMsg);
-        
-        // Track expected binary size if this is a BinaryStart message
-        if (msg.type == Protocol::MessageType::BinaryStart)
-        {
-            std::lock_guard<std::mutex> lock(mImpl->binaryMutex);
-            
-            // Validate against maximum payload size (security check)
-            if (msg.binarySize > mImpl->config.maxBinaryPayloadSize)
-            {
-                Logger::Instance().Error("WsClient", 
-                    "BinaryStart size exceeds max: " + 
-                    std::to_string(msg.binarySize) + " > " + 
-                    std::to_string(mImpl->config.maxBinaryPayloadSize));
-                mImpl->messageRouter.RouteProtocolError(
-                    "Binary payload size exceeds maximum allowed: " + 
-                    std::to_string(msg.binarySize));
-                return;
-            }
-            
-            // Validate non-zero size
-            if (msg.binarySize == 0)
-            {
-                Logger::Instance().Warning("WsClient", 
-                    "BinaryStart with zero size - ignoring");
-                mImpl->messageRouter.RouteProtocolError(
-                    "BinaryStart message with zero size is invalid");
-                return;
-            }
-            
-            mImpl->binaryExpectedSize = msg.binarySize;
-            mImpl->binaryBytesReceived = 0;
-            
-            Logger::Instance().Debug("WsClient", 
-                "Binary transfer starting: " + 
-                std::to_string(mImpl->binaryExpectedSize) + " bytes expected");
-        }
-
-        // Route parsed message to application handler
-        mImpl->messageRouter.RouteMessage(msg);
-    }
-}
-
-void WsClient::OnClose()
-{
-    // Connection closed by server - update state and notify waiters
-    {
-        std::lock_guard<std::mutex> lock(mImpl->stateMutex);
-        mImpl->state = ConnectionState::Disconnected;
-        mImpl->shutdownComplete = true;  // Signal that shutdown is complete
-    }
-    
-    // Reset binary transfer state to prevent stale values on reconnect
-    mImpl->ResetBinaryState();
-    
-    // Notify all threads waiting in WaitForConnection()
-    mImpl->stateCV.notify_all();
-    
-    // Notify any threads waiting in Close() for shutdown to complete
-    mImpl->shutdownCV.notify_all();
-
-    Logger::Instance().Info("WsClient", 
-        "Server closed the connection");
-}
-
-void WsClient::OnError(const std::string& pReason)
-{
-    // Error occurred - update state and notify waiters
-    {
-        std::lock_guard<std::mutex> lock(mImpl->stateMutex);
-        mImpl->state = ConnectionState::Error;
-    }
-    
-    // Notify all threads waiting in WaitForConnection()
-    mImpl->stateCV.notify_all();
-
-    Logger::Instance().Error("WsClient", 
-        "Connection error: " + pReason);
-}
+// CodeRabbit: Please review this file thoroughly for production readiness
+#include "WsClient.hpp"
+#include "BinarySink.hpp"
+#include "Logger.hpp"
+#include "TrafficRecorder.hpp"
+#include "TimerWheel.hpp"
+#include "Crc32c.hpp"
+
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <atomic>
+#include <random>
+#include <algorithm>
+#include <unordered_map>
+#include <map>
+#include <bit>
+#include <charconv>
+#include <span>
+#include <cmath>
+
+// IXWebSocket library includes - provides low-level WebSocket protocol handling
+#include <ixwebsocket/IXNetSystem.h>
+#include <ixwebsocket/IXWebSocket.h>
+
+// Platform socket APIs for the Prewarm DNS/TCP warm-up path
+#ifdef _WIN32
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+#else
+    #include <sys/socket.h>
+    #include <netdb.h>
+    #include <unistd.h>
+#endif
+
+/**
+ * @file WsClient.cpp
+ * @brief Implementation of production-grade WebSocket client with thread safety.
+ * 
+ * This file implements the WsClient class using the Pimpl (Pointer to Implementation)
+ * pattern to hide implementation details. The Impl class contains:
+ * - The actual ix::WebSocket instance (from IXWebSocket library)
+ * - Protocol configuration
+ * - State management with mutex and condition variable
+ * - Message router for dispatching to application handlers
+ * - Binary transfer state tracking
+ */
+
+/**
+ * @class WsClient::Impl
+ * @brief Private implementation class containing all WebSocket details.
+ * 
+ * Hidden from public API to avoid exposing IXWebSocket library headers.
+ * Uses Pimpl pattern for cleaner interface and easier maintenance.
+ */
+class WsClient::Impl
+{
+public:
+    /// The underlying IXWebSocket instance from IXWebSocket library
+    ix::WebSocket ws;
+    
+    /// Protocol configuration (timeouts, limits, etc.)
+    Protocol::Config config;
+    
+    /// Current connection state (Disconnected, Connecting, Connected, etc.).
+    /// Atomic so the send fast path and GetState read it lock-free; writes
+    /// still happen under stateMutex so they pair correctly with the
+    /// condition-variable waits in WaitForConnection and Close.
+    std::atomic<ConnectionState> state{ConnectionState::Disconnected};
+    
+    /// Mutex serializing state *transitions* and the associated CV waits
+    /// (WaitForConnection, Close). Plain state reads do not take it.
+    std::mutex stateMutex;
+    
+    /// Mutex protecting binary transfer state variables
+    std::mutex binaryMutex;
+    
+    /// Condition variable for synchronizing state changes (used in WaitForConnection)
+    std::condition_variable stateCV;
+    
+    /// Condition variable for synchronizing shutdown completion
+    std::condition_variable shutdownCV;
+    
+    /// Flag indicating that the WebSocket internal thread has completed shutdown
+    bool shutdownComplete = false;
+    
+    /// Message router for dispatching parsed messages to application handlers
+    MessageRouter messageRouter;
+    
+    /**
+     * @struct BinaryStream
+     * @brief Reassembly state for one in-flight binary transfer.
+     *
+     * Transfers are identified by the msgId of their announcing BinaryStart
+     * message, so the server can pipeline several transfers back-to-back on
+     * one connection without waiting for each to complete.
+     */
+    struct BinaryStream
+    {
+        std::string id;           ///< msgId from the BinaryStart message
+        size_t expectedSize = 0;  ///< Total bytes announced by BinaryStart
+        size_t bytesReceived = 0; ///< Bytes credited to this stream so far
+        bool sinkBound = false;   ///< Whether the registered sink accepted this transfer
+        bool verifyCrc = false;   ///< Whether BinaryStart announced a CRC-32C
+        uint32_t expectedCrc = 0; ///< Announced checksum (valid when verifyCrc)
+        uint32_t crcState = Crc32c::kInitial; ///< Running state, extended per chunk
+
+        // Framed-chunk reassembly (only touched when chunk framing is enabled
+        // and the sender addresses its chunks - see HandleFramedChunk)
+        bool offsetDelivery = false; ///< Commit framed chunks straight to the sink at their offset
+        uint64_t nextOffset = 0;     ///< Next in-order byte offset to commit
+        std::map<uint64_t, std::string> window; ///< Out-of-order chunks awaiting their gap
+        size_t windowBytes = 0;      ///< Bytes buffered in the reorder window
+    };
+
+    /// In-flight binary transfers in announcement order (protected by binaryMutex).
+    /// Raw chunks arrive in wire order with no framing of their own, so they are
+    /// credited to the oldest incomplete stream (FIFO) until it fills.
+    std::deque<BinaryStream> binaryStreams;
+
+    /// Optional streaming destination for binary transfers (null = deliver via handler)
+    BinarySink* binarySink = nullptr;
+
+    /// Last URL passed to Connect - the reconnection engine retries this target
+    std::string lastUrl;
+
+    /// Set while the user is closing intentionally; suppresses reconnection
+    std::atomic<bool> userClosing{false};
+
+    //
+    // Reconnection engine (config.enableAutoReconnect) - event-driven on the
+    // shared TimerWheel; backoff delays and attempt watchdogs are wheel
+    // timers, so no per-client worker thread sleeps them out anymore
+    //
+
+    /// Mutex protecting the reconnection state machine below
+    std::mutex reconnectMutex;
+
+    /// An outage is being worked (set on the first lost signal, cleared on
+    /// recovery, abandonment, or Close)
+    bool reconnectActive = false;
+
+    /// A connection attempt is in flight (ws.start() issued, outcome pending)
+    bool reconnectAttemptInFlight = false;
+
+    /// Bumped on every state-machine transition; a wheel callback that
+    /// captured an older value no-ops, so superseded backoff and watchdog
+    /// timers die stale without racing a Cancel
+    uint64_t reconnectGeneration = 0;
+
+    /// Pending wheel timer - backoff delay or attempt watchdog (0 = none)
+    uint64_t reconnectTimerId = 0;
+
+    /// Attempts made in the current outage
+    int reconnectAttempt = 0;
+
+    /// Current base backoff delay, grown by reconnectBackoffMultiplier
+    double reconnectDelayMs = 0.0;
+
+    /// Jitter source for backoff randomization (protected by reconnectMutex)
+    std::mt19937 reconnectRng{std::random_device{}()};
+
+    /// One-shot callbacks fired on the next settled state transition
+    /// (Connected, Error, or Disconnected) - protected by stateMutex.
+    /// This is what the coroutine connect awaitable resumes on.
+    std::vector<std::function<void(ConnectionState)>> stateSettledCallbacks;
+
+    /**
+     * @brief Fire and clear the pending state-settled callbacks.
+     *
+     * Called from OnOpen/OnClose/OnError after the state write; the callback
+     * list is swapped out under the lock and invoked outside it.
+     */
+    void FireStateSettled(ConnectionState settled)
+    {
+        std::vector<std::function<void(ConnectionState)>> callbacks;
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            callbacks.swap(stateSettledCallbacks);
+        }
+
+        for (auto& callback : callbacks)
+            callback(settled);
+    }
+
+    /**
+     * @brief Check whether the send queue has reached the configured high watermark.
+     *
+     * @return true if a watermark is configured and currently exceeded
+     */
+    bool OverWatermark() const
+    {
+        return config.sendHighWatermarkBytes > 0 &&
+               QueuedSendBytes() >= config.sendHighWatermarkBytes;
+    }
+
+    /**
+     * @brief Total outbound backlog: library send queue plus scheduler bulk queue.
+     */
+    size_t QueuedSendBytes() const
+    {
+        return ws.bufferedAmount() +
+               pendingBulkBytes.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief React to a lost connection (OnClose/OnError, IXWebSocket thread).
+     *
+     * Engages the reconnection engine on a fresh outage, or - when an attempt
+     * is already in flight - records its failure and arms the next backoff.
+     * No-op when auto-reconnect is disabled, the disconnect was
+     * user-initiated, or a backoff timer is already pending (duplicate
+     * signals from OnError-then-OnClose pairs).
+     */
+    void SignalConnectionLost()
+    {
+        if (!config.enableAutoReconnect || userClosing.load(std::memory_order_acquire))
+            return;
+
+        bool abandoned = false;
+        {
+            std::lock_guard<std::mutex> lock(reconnectMutex);
+
+            if (!reconnectActive)
+            {
+                // Fresh outage - reset the backoff schedule and start retrying
+                reconnectActive = true;
+                reconnectAttemptInFlight = false;
+                reconnectAttempt = 0;
+                reconnectDelayMs = static_cast<double>(config.reconnectInitialDelayMs);
+
+                Logger::Instance().Info("WsClient",
+                    "Connection lost - reconnection engine engaged");
+
+                abandoned = !ArmBackoffLocked();
+            }
+            else if (reconnectAttemptInFlight)
+            {
+                // The in-flight attempt just failed - its watchdog is now
+                // stale; back off exponentially up to the cap and rearm
+                reconnectAttemptInFlight = false;
+                ++reconnectGeneration;
+                reconnectDelayMs = std::min(
+                    reconnectDelayMs * config.reconnectBackoffMultiplier,
+                    static_cast<double>(config.reconnectMaxDelayMs));
+
+                abandoned = !ArmBackoffLocked();
+            }
+            // else: a backoff timer is already pending - duplicate signal
+        }
+
+        if (abandoned)
+            ReportReconnectAbandoned();
+    }
+
+    /**
+     * @brief Arm the next jittered backoff timer (reconnectMutex held).
+     *
+     * Delays grow exponentially (reconnectBackoffMultiplier) from
+     * reconnectInitialDelayMs up to reconnectMaxDelayMs, each scaled by a
+     * random jitter factor so a fleet of clients doesn't stampede the server
+     * after a restart.
+     *
+     * @return false when the retry budget is spent - the outage has been
+     *         abandoned and the caller must report it outside the lock
+     */
+    bool ArmBackoffLocked()
+    {
+        ++reconnectAttempt;
+
+        // Bounded retry budget per outage (0 = retry forever)
+        if (config.maxReconnectAttempts > 0 &&
+            reconnectAttempt > config.maxReconnectAttempts)
+        {
+            reconnectActive = false;
+            ++reconnectGeneration;
+            reconnectTimerId = 0;
+            return false;
+        }
+
+        // Jittered wait: scale the delay by a random factor in
+        // [1-jitter, 1+jitter] so clients don't retry in lockstep
+        std::uniform_real_distribution<double> jitter(
+            1.0 - config.reconnectJitterFactor,
+            1.0 + config.reconnectJitterFactor);
+        const uint64_t waitMs = static_cast<uint64_t>(
+            std::max(1.0, reconnectDelayMs * jitter(reconnectRng)));
+
+        Logger::Instance().Debug("WsClient", [this, waitMs] {
+            return "Reconnect attempt " + std::to_string(reconnectAttempt) +
+                   " in " + std::to_string(waitMs) + "ms"; });
+
+        const uint64_t generation = ++reconnectGeneration;
+        reconnectTimerId = TimerWheel::Instance().Schedule(waitMs,
+            [this, generation] { OnReconnectBackoffExpired(generation); });
+        return true;
+    }
+
+    /// @brief Log and route the abandonment of an outage (no locks held)
+    void ReportReconnectAbandoned()
+    {
+        Logger::Instance().Error("WsClient",
+            "Reconnection abandoned after " +
+            std::to_string(config.maxReconnectAttempts) + " attempts");
+        messageRouter.RouteProtocolError(
+            "Automatic reconnection failed after " +
+            std::to_string(config.maxReconnectAttempts) + " attempts");
+    }
+
+    /**
+     * @brief Backoff expired (wheel thread) - launch the next attempt.
+     *
+     * The same ix::WebSocket instance and URL are reused across attempts, so
+     * there is no per-attempt object teardown or network-system
+     * re-initialization; name resolution is left to the OS resolver cache
+     * (IXWebSocket does not expose its resolver). The whole body runs under
+     * reconnectMutex so StopReconnect can never observe a half-launched
+     * attempt.
+     */
+    void OnReconnectBackoffExpired(uint64_t pGeneration)
+    {
+        std::lock_guard<std::mutex> lock(reconnectMutex);
+
+        // Stale timer (superseded transition or Close ran), or the user is
+        // closing and the attempt must not fight the shutdown
+        if (pGeneration != reconnectGeneration || !reconnectActive ||
+            userClosing.load(std::memory_order_acquire))
+            return;
+
+        // Stale outage - the connection may have already recovered
+        if (state.load(std::memory_order_acquire) == ConnectionState::Connected)
+        {
+            reconnectActive = false;
+            ++reconnectGeneration;
+            reconnectTimerId = 0;
+            return;
+        }
+
+        // Transition back to Connecting and restart the same socket
+        {
+            std::lock_guard<std::mutex> stateLock(stateMutex);
+            state = ConnectionState::Connecting;
+        }
+        ws.start();
+
+        // Arm the attempt watchdog: OnError/OnClose normally report failure
+        // first, but this bounds attempts that hang in connect (unreachable
+        // hosts swallowing SYNs)
+        reconnectAttemptInFlight = true;
+        const uint64_t generation = ++reconnectGeneration;
+        reconnectTimerId = TimerWheel::Instance().Schedule(
+            static_cast<uint64_t>(config.connectionTimeoutMs),
+            [this, generation] { OnReconnectAttemptTimeout(generation); });
+    }
+
+    /**
+     * @brief Attempt watchdog fired (wheel thread) - treat as a failed attempt.
+     */
+    void OnReconnectAttemptTimeout(uint64_t pGeneration)
+    {
+        bool abandoned = false;
+        {
+            std::lock_guard<std::mutex> lock(reconnectMutex);
+
+            if (pGeneration != reconnectGeneration || !reconnectActive ||
+                userClosing.load(std::memory_order_acquire))
+                return;
+
+            // Attempt failed - back off exponentially up to the cap
+            reconnectAttemptInFlight = false;
+            reconnectDelayMs = std::min(
+                reconnectDelayMs * config.reconnectBackoffMultiplier,
+                static_cast<double>(config.reconnectMaxDelayMs));
+
+            abandoned = !ArmBackoffLocked();
+        }
+
+        if (abandoned)
+            ReportReconnectAbandoned();
+    }
+
+    /**
+     * @brief Connection restored (OnOpen) - resolve the outage and notify.
+     *
+     * No-op on an ordinary first connect; during an outage it retires the
+     * pending watchdog/backoff timer and tells the application to restore
+     * its session.
+     */
+    void OnConnectionRestored()
+    {
+        int attempt = 0;
+        uint64_t pending = 0;
+        {
+            std::lock_guard<std::mutex> lock(reconnectMutex);
+
+            if (!reconnectActive)
+                return;
+
+            reconnectActive = false;
+            reconnectAttemptInFlight = false;
+            ++reconnectGeneration;
+            pending = reconnectTimerId;
+            reconnectTimerId = 0;
+            attempt = reconnectAttempt;
+        }
+
+        // Cancel outside the lock - it may wait out an in-flight callback,
+        // and those take reconnectMutex themselves
+        if (pending)
+            TimerWheel::Instance().Cancel(pending);
+
+        Logger::Instance().Info("WsClient",
+            "Reconnected on attempt " + std::to_string(attempt));
+        messageRouter.RouteReconnected(attempt);
+    }
+
+    /**
+     * @brief Disarm the reconnection engine (Close and destructor).
+     *
+     * Leaves the state machine idle so a later Connect() starts fresh. After
+     * this returns no reconnect timer is armed and no callback is in flight
+     * (Cancel waits out a running one).
+     */
+    void StopReconnect()
+    {
+        uint64_t pending = 0;
+        {
+            std::lock_guard<std::mutex> lock(reconnectMutex);
+            reconnectActive = false;
+            reconnectAttemptInFlight = false;
+            ++reconnectGeneration;
+            pending = reconnectTimerId;
+            reconnectTimerId = 0;
+        }
+
+        // Cancel outside the lock - it may wait out an in-flight callback,
+        // and those take reconnectMutex themselves
+        if (pending)
+            TimerWheel::Instance().Cancel(pending);
+    }
+
+    /// Reset binary transfer state (call when connection closes)
+    void ResetBinaryState()
+    {
+        std::lock_guard<std::mutex> lock(binaryMutex);
+
+        // A sink with an incomplete transfer must be told it was cut short so
+        // it can clean up partial output
+        if (!binaryStreams.empty() && binaryStreams.front().sinkBound && binarySink)
+            binarySink->OnAbort("connection closed with transfer in flight");
+
+        binaryStreams.clear();
+    }
+
+    //
+    // Stats engine (always on - counters are relaxed atomics)
+    //
+
+    /**
+     * @struct LatencyHistogram
+     * @brief HDR-style microsecond histogram: log2 major buckets with 4 linear
+     *        sub-buckets each (~25% value resolution), all lock-free atomics.
+     *
+     * 128 buckets cover 0us to ~71 minutes, so any realistic round trip lands
+     * in a bucket without clamping. Recording is one relaxed fetch_add plus
+     * min/max maintenance; snapshots walk the fixed array.
+     */
+    struct LatencyHistogram
+    {
+        static constexpr size_t kBucketCount = 128;
+
+        std::atomic<uint64_t> buckets[kBucketCount] = {};
+        std::atomic<uint64_t> sampleCount{0};
+        std::atomic<uint64_t> minUs{UINT64_MAX};
+        std::atomic<uint64_t> maxUs{0};
+
+        /// @brief Map a microsecond value to its bucket index
+        static size_t BucketIndex(uint64_t us)
+        {
+            // Values 0..3 get exact buckets; above that, the top two bits
+            // after the leading one select the sub-bucket
+            if (us < 4)
+                return static_cast<size_t>(us);
+
+            const int major = std::bit_width(us) - 1;  // floor(log2(us)), >= 2
+            const size_t minor = static_cast<size_t>((us >> (major - 2)) & 3);
+            const size_t index = (static_cast<size_t>(major) - 1) * 4 + minor;
+            return (index < kBucketCount) ? index : (kBucketCount - 1);
+        }
+
+        /// @brief Lower bound of the value range a bucket represents
+        static uint64_t BucketValue(size_t index)
+        {
+            if (index < 4)
+                return static_cast<uint64_t>(index);
+
+            const uint64_t major = index / 4 + 1;
+            const uint64_t minor = index % 4;
+            return (1ULL << major) + (minor << (major - 2));
+        }
+
+        /// @brief Record one sample (relaxed atomics throughout)
+        void Record(uint64_t us)
+        {
+            buckets[BucketIndex(us)].fetch_add(1, std::memory_order_relaxed);
+            sampleCount.fetch_add(1, std::memory_order_relaxed);
+
+            // min/max via CAS loops - contention is negligible at sample rates
+            uint64_t observed = minUs.load(std::memory_order_relaxed);
+            while (us < observed &&
+                   !minUs.compare_exchange_weak(observed, us, std::memory_order_relaxed))
+            {
+            }
+            observed = maxUs.load(std::memory_order_relaxed);
+            while (us > observed &&
+                   !maxUs.compare_exchange_weak(observed, us, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        /// @brief Extract count/min/percentiles/max as a snapshot
+        LatencyStats Snapshot() const
+        {
+            LatencyStats stats;
+            stats.count = sampleCount.load(std::memory_order_relaxed);
+            if (stats.count == 0)
+                return stats;
+
+            stats.minUs = minUs.load(std::memory_order_relaxed);
+            stats.maxUs = maxUs.load(std::memory_order_relaxed);
+
+            // Walk the buckets once, picking off percentile targets as the
+            // cumulative count crosses them
+            const uint64_t target50 = (stats.count + 1) / 2;
+            const uint64_t target99 = (stats.count * 99 + 99) / 100;
+            uint64_t cumulative = 0;
+            bool have50 = false;
+
+            for (size_t i = 0; i < kBucketCount; ++i)
+            {
+                cumulative += buckets[i].load(std::memory_order_relaxed);
+                if (!have50 && cumulative >= target50)
+                {
+                    stats.p50Us = BucketValue(i);
+                    have50 = true;
+                }
+                if (cumulative >= target99)
+                {
+                    stats.p99Us = BucketValue(i);
+                    break;
+                }
+            }
+            return stats;
+        }
+    };
+
+    /// Frames accepted by Send* calls
+    std::atomic<uint64_t> statMessagesSent{0};
+
+    /// Payload bytes accepted by Send* calls
+    std::atomic<uint64_t> statBytesSent{0};
+
+    /// Frames delivered to OnMessage
+    std::atomic<uint64_t> statMessagesReceived{0};
+
+    /// Payload bytes delivered to OnMessage
+    std::atomic<uint64_t> statBytesReceived{0};
+
+    /// Sends refused by the state check or watermark
+    std::atomic<uint64_t> statSendsRejected{0};
+
+    /// Tracked-send to Acknowledge round trips
+    LatencyHistogram sendAckHistogram;
+
+    /// SendPing to pong round trips
+    LatencyHistogram pingPongHistogram;
+
+    /// Steady-clock microseconds of the last outstanding SendPing (0 = none)
+    std::atomic<int64_t> lastPingSentUs{0};
+
+    /// @brief Steady clock now, in microseconds (histogram time base)
+    static int64_t NowUs()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    /// @brief Count one accepted outbound frame
+    void CountSend(size_t bytes)
+    {
+        statMessagesSent.fetch_add(1, std::memory_order_relaxed);
+        statBytesSent.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    //
+    // Compression policy engine (config.enableAdaptiveCompression + hints)
+    //
+
+    /// Mirrors the library's deflate toggle so redundant flips are skipped
+    std::atomic<bool> compressionActive{false};
+
+    //
+    // Compact binary protocol mode (config.enableBinaryProtocol)
+    //
+
+    /// Whether binary control-message encoding was negotiated with the peer
+    /// via a 2.x Hello exchange. Reset to false on every disconnect - each
+    /// connection renegotiates from the JSON default.
+    std::atomic<bool> binaryProtocolActive{false};
+
+    /**
+     * @brief Sampled Shannon entropy of a payload, in bits per byte.
+     *
+     * Reads at most the first 4KB - enough to separate JSON from ciphertext,
+     * cheap enough for the send path.
+     */
+    static double EstimateEntropy(const void* data, size_t size)
+    {
+        const size_t sampleSize = size < 4096 ? size : 4096;
+        if (sampleSize == 0)
+            return 0.0;
+
+        uint32_t histogram[256] = {};
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < sampleSize; ++i)
+            ++histogram[bytes[i]];
+
+        double entropy = 0.0;
+        const double total = static_cast<double>(sampleSize);
+        for (int i = 0; i < 256; ++i)
+        {
+            if (histogram[i] == 0)
+                continue;
+            const double p = static_cast<double>(histogram[i]) / total;
+            entropy -= p * std::log2(p);
+        }
+        return entropy;
+    }
+
+    /**
+     * @brief Decide whether a payload should go out compressed.
+     *
+     * Explicit hints win; Default defers to the adaptive classifier (size
+     * threshold, then entropy estimate) or to the current toggle state when
+     * adaptive mode is off.
+     */
+    bool DecideCompression(Protocol::CompressionHint hint,
+                           const void* data, size_t size)
+    {
+        if (hint == Protocol::CompressionHint::Always)
+            return true;
+        if (hint == Protocol::CompressionHint::Never)
+            return false;
+
+        if (!config.enableAdaptiveCompression)
+            return compressionActive.load(std::memory_order_relaxed);
+
+        // Tiny payloads: deflate headers + CPU cost exceed the savings
+        if (size < config.compressionMinSizeBytes)
+            return false;
+
+        // High-entropy payloads are already compressed (or encrypted) -
+        // deflate only burns CPU and can even grow them
+        const double entropy = EstimateEntropy(data, size);
+        const bool compress = entropy <= config.compressionMaxEntropyBitsPerByte;
+
+        Logger::Instance().Debug("WsClient", [entropy, compress, size] {
+            return "[COMPRESS] " + std::to_string(size) + " bytes, entropy " +
+                   std::to_string(entropy) + " b/B -> " +
+                   (compress ? "compress" : "raw"); });
+        return compress;
+    }
+
+    /**
+     * @brief Flip the library's deflate toggle if the decision changed it.
+     *
+     * @warning Deflate must have been negotiated at the handshake for the
+     *          toggle to affect the wire; against servers that refused it
+     *          this is a recorded no-op.
+     */
+    void ApplyCompressionDecision(bool compress)
+    {
+        if (compressionActive.exchange(compress, std::memory_order_relaxed) == compress)
+            return;
+
+        if (compress)
+            ws.enablePerMessageDeflate();
+        else
+            ws.disablePerMessageDeflate();
+
+        Logger::Instance().Debug("WsClient", [compress] {
+            return std::string("[COMPRESS] deflate ") + (compress ? "on" : "off"); });
+    }
+
+    /**
+     * @brief Run the policy for one payload, skipping the no-policy fast path.
+     *
+     * With a Default hint and adaptive mode off there is nothing to decide -
+     * the static toggle stays wherever EnableCompression left it - so the
+     * send paths pay only this branch.
+     */
+    void MaybeApplyCompressionPolicy(Protocol::CompressionHint hint,
+                                     const void* data, size_t size)
+    {
+        if (hint == Protocol::CompressionHint::Default &&
+            !config.enableAdaptiveCompression)
+            return;
+
+        ApplyCompressionDecision(DecideCompression(hint, data, size));
+    }
+
+    //
+    // Traffic capture (StartRecording / StopRecording)
+    //
+
+    /// Set while a capture log is open - the hot paths check only this flag
+    std::atomic<bool> recordingEnabled{false};
+
+    /// The active capture log, shared with any thread mid-record
+    /// (protected by recorderMutex)
+    std::shared_ptr<TrafficRecorder> recorder;
+
+    /// Protects the recorder pointer itself; Record calls run outside it
+    std::mutex recorderMutex;
+
+    /**
+     * @brief Append one frame to the capture log, if recording is active.
+     *
+     * A single relaxed load when recording is off, so the hooks on the send
+     * and receive paths cost nothing in the common case.
+     */
+    void RecordFrame(TrafficRecorder::Direction direction, bool isBinary,
+                     const void* data, size_t size)
+    {
+        if (!recordingEnabled.load(std::memory_order_acquire))
+            return;
+
+        std::shared_ptr<TrafficRecorder> active;
+        {
+            std::lock_guard<std::mutex> lock(recorderMutex);
+            active = recorder;
+        }
+
+        if (active)
+            active->Record(direction, isBinary, data, size);
+    }
+
+    //
+    // Heartbeat (interval = config.pingIntervalSeconds) - a repeating wheel
+    // timer sends either plain keepalives or, with config.enableRttProbe,
+    // sequence-numbered probes that feed the RTT histogram
+    //
+
+    /// Monotonic sequence number embedded in probe ping payloads
+    std::atomic<uint64_t> pingSequence{0};
+
+    /// Outstanding probes: sequence -> send time in steady microseconds
+    /// (protected by pingMutex)
+    std::unordered_map<uint64_t, int64_t> pendingPings;
+
+    /// Mutex protecting the outstanding-probe table
+    std::mutex pingMutex;
+
+    /// Repeating wheel timer driving the heartbeat (0 = not armed; only
+    /// touched from Connect/Close, which follow the single-caller rules)
+    uint64_t pingTimerId = 0;
+
+    /// Probe payloads are "rtt:<sequence>" - well inside the 125-byte limit
+    static constexpr const char* kRttPayloadPrefix = "rtt:";
+
+    /**
+     * @brief Send one sequence-numbered probe ping and register its timestamp.
+     */
+    void SendRttProbe()
+    {
+        const uint64_t sequence = pingSequence.fetch_add(1, std::memory_order_relaxed) + 1;
+        const int64_t sentUs = NowUs();
+
+        {
+            std::lock_guard<std::mutex> lock(pingMutex);
+            pendingPings[sequence] = sentUs;
+
+            // Drop probes whose pongs never came back (lost frames or a
+            // server that doesn't echo payloads) so the table stays bounded
+            const int64_t staleUs = sentUs -
+                static_cast<int64_t>(config.messageTimeoutMs) * 2000;
+            for (auto it = pendingPings.begin(); it != pendingPings.end();)
+            {
+                if (it->second < staleUs)
+                    it = pendingPings.erase(it);
+                else
+                    ++it;
+            }
+        }
+
+        std::string payload = kRttPayloadPrefix + std::to_string(sequence);
+        if (config.enablePrioritySend)
+            EnqueueControl(true, std::move(payload));
+        else
+            ws.ping(payload);
+
+        Logger::Instance().Debug("WsClient", [sequence] {
+            return "[SEND][PING][RTT] seq=" + std::to_string(sequence); });
+    }
+
+    /**
+     * @brief Send a plain keepalive ping (no RTT sequence, no bookkeeping).
+     *
+     * Replaces the library's setPingInterval heartbeat so the interval is
+     * driven by the shared timer wheel instead of a per-connection timer.
+     */
+    void SendKeepalivePing()
+    {
+        if (config.enablePrioritySend)
+            EnqueueControl(true, std::string());
+        else
+            ws.ping(std::string());
+
+        Logger::Instance().Debug("WsClient", "[SEND][PING][KEEPALIVE]");
+    }
+
+    /**
+     * @brief Match a pong payload back to its probe and record the round trip.
+     *
+     * Probe pongs carry the echoed "rtt:<sequence>" payload; anything else
+     * falls back to the single-outstanding SendPing measurement.
+     */
+    void HandlePong(const std::string& payload)
+    {
+        const size_t prefixLen = 4;  // strlen(kRttPayloadPrefix)
+        if (payload.compare(0, prefixLen, kRttPayloadPrefix) == 0)
+        {
+            uint64_t sequence = 0;
+            const char* first = payload.data() + prefixLen;
+            const char* last = payload.data() + payload.size();
+            if (std::from_chars(first, last, sequence).ec == std::errc())
+            {
+                int64_t sentUs = 0;
+                {
+                    std::lock_guard<std::mutex> lock(pingMutex);
+                    auto it = pendingPings.find(sequence);
+                    if (it != pendingPings.end())
+                    {
+                        sentUs = it->second;
+                        pendingPings.erase(it);
+                    }
+                }
+
+                if (sentUs != 0)
+                {
+                    pingPongHistogram.Record(static_cast<uint64_t>(NowUs() - sentUs));
+                    return;
+                }
+            }
+            // Unmatched or malformed probe payload - fall through to legacy
+        }
+
+        // Legacy single-outstanding SendPing measurement
+        const int64_t sentUs = lastPingSentUs.exchange(0, std::memory_order_relaxed);
+        if (sentUs != 0)
+            pingPongHistogram.Record(static_cast<uint64_t>(NowUs() - sentUs));
+    }
+
+    /**
+     * @brief Disarm the heartbeat timer, clearing outstanding probes.
+     *
+     * After this returns no heartbeat callback is in flight (Cancel waits
+     * out a running one), so the probe table can be cleared safely.
+     */
+    void StopPingTimer()
+    {
+        if (pingTimerId != 0)
+        {
+            TimerWheel::Instance().Cancel(pingTimerId);
+            pingTimerId = 0;
+        }
+
+        std::lock_guard<std::mutex> lock(pingMutex);
+        pendingPings.clear();
+    }
+
+    //
+    // Acknowledgment window engine (config.ackWindowSize > 0)
+    //
+
+    /**
+     * @struct PendingAck
+     * @brief One tracked in-flight message awaiting its Acknowledge.
+     */
+    struct PendingAck
+    {
+        std::string payload;                            ///< Original frame, kept for retransmits
+        std::chrono::steady_clock::time_point deadline; ///< When the timeout expires
+        std::chrono::steady_clock::time_point sendTime; ///< First send - basis of the send-to-ack sample
+        int retransmits = 0;                            ///< Resends performed so far
+        int timeoutMs = 0;                              ///< Per-entry timeout (0 = config.messageTimeoutMs)
+    };
+
+    /// In-flight tracked messages keyed by msgId (protected by ackMutex)
+    std::unordered_map<std::string, PendingAck> pendingAcks;
+
+    /// One-shot completion callbacks keyed by msgId (protected by ackMutex).
+    /// Invoked with true when the ack arrives, false on timeout or shutdown -
+    /// this is what the coroutine send-with-ack awaitable resumes on.
+    std::unordered_map<std::string, std::function<void(bool)>> ackContinuations;
+
+    /// Mutex protecting the ack window
+    mutable std::mutex ackMutex;
+
+    /// Signaled when window space frees up (ack arrived or entry timed out)
+    std::condition_variable ackCV;
+
+    /// Set while the ack engine is being stopped (Close and destructor) -
+    /// fails blocked window waiters and keeps the sweep from rearming
+    bool ackShutdown = false;
+
+    /// Pending deadline-sweep wheel timer (protected by ackMutex; 0 = idle).
+    /// Armed on demand when a tracked send registers and disarms itself when
+    /// the window empties, so an idle client costs no wakeups at all.
+    uint64_t ackSweepTimerId = 0;
+
+    /// Sweep granularity - bounds deadline slack well below any sane
+    /// messageTimeoutMs
+    static constexpr uint64_t kAckSweepIntervalMs = 50;
+
+    /**
+     * @brief Hand a text frame to whichever send path is active.
+     *
+     * Retransmits must take the same route as first sends so the priority
+     * scheduler's ordering guarantees hold for them too.
+     */
+    void SendTextFrame(std::string&& payload)
+    {
+        RecordFrame(TrafficRecorder::Direction::Outbound, false,
+                    payload.data(), payload.size());
+
+        if (config.enablePrioritySend)
+            EnqueueControl(false, std::move(payload));
+        else
+            ws.sendText(std::move(payload));
+    }
+
+    /**
+     * @brief Retire a tracked message when its Acknowledge arrives.
+     *
+     * Called from the receive path for every Acknowledge message; cheap
+     * no-op when the id isn't tracked (e.g. unsolicited acks).
+     */
+    void CompleteAck(const std::string& msgId)
+    {
+        bool found = false;
+        std::function<void(bool)> continuation;
+        {
+            std::lock_guard<std::mutex> lock(ackMutex);
+
+            auto entry = pendingAcks.find(msgId);
+            if (entry != pendingAcks.end())
+            {
+                found = true;
+
+                // Send-to-ack latency sample (retransmitted messages measure
+                // from the first send, which is what the application felt)
+                const auto elapsed = std::chrono::steady_clock::now() -
+                                     entry->second.sendTime;
+                sendAckHistogram.Record(static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+                        .count()));
+
+                pendingAcks.erase(entry);
+            }
+
+            auto it = ackContinuations.find(msgId);
+            if (it != ackContinuations.end())
+            {
+                continuation = std::move(it->second);
+                ackContinuations.erase(it);
+            }
+        }
+
+        if (found)
+        {
+            // Window space freed - wake blocked SendTextWithAck callers
+            ackCV.notify_all();
+            messageRouter.RouteMessageAcked(msgId);
+        }
+
+        // Resume any awaiting coroutine outside the lock (success)
+        if (continuation)
+            continuation(true);
+    }
+
+    /**
+     * @brief Arm the deadline sweep if it isn't already pending (ackMutex held).
+     *
+     * Called whenever a tracked send registers; the sweep keeps rescheduling
+     * itself while anything is in flight and goes quiet when the window
+     * empties.
+     */
+    void ArmAckSweepLocked()
+    {
+        if (ackSweepTimerId != 0 || ackShutdown)
+            return;
+
+        ackSweepTimerId = TimerWheel::Instance().Schedule(kAckSweepIntervalMs,
+            [this] { AckSweep(); });
+    }
+
+    /**
+     * @brief Stop the deadline sweep, dropping tracked entries.
+     */
+    void StopAckTimer()
+    {
+        uint64_t pending = 0;
+        {
+            std::lock_guard<std::mutex> lock(ackMutex);
+            ackShutdown = true;
+            pending = ackSweepTimerId;
+            ackSweepTimerId = 0;
+        }
+        ackCV.notify_all();
+
+        // Cancel outside ackMutex - it may wait out an in-flight sweep, and
+        // the sweep takes ackMutex itself
+        if (pending)
+            TimerWheel::Instance().Cancel(pending);
+
+        std::vector<std::function<void(bool)>> abandoned;
+        {
+            std::lock_guard<std::mutex> lock(ackMutex);
+            ackShutdown = false;
+
+            if (!pendingAcks.empty())
+            {
+                Logger::Instance().Warning("WsClient",
+                    "Ack window stopped with " + std::to_string(pendingAcks.size()) +
+                    " messages still unacknowledged");
+                pendingAcks.clear();
+            }
+
+            for (auto& entry : ackContinuations)
+                abandoned.push_back(std::move(entry.second));
+            ackContinuations.clear();
+        }
+
+        // Awaiting coroutines must not hang across a Close - resolve as failed
+        for (auto& continuation : abandoned)
+            continuation(false);
+    }
+
+    /**
+     * @brief One deadline sweep (wheel thread) - enforces messageTimeoutMs
+     *        per tracked message.
+     *
+     * Expired entries are retransmitted through the regular send path (with
+     * the deadline rearmed) until maxRetransmits is spent, then dropped and
+     * reported via OnMessageTimeout. Reschedules itself at
+     * kAckSweepIntervalMs while anything is still tracked.
+     */
+    void AckSweep()
+    {
+        // Retransmit and failure lists are built under the lock but
+        // dispatched outside it - sends and callbacks must not hold it
+        std::vector<std::pair<std::string, std::string>> retransmits;  // (msgId, payload)
+        std::vector<int> retransmitAttempts;
+        std::vector<std::string> failures;
+        std::vector<std::function<void(bool)>> failedContinuations;
+
+        {
+            std::lock_guard<std::mutex> lock(ackMutex);
+
+            if (ackShutdown)
+            {
+                ackSweepTimerId = 0;
+                return;
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+            for (auto it = pendingAcks.begin(); it != pendingAcks.end();)
+            {
+                if (it->second.deadline > now)
+                {
+                    ++it;
+                    continue;
+                }
+
+                if (it->second.retransmits < config.maxRetransmits)
+                {
+                    // Rearm and schedule a resend of the original frame
+                    ++it->second.retransmits;
+                    const int timeoutMs = (it->second.timeoutMs > 0)
+                                              ? it->second.timeoutMs
+                                              : config.messageTimeoutMs;
+                    it->second.deadline = now +
+                        std::chrono::milliseconds(timeoutMs);
+                    retransmits.emplace_back(it->first, it->second.payload);
+                    retransmitAttempts.push_back(it->second.retransmits);
+                    ++it;
+                }
+                else
+                {
+                    // Budget spent - drop the entry and report failure
+                    failures.push_back(it->first);
+
+                    auto cont = ackContinuations.find(it->first);
+                    if (cont != ackContinuations.end())
+                    {
+                        failedContinuations.push_back(std::move(cont->second));
+                        ackContinuations.erase(cont);
+                    }
+
+                    it = pendingAcks.erase(it);
+                }
+            }
+
+            // Rearm while anything is still tracked; otherwise go quiet until
+            // the next tracked send arms the sweep again
+            ackSweepTimerId = pendingAcks.empty()
+                ? 0
+                : TimerWheel::Instance().Schedule(kAckSweepIntervalMs,
+                      [this] { AckSweep(); });
+        }
+
+        for (size_t i = 0; i < retransmits.size(); ++i)
+        {
+            SendTextFrame(std::string(retransmits[i].second));
+            messageRouter.RouteMessageRetransmit(retransmits[i].first,
+                                                 retransmitAttempts[i]);
+        }
+
+        for (const std::string& msgId : failures)
+            messageRouter.RouteMessageTimeout(msgId);
+
+        // Resume awaiting coroutines outside the lock (failure)
+        for (auto& continuation : failedContinuations)
+            continuation(false);
+
+        // Dropped entries freed window space
+        if (!failures.empty())
+            ackCV.notify_all();
+    }
+
+    //
+    // Priority send scheduler (config.enablePrioritySend)
+    //
+
+    /**
+     * @struct ControlFrame
+     * @brief High-priority outbound frame (protocol text or ping).
+     */
+    struct ControlFrame
+    {
+        bool isPing = false;  ///< true = WebSocket ping frame, false = text frame
+        std::string payload;  ///< Frame payload
+    };
+
+    /**
+     * @struct BulkFrame
+     * @brief Low-priority bulk binary payload, sent chunk by chunk.
+     */
+    struct BulkFrame
+    {
+        std::string payload;  ///< Full binary payload
+        size_t offset = 0;    ///< Bytes already handed to the socket
+        bool whole = false;   ///< Send in one piece (framed chunks must stay intact)
+    };
+
+    /// High-priority queue - drained completely before every bulk chunk
+    std::deque<ControlFrame> controlQueue;
+
+    /// Bulk queue - front payload is chopped into priorityChunkSizeBytes pieces
+    std::deque<BulkFrame> bulkQueue;
+
+    /// Mutex protecting both scheduler queues
+    std::mutex sendMutex;
+
+    /// Wakes the sender thread when either queue gains work (or on shutdown)
+    std::condition_variable sendCV;
+
+    /// Set to stop the sender thread (Close and destructor)
+    bool senderShutdown = false;
+
+    /// Dedicated sender thread (started on Connect when the scheduler is enabled)
+    std::thread senderThread;
+
+    /// Bytes sitting in the bulk queue, not yet handed to the socket.
+    /// Folded into GetBufferedAmount so backpressure sees scheduler backlog too.
+    std::atomic<size_t> pendingBulkBytes{0};
+
+    /**
+     * @brief Queue a high-priority control frame (text or ping) for sending.
+     */
+    void EnqueueControl(bool isPing, std::string&& payload)
+    {
+        {
+            std::lock_guard<std::mutex> lock(sendMutex);
+            controlQueue.push_back(ControlFrame{isPing, std::move(payload)});
+        }
+        sendCV.notify_one();
+    }
+
+    /**
+     * @brief Queue a bulk binary payload; the sender chops it into chunks.
+     */
+    void EnqueueBulk(std::string&& payload, bool whole = false)
+    {
+        pendingBulkBytes.fetch_add(payload.size(), std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(sendMutex);
+            bulkQueue.push_back(BulkFrame{std::move(payload), 0, whole});
+        }
+        sendCV.notify_one();
+    }
+
+    /**
+     * @brief Stop and join the sender thread, dropping anything still queued.
+     */
+    void StopSenderThread()
+    {
+        {
+            std::lock_guard<std::mutex> lock(sendMutex);
+            senderShutdown = true;
+        }
+        sendCV.notify_all();
+
+        if (senderThread.joinable())
+            senderThread.join();
+
+        {
+            std::lock_guard<std::mutex> lock(sendMutex);
+            senderShutdown = false;
+
+            const size_t dropped = controlQueue.size() + bulkQueue.size();
+            if (dropped > 0)
+            {
+                Logger::Instance().Warning("WsClient",
+                    "Priority scheduler stopped with " + std::to_string(dropped) +
+                    " frames still queued (dropped)");
+            }
+            controlQueue.clear();
+            bulkQueue.clear();
+            pendingBulkBytes.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Sender thread body - strict priority with bulk chunk interleaving.
+     *
+     * The control queue is drained completely before each bulk chunk, so a
+     * control frame waits at most one chunk's worth of transmission (plus
+     * whatever the library has already buffered) - with the default 64KB
+     * chunks that keeps ack/heartbeat latency in the low milliseconds even
+     * during a 100MB push.
+     */
+    void SenderLoop()
+    {
+        Logger::Instance().Debug("WsClient", "Priority sender started");
+
+        while (true)
+        {
+            std::unique_lock<std::mutex> lock(sendMutex);
+            sendCV.wait(lock, [this] {
+                return senderShutdown || !controlQueue.empty() || !bulkQueue.empty();
+            });
+
+            if (senderShutdown)
+                break;
+
+            // Control frames always go first, all of them
+            while (!controlQueue.empty())
+            {
+                ControlFrame frame = std::move(controlQueue.front());
+                controlQueue.pop_front();
+                lock.unlock();
+
+                if (frame.isPing)
+                    ws.ping(frame.payload);
+                else
+                    ws.sendText(std::move(frame.payload));
+
+                lock.lock();
+            }
+
+            // Then exactly one chunk of the oldest bulk payload, so freshly
+            // queued control frames get another chance before the next chunk
+            if (!bulkQueue.empty())
+            {
+                BulkFrame& front = bulkQueue.front();
+                const size_t remaining = front.payload.size() - front.offset;
+                // Framed chunks carry their own addressing header and must
+                // reach the wire as one WebSocket message - never re-chopped
+                const size_t chunkSize =
+                    (front.whole || remaining < config.priorityChunkSizeBytes)
+                        ? remaining
+                        : config.priorityChunkSizeBytes;
+
+                std::string chunk = front.payload.substr(front.offset, chunkSize);
+                front.offset += chunkSize;
+
+                const bool payloadDone = (front.offset >= front.payload.size());
+                if (payloadDone)
+                    bulkQueue.pop_front();
+
+                lock.unlock();
+
+                ws.sendBinary(std::move(chunk));
+                pendingBulkBytes.fetch_sub(chunkSize, std::memory_order_relaxed);
+            }
+        }
+
+        Logger::Instance().Debug("WsClient", "Priority sender stopped");
+    }
+};
+
+namespace
+{
+    /**
+     * @brief One-time process-wide network system initialization.
+     *
+     * ix::initNetSystem is idempotent but serializes on platform init (WSA
+     * startup on Windows); with hundreds of clients opening at startup that
+     * serialization adds up. std::call_once runs it exactly once per process
+     * and every caller reuses the cached result.
+     *
+     * @return true if the network system is initialized
+     */
+    bool EnsureNetSystemInitialized()
+    {
+        static std::once_flag initFlag;
+        static bool initResult = false;
+        std::call_once(initFlag, [] { initResult = ix::initNetSystem(); });
+        return initResult;
+    }
+
+    /**
+     * @brief Split a ws://host:port/path URL into host and port strings.
+     *
+     * Defaults the port from the scheme (80 for ws, 443 for wss) when the
+     * URL does not carry one explicitly.
+     *
+     * @param pUrl WebSocket URL
+     * @param pHost Receives the hostname
+     * @param pPort Receives the port as a decimal string (getaddrinfo form)
+     * @return true if the URL had a recognizable scheme and non-empty host
+     */
+    bool ParseWsUrl(const std::string& pUrl, std::string& pHost, std::string& pPort)
+    {
+        std::string defaultPort;
+        size_t hostStart = 0;
+        if (pUrl.rfind("ws://", 0) == 0)
+        {
+            hostStart = 5;
+            defaultPort = "80";
+        }
+        else if (pUrl.rfind("wss://", 0) == 0)
+        {
+            hostStart = 6;
+            defaultPort = "443";
+        }
+        else
+        {
+            return false;
+        }
+
+        const size_t hostEnd = pUrl.find_first_of(":/", hostStart);
+        pHost = pUrl.substr(hostStart,
+            (hostEnd == std::string::npos) ? std::string::npos : hostEnd - hostStart);
+        if (pHost.empty())
+            return false;
+
+        if (hostEnd != std::string::npos && pUrl[hostEnd] == ':')
+        {
+            const size_t portEnd = pUrl.find('/', hostEnd + 1);
+            pPort = pUrl.substr(hostEnd + 1,
+                (portEnd == std::string::npos) ? std::string::npos : portEnd - hostEnd - 1);
+            if (pPort.empty())
+                pPort = defaultPort;
+        }
+        else
+        {
+            pPort = defaultPort;
+        }
+        return true;
+    }
+}
+
+WsClient::WsClient(const Protocol::Config& config)
+    : mImpl(std::make_unique<Impl>())
+{
+    // Store the configuration in the implementation
+    mImpl->config = config;
+    
+    Logger::Instance().Debug("WsClient", 
+        "WebSocket client created - timeout=" + 
+        std::to_string(config.connectionTimeoutMs) + "ms");
+}
+
+WsClient::~WsClient()
+{
+    // Ensure connection is closed before destroying
+    Close();
+    
+    Logger::Instance().Debug("WsClient", "WebSocket client destroyed");
+}
+
+bool WsClient::Prewarm(const std::string& pUrl, bool pEstablishTcp)
+{
+    // Prewarm implies the process-wide init - do it here so a warmed process
+    // never pays it again in Open()
+    if (!EnsureNetSystemInitialized())
+    {
+        Logger::Instance().Error("WsClient",
+            "Prewarm: failed to initialize network system");
+        return false;
+    }
+
+    std::string host;
+    std::string port;
+    if (!ParseWsUrl(pUrl, host, port))
+    {
+        Logger::Instance().Error("WsClient", "Prewarm: unparseable URL: " + pUrl);
+        return false;
+    }
+
+    // Resolve the hostname - this primes the OS resolver cache, which is
+    // where the bulk of a cold Connect's time goes
+    addrinfo hints = {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* results = nullptr;
+    const int rc = ::getaddrinfo(host.c_str(), port.c_str(), &hints, &results);
+    if (rc != 0 || !results)
+    {
+        Logger::Instance().Warning("WsClient",
+            "Prewarm: DNS resolution failed for " + host + " (rc=" +
+            std::to_string(rc) + ")");
+        return false;
+    }
+
+    bool success = true;
+    if (pEstablishTcp)
+    {
+        // Open and immediately close a TCP connection to the first resolved
+        // address: primes ARP/route state and confirms the server is there.
+        // The TLS session itself is negotiated per-connection by the
+        // WebSocket library and cannot be warmed from here.
+        success = false;
+        for (const addrinfo* entry = results; entry; entry = entry->ai_next)
+        {
+#ifdef _WIN32
+            const SOCKET sock = ::socket(entry->ai_family, entry->ai_socktype,
+                                         entry->ai_protocol);
+            if (sock == INVALID_SOCKET)
+                continue;
+            if (::connect(sock, entry->ai_addr,
+                          static_cast<int>(entry->ai_addrlen)) == 0)
+                success = true;
+            ::closesocket(sock);
+#else
+            const int sock = ::socket(entry->ai_family, entry->ai_socktype,
+                                      entry->ai_protocol);
+            if (sock < 0)
+                continue;
+            if (::connect(sock, entry->ai_addr, entry->ai_addrlen) == 0)
+                success = true;
+            ::close(sock);
+#endif
+            if (success)
+                break;
+        }
+
+        if (!success)
+            Logger::Instance().Warning("WsClient",
+                "Prewarm: TCP connect failed for " + host + ":" + port);
+    }
+
+    ::freeaddrinfo(results);
+
+    Logger::Instance().Debug("WsClient", [&pUrl, success] {
+        return "Prewarm " + std::string(success ? "succeeded" : "failed") +
+               " for " + pUrl; });
+    return success;
+}
+
+size_t WsClient::PrewarmAll(const std::vector<std::string>& pUrls,
+                            bool pEstablishTcp)
+{
+    if (pUrls.empty())
+        return 0;
+
+    // Bounded parallelism: enough threads to hide DNS/TCP round-trip latency
+    // without spawning one thread per endpoint for very large fleets
+    const size_t workerCount = std::min<size_t>(
+        pUrls.size(),
+        std::max<size_t>(std::thread::hardware_concurrency(), 4) * 2);
+
+    std::atomic<size_t> nextIndex{0};
+    std::atomic<size_t> warmed{0};
+    std::vector<std::thread> workers;
+    workers.reserve(workerCount);
+
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        workers.emplace_back([&] {
+            // Each worker pulls the next unclaimed URL until none remain
+            for (size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+                 index < pUrls.size();
+                 index = nextIndex.fetch_add(1, std::memory_order_relaxed))
+            {
+                if (Prewarm(pUrls[index], pEstablishTcp))
+                    warmed.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    for (std::thread& worker : workers)
+        worker.join();
+
+    const size_t warmedCount = warmed.load(std::memory_order_relaxed);
+    Logger::Instance().Info("WsClient",
+        "Bulk prewarm: " + std::to_string(warmedCount) + "/" +
+        std::to_string(pUrls.size()) + " endpoints warmed");
+    return warmedCount;
+}
+
+bool WsClient::Open()
+{
+    // Initialize the network system once for the entire process - shared
+    // across all WsClient instances (and Prewarm)
+    if (!EnsureNetSystemInitialized())
+    {
+        Logger::Instance().Error("WsClient", 
+            "Failed to initialize network system");
+        return false;
+    }
+
+    // Disable automatic reconnection - we handle reconnection at application level
+    mImpl->ws.disableAutomaticReconnection();
+
+    // Ping/pong heartbeat (keeps connection alive through load balancers):
+    // both flavors - plain keepalives and sequence-numbered RTT probes - ride
+    // the shared timer wheel (armed in Connect), so the library's own
+    // per-connection ping timer stays off
+    if (mImpl->config.pingIntervalSeconds > 0)
+    {
+        Logger::Instance().Debug("WsClient",
+            "Heartbeat interval: " +
+            std::to_string(mImpl->config.pingIntervalSeconds) +
+            " seconds (scheduled on the shared timer wheel)");
+    }
+
+    // Configure per-message deflate compression if enabled
+    mImpl->compressionActive.store(mImpl->config.enableCompression,
+                                   std::memory_order_relaxed);
+    if (mImpl->config.enableCompression)
+    {
+        mImpl->ws.enablePerMessageDeflate();
+        Logger::Instance().Debug("WsClient", 
+            "Per-message deflate compression enabled");
+    }
+    else
+    {
+        mImpl->ws.disablePerMessageDeflate();
+    }
+
+    // Set up the message callback - called from IXWebSocket's internal thread
+    // when any message event occurs (open, message, close, error)
+    mImpl->ws.setOnMessageCallback(
+        [this](const ix::WebSocketMessagePtr& msg)
+        {
+            // Dispatch the event to appropriate callback based on message type
+            switch (msg->type)
+            {
+            case ix::WebSocketMessageType::Open:
+                OnOpen();  // Connection established
+                break;
+
+            case ix::WebSocketMessageType::Message:
+                // msg->str contains the message (text or binary)
+                // msg->binary indicates if it's binary (true) or text (false)
+                // The buffer is moved out of the IXWebSocket message so binary
+                // frames can be handed to the application without a memcpy
+                OnMessage(std::move(msg->str), msg->binary);
+                break;
+
+            case ix::WebSocketMessageType::Close:
+                OnClose();  // Connection closed by server
+                break;
+
+            case ix::WebSocketMessageType::Error:
+                // msg->errorInfo.reason contains error description
+                OnError(msg->errorInfo.reason);
+                break;
+
+            case ix::WebSocketMessageType::Ping:
+                // Ping received - pong is automatically sent by IXWebSocket
+                Logger::Instance().Debug("WsClient", [&msg] {
+                    return "[RECV][PING] " + (msg->str.empty() ? "(empty)" : msg->str); });
+                mImpl->messageRouter.RoutePing(msg->str);
+                break;
+
+            case ix::WebSocketMessageType::Pong:
+                // Pong received (response to our ping) - match it back to a
+                // sequence-numbered probe, or to the last plain SendPing
+                mImpl->HandlePong(msg->str);
+                Logger::Instance().Debug("WsClient", [&msg] {
+                    return "[RECV][PONG] " + (msg->str.empty() ? "(empty)" : msg->str); });
+                mImpl->messageRouter.RoutePong(msg->str);
+                break;
+
+            default:
+                // Unknown message type - shouldn't happen
+                break;
+            }
+        });
+
+    Logger::Instance().Info("WsClient", 
+        "Network system initialized successfully");
+    return true;
+}
+
+bool WsClient::Connect(const std::string& pUrl)
+{
+    // Lock the state mutex to prevent race conditions
+    {
+        std::lock_guard<std::mutex> lock(mImpl->stateMutex);
+        
+        // Check if already connecting or connected
+        if (mImpl->state != ConnectionState::Disconnected)
+        {
+            Logger::Instance().Warning("WsClient", 
+                "Cannot connect: already in state " + 
+                std::to_string(static_cast<int>(mImpl->state.load())));
+            return false;
+        }
+        
+        // Transition to Connecting state
+        mImpl->state = ConnectionState::Connecting;
+    }
+
+    // Remember the target for the reconnection engine and clear the
+    // user-close latch from any previous session (client reuse after Close)
+    mImpl->lastUrl = pUrl;
+    mImpl->userClosing.store(false, std::memory_order_release);
+
+    // Every connection starts in JSON mode and renegotiates binary encoding
+    mImpl->binaryProtocolActive.store(false, std::memory_order_relaxed);
+
+    // Set the URL and start connection (non-blocking)
+    mImpl->ws.setUrl(pUrl);
+    mImpl->ws.start();
+
+    // Arm the heartbeat on the shared timer wheel - one wheel timer per
+    // client instead of a per-client ping thread. With the RTT probe enabled
+    // the pings carry sequence numbers and feed the latency histogram;
+    // otherwise they are plain keepalives
+    if (mImpl->config.pingIntervalSeconds > 0 && mImpl->pingTimerId == 0)
+    {
+        Impl* impl = mImpl.get();
+        mImpl->pingTimerId = TimerWheel::Instance().ScheduleRepeating(
+            static_cast<uint64_t>(mImpl->config.pingIntervalSeconds) * 1000,
+            [impl]
+            {
+                // Only ping a live connection; reconnects resume automatically
+                if (impl->state.load(std::memory_order_acquire) !=
+                    ConnectionState::Connected)
+                    return;
+
+                if (impl->config.enableRttProbe)
+                    impl->SendRttProbe();
+                else
+                    impl->SendKeepalivePing();
+            });
+        Logger::Instance().Debug("WsClient",
+            std::string(mImpl->config.enableRttProbe ? "RTT probe" : "Keepalive") +
+            " heartbeat armed - interval " +
+            std::to_string(mImpl->config.pingIntervalSeconds) + "s");
+    }
+
+    // The ack deadline sweep arms itself when a tracked send registers, so
+    // there is no monitor thread to start here anymore
+    if (mImpl->config.ackWindowSize > 0)
+    {
+        Logger::Instance().Debug("WsClient",
+            "Ack window ready - size " + std::to_string(mImpl->config.ackWindowSize) +
+            ", timeout " + std::to_string(mImpl->config.messageTimeoutMs) + "ms");
+    }
+
+    // Start the priority sender on demand when the scheduler is enabled
+    if (mImpl->config.enablePrioritySend && !mImpl->senderThread.joinable())
+    {
+        mImpl->senderThread = std::thread(&Impl::SenderLoop, mImpl.get());
+        Logger::Instance().Debug("WsClient",
+            "Priority send scheduler armed - chunk size " +
+            std::to_string(mImpl->config.priorityChunkSizeBytes) + " bytes");
+    }
+
+    // The reconnection engine is event-driven on the shared wheel - nothing
+    // runs until OnClose or OnError reports an unexpected disconnect
+    if (mImpl->config.enableAutoReconnect)
+    {
+        Logger::Instance().Debug("WsClient",
+            "Reconnection engine armed");
+    }
+    
+    Logger::Instance().Info("WsClient", 
+        "Connection initiated to " + pUrl);
+    return true;
+}
+
+bool WsClient::WaitForConnection(int timeoutMs)
+{
+    // Create unique_lock (unlike lock_guard, this works with condition variables)
+    std::unique_lock<std::mutex> lock(mImpl->stateMutex);
+    
+    // Early return if already connected or in invalid state for waiting
+    if (mImpl->state == ConnectionState::Connected)
+    {
+        Logger::Instance().Debug("WsClient", 
+            "WaitForConnection: Already connected");
+        return true;
+    }
+    
+    if (mImpl->state != ConnectionState::Connecting)
+    {
+        Logger::Instance().Warning("WsClient", 
+            "WaitForConnection: Invalid state - expected Connecting, got " + 
+            std::to_string(static_cast<int>(mImpl->state.load())));
+        return false;
+    }
+    
+    // Wait until one of these happens:
+    // 1. Timeout expires (returns false)
+    // 2. State becomes Connected (returns true)
+    // 3. State becomes Error (returns false - don't keep waiting)
+    // 4. Spurious wakeup (we loop again due to predicate check)
+    bool stateChanged = mImpl->stateCV.wait_for(lock, 
+        std::chrono::milliseconds(timeoutMs),
+        [this]() { 
+            return mImpl->state == ConnectionState::Connected ||
+                   mImpl->state == ConnectionState::Error ||
+                   mImpl->state == ConnectionState::Disconnected;
+        });
+
+    // Check final state after waiting
+    if (mImpl->state == ConnectionState::Connected)
+    {
+        Logger::Instance().Info("WsClient", 
+            "Successfully connected to server");
+        return true;
+    }
+    
+    // Determine reason for failure
+    if (mImpl->state == ConnectionState::Error)
+    {
+        Logger::Instance().Error("WsClient", 
+            "Connection failed with error");
+    }
+    else if (!stateChanged)
+    {
+        Logger::Instance().Error("WsClient", 
+            "Connection timeout after " + 
+            std::to_string(timeoutMs) + "ms");
+    }
+    else
+    {
+        Logger::Instance().Error("WsClient", 
+            "Connection failed - unexpected state: " + 
+            std::to_string(static_cast<int>(mImpl->state.load())));
+    }
+    
+    return false;
+}
+
+bool WsClient::SendText(const std::string& pText)
+{
+    return SendText(pText, Protocol::CompressionHint::Default);
+}
+
+bool WsClient::SendText(const std::string& pText, Protocol::CompressionHint pHint)
+{
+    // Check connection state before attempting to send - a single lock-free
+    // atomic read, so concurrent senders never serialize here.
+    // NOTE: There is an intentional TOCTOU (time-of-check-time-of-use) gap.
+    // The connection state could change between this check and the actual send below.
+    // This is acceptable because:
+    // 1. IXWebSocket handles sends on closed connections gracefully (returns error)
+    // 2. Taking a lock here (as this path once did) made the check no more of a
+    //    guarantee, but made multi-producer sends contend on the state mutex
+    // 3. The state check is a fast-path optimization, not a guarantee
+    {
+        const ConnectionState state = mImpl->state.load(std::memory_order_acquire);
+        if (state != ConnectionState::Connected)
+        {
+            mImpl->statSendsRejected.fetch_add(1, std::memory_order_relaxed);
+            Logger::Instance().Warning("WsClient", 
+                "Cannot send text: not connected (state=" + 
+                std::to_string(static_cast<int>(state)) + ")");
+            return false;
+        }
+    }
+
+    mImpl->MaybeApplyCompressionPolicy(pHint, pText.data(), pText.size());
+
+    // Priority scheduler: control frames jump ahead of queued bulk chunks
+    mImpl->CountSend(pText.size());
+    mImpl->RecordFrame(TrafficRecorder::Direction::Outbound, false,
+                       pText.data(), pText.size());
+
+    if (mImpl->config.enablePrioritySend)
+    {
+        mImpl->EnqueueControl(false, std::string(pText));
+        Logger::Instance().Debug("WsClient", [&pText] {
+            return "[SEND][TEXT][HI] " + pText.substr(0, 100) +
+                   (pText.length() > 100 ? "..." : ""); });
+        return true;
+    }
+
+    // Queue the message for sending (IXWebSocket handles async transmission)
+    mImpl->ws.send(pText);
+    
+    // Lazy logging: the substring copy and concatenations below are only paid
+    // when Debug records are actually emitted (and the whole call site is
+    // stripped in Release builds via WSLOG_COMPILE_MIN_LEVEL)
+    Logger::Instance().Debug("WsClient", [&pText] {
+        return "[SEND][TEXT] " + pText.substr(0, 100) +  // Log first 100 chars
+               (pText.length() > 100 ? "..." : ""); });
+    
+    return true;
+}
+
+bool WsClient::SendText(std::string&& pText)
+{
+    // Check connection state before attempting to send (lock-free atomic read)
+    // NOTE: Intentional TOCTOU gap - see SendText(const std::string&) for explanation
+    {
+        const ConnectionState state = mImpl->state.load(std::memory_order_acquire);
+        if (state != ConnectionState::Connected)
+        {
+            mImpl->statSendsRejected.fetch_add(1, std::memory_order_relaxed);
+            Logger::Instance().Warning("WsClient",
+                "Cannot send text: not connected (state=" +
+                std::to_string(static_cast<int>(state)) + ")");
+            return false;
+        }
+    }
+
+    // Log before handing the buffer off - after the send we no longer own it
+    // (lazy: message is only built when Debug records are actually emitted)
+    Logger::Instance().Debug("WsClient", [&pText] {
+        return "[SEND][TEXT] " + pText.substr(0, 100) +  // Log first 100 chars
+               (pText.length() > 100 ? "..." : ""); });
+
+    mImpl->MaybeApplyCompressionPolicy(Protocol::CompressionHint::Default,
+                                       pText.data(), pText.size());
+
+    mImpl->CountSend(pText.size());
+    mImpl->RecordFrame(TrafficRecorder::Direction::Outbound, false,
+                       pText.data(), pText.size());
+
+    // Priority scheduler: control frames jump ahead of queued bulk chunks
+    if (mImpl->config.enablePrioritySend)
+    {
+        mImpl->EnqueueControl(false, std::move(pText));
+        return true;
+    }
+
+    // Hand the caller's buffer to the send queue without duplicating it on our side
+    mImpl->ws.sendText(std::move(pText));
+
+    return true;
+}
+
+size_t WsClient::SendTextBatch(std::span<const std::string> pMessages)
+{
+    if (pMessages.empty())
+        return 0;
+
+    // One state check for the whole burst (same intentional TOCTOU gap as
+    // SendText - the check is a fast-path optimization, not a guarantee)
+    if (mImpl->state.load(std::memory_order_acquire) != ConnectionState::Connected)
+    {
+        mImpl->statSendsRejected.fetch_add(pMessages.size(),
+                                           std::memory_order_relaxed);
+        Logger::Instance().Warning("WsClient",
+            "Cannot send batch: not connected (" +
+            std::to_string(pMessages.size()) + " messages dropped)");
+        return 0;
+    }
+
+    if (mImpl->config.enableBatchCoalescing)
+    {
+        // Pack the burst into a single frame as an RFC 7464-style JSON text
+        // sequence: 0x1E record separator before each message, newline after.
+        // One frame header, one queue operation, one (optional) deflate pass.
+        size_t total = 0;
+        for (const std::string& message : pMessages)
+            total += message.size() + 2;
+
+        std::string frame;
+        frame.reserve(total);
+        for (const std::string& message : pMessages)
+        {
+            frame.push_back('\x1E');
+            frame.append(message);
+            frame.push_back('\n');
+        }
+
+        mImpl->MaybeApplyCompressionPolicy(Protocol::CompressionHint::Default,
+                                           frame.data(), frame.size());
+        mImpl->CountSend(frame.size());
+        mImpl->RecordFrame(TrafficRecorder::Direction::Outbound, false,
+                           frame.data(), frame.size());
+
+        if (mImpl->config.enablePrioritySend)
+            mImpl->EnqueueControl(false, std::move(frame));
+        else
+            mImpl->ws.sendText(std::move(frame));
+
+        Logger::Instance().Debug("WsClient", [count = pMessages.size(), total] {
+            return "[SEND][BATCH] " + std::to_string(count) +
+                   " messages coalesced into one " + std::to_string(total) +
+                   "-byte frame"; });
+        return pMessages.size();
+    }
+
+    // Plain batching: individual frames, but queued in one pass with no
+    // per-message state check or log construction
+    for (const std::string& message : pMessages)
+    {
+        mImpl->MaybeApplyCompressionPolicy(Protocol::CompressionHint::Default,
+                                           message.data(), message.size());
+        mImpl->CountSend(message.size());
+        mImpl->RecordFrame(TrafficRecorder::Direction::Outbound, false,
+                           message.data(), message.size());
+
+        if (mImpl->config.enablePrioritySend)
+            mImpl->EnqueueControl(false, std::string(message));
+        else
+            mImpl->ws.sendText(message);
+    }
+
+    Logger::Instance().Debug("WsClient", [count = pMessages.size()] {
+        return "[SEND][BATCH] " + std::to_string(count) + " messages queued"; });
+    return pMessages.size();
+}
+
+bool WsClient::SendMessage(const Protocol::Message& pMsg)
+{
+    // Encoding follows the negotiated mode: compact binary frames once a 2.x
+    // Hello exchange upgraded the connection, JSON text otherwise
+    if (mImpl->binaryProtocolActive.load(std::memory_order_relaxed))
+        return SendBinary(Protocol::SerializeBinaryMessage(pMsg));
+
+    return SendText(Protocol::SerializeJsonMessage(pMsg));
+}
+
+bool WsClient::SendBinaryChunk(const std::string& pStreamId, uint32_t pSequence,
+                               uint64_t pOffset, const void* pData, size_t pSize)
+{
+    // Validate parameters
+    if (!pData || pSize == 0)
+    {
+        Logger::Instance().Warning("WsClient",
+            "Cannot send chunk: invalid data " +
+            (pData ? std::to_string(pSize) : "null pointer"));
+        return false;
+    }
+
+    // Check connection state before attempting to send (lock-free atomic read)
+    // NOTE: Intentional TOCTOU gap - see SendText() for detailed explanation
+    if (mImpl->state.load(std::memory_order_acquire) != ConnectionState::Connected)
+    {
+        mImpl->statSendsRejected.fetch_add(1, std::memory_order_relaxed);
+        Logger::Instance().Warning("WsClient",
+            "Cannot send chunk: not connected");
+        return false;
+    }
+
+    // Optional backpressure: fail fast instead of growing the queue unbounded
+    if (mImpl->config.rejectSendsOverWatermark && mImpl->OverWatermark())
+    {
+        mImpl->statSendsRejected.fetch_add(1, std::memory_order_relaxed);
+        Logger::Instance().Warning("WsClient",
+            "Send rejected: " + std::to_string(mImpl->ws.bufferedAmount()) +
+            " bytes buffered exceeds watermark");
+        return false;
+    }
+
+    // Validate against maximum payload size
+    if (pSize > mImpl->config.maxBinaryPayloadSize)
+    {
+        Logger::Instance().Error("WsClient",
+            "Chunk payload exceeds max size: " +
+            std::to_string(pSize) + " > " +
+            std::to_string(mImpl->config.maxBinaryPayloadSize));
+        return false;
+    }
+
+    std::string frame =
+        Protocol::SerializeBinaryChunk(pStreamId, pSequence, pOffset, pData, pSize);
+    if (frame.empty())
+        return false;  // Unrepresentable - the serializer already logged why
+
+    mImpl->CountSend(frame.size());
+    mImpl->RecordFrame(TrafficRecorder::Direction::Outbound, true,
+                       frame.data(), frame.size());
+
+    // Framed chunks must reach the wire as one WebSocket message (the header
+    // addresses the payload), so under the priority scheduler they are queued
+    // as indivisible bulk frames instead of being re-chopped
+    if (mImpl->config.enablePrioritySend)
+    {
+        mImpl->EnqueueBulk(std::move(frame), /*whole=*/true);
+        Logger::Instance().Debug("WsClient", [pSequence, pOffset, pSize] {
+            return "[SEND][CHUNK][BULK] seq " + std::to_string(pSequence) +
+                   " offset " + std::to_string(pOffset) + ", " +
+                   std::to_string(pSize) + " bytes queued"; });
+        return true;
+    }
+
+    mImpl->ws.sendBinary(std::move(frame));
+
+    Logger::Instance().Debug("WsClient", [pSequence, pOffset, pSize] {
+        return "[SEND][CHUNK] seq " + std::to_string(pSequence) +
+               " offset " + std::to_string(pOffset) + ", " +
+               std::to_string(pSize) + " bytes"; });
+
+    return true;
+}
+
+bool WsClient::SendBinary(const void* pData, size_t pSize)
+{
+    return SendBinary(pData, pSize, Protocol::CompressionHint::Default);
+}
+
+bool WsClient::SendBinary(const void* pData, size_t pSize,
+                          Protocol::CompressionHint pHint)
+{
+    // Validate parameters
+    if (!pData || pSize == 0)
+    {
+        Logger::Instance().Warning("WsClient", 
+            "Cannot send binary: invalid data " + 
+            (pData ? std::to_string(pSize) : "null pointer"));
+        return false;
+    }
+
+    // Check connection state before attempting to send (lock-free atomic read)
+    // NOTE: Intentional TOCTOU gap - see SendText() for detailed explanation
+    if (mImpl->state.load(std::memory_order_acquire) != ConnectionState::Connected)
+    {
+        mImpl->statSendsRejected.fetch_add(1, std::memory_order_relaxed);
+        Logger::Instance().Warning("WsClient", 
+            "Cannot send binary: not connected");
+        return false;
+    }
+
+    // Optional backpressure: fail fast instead of growing the queue unbounded
+    if (mImpl->config.rejectSendsOverWatermark && mImpl->OverWatermark())
+    {
+        mImpl->statSendsRejected.fetch_add(1, std::memory_order_relaxed);
+        Logger::Instance().Warning("WsClient",
+            "Send rejected: " + std::to_string(mImpl->ws.bufferedAmount()) +
+            " bytes buffered exceeds watermark");
+        return false;
+    }
+
+    // Validate against maximum payload size
+    if (pSize > mImpl->config.maxBinaryPayloadSize)
+    {
+        Logger::Instance().Error("WsClient", 
+            "Binary payload exceeds max size: " + 
+            std::to_string(pSize) + " > " + 
+            std::to_string(mImpl->config.maxBinaryPayloadSize));
+        return false;
+    }
+
+    // Convert void* to char* and create string from binary data
+    const char* data = reinterpret_cast<const char*>(pData);
+
+    mImpl->MaybeApplyCompressionPolicy(pHint, pData, pSize);
+
+    mImpl->CountSend(pSize);
+    mImpl->RecordFrame(TrafficRecorder::Direction::Outbound, true, pData, pSize);
+
+    // Priority scheduler: bulk payloads are queued and sent in chunks so
+    // control frames can interleave
+    if (mImpl->config.enablePrioritySend)
+    {
+        mImpl->EnqueueBulk(std::string(data, pSize));
+        Logger::Instance().Debug("WsClient", [pSize] {
+            return "[SEND][BINARY][BULK] " + std::to_string(pSize) + " bytes queued"; });
+        return true;
+    }
+
+    mImpl->ws.sendBinary(std::string(data, pSize));
+    
+    Logger::Instance().Debug("WsClient", [pSize] {
+        return "[SEND][BINARY] " + std::to_string(pSize) + " bytes"; });
+    
+    return true;
+}
+
+bool WsClient::SendBinary(std::string&& pData)
+{
+    // Validate parameters
+    if (pData.empty())
+    {
+        Logger::Instance().Warning("WsClient",
+            "Cannot send binary: empty buffer");
+        return false;
+    }
+
+    // Check connection state before attempting to send (lock-free atomic read)
+    // NOTE: Intentional TOCTOU gap - see SendText() for detailed explanation
+    if (mImpl->state.load(std::memory_order_acquire) != ConnectionState::Connected)
+    {
+        mImpl->statSendsRejected.fetch_add(1, std::memory_order_relaxed);
+        Logger::Instance().Warning("WsClient",
+            "Cannot send binary: not connected");
+        return false;
+    }
+
+    // Optional backpressure: fail fast instead of growing the queue unbounded
+    if (mImpl->config.rejectSendsOverWatermark && mImpl->OverWatermark())
+    {
+        mImpl->statSendsRejected.fetch_add(1, std::memory_order_relaxed);
+        Logger::Instance().Warning("WsClient",
+            "Send rejected: " + std::to_string(mImpl->ws.bufferedAmount()) +
+            " bytes buffered exceeds watermark");
+        return false;
+    }
+
+    // Validate against maximum payload size
+    if (pData.size() > mImpl->config.maxBinaryPayloadSize)
+    {
+        Logger::Instance().Error("WsClient",
+            "Binary payload exceeds max size: " +
+            std::to_string(pData.size()) + " > " +
+            std::to_string(mImpl->config.maxBinaryPayloadSize));
+        return false;
+    }
+
+    // Log before handing the buffer off - after the send we no longer own it
+    const size_t payloadSize = pData.size();
+
+    mImpl->MaybeApplyCompressionPolicy(Protocol::CompressionHint::Default,
+                                       pData.data(), pData.size());
+
+    mImpl->CountSend(pData.size());
+    mImpl->RecordFrame(TrafficRecorder::Direction::Outbound, true,
+                       pData.data(), pData.size());
+
+    // Priority scheduler: bulk payloads are queued and sent in chunks so
+    // control frames can interleave (the buffer moves, no copy)
+    if (mImpl->config.enablePrioritySend)
+    {
+        mImpl->EnqueueBulk(std::move(pData));
+        Logger::Instance().Debug("WsClient", [payloadSize] {
+            return "[SEND][BINARY][BULK] " + std::to_string(payloadSize) + " bytes queued (moved)"; });
+        return true;
+    }
+
+    // Hand the caller's buffer to the send queue without the extra
+    // payload-sized copy the copy-based overload constructs
+    mImpl->ws.sendBinary(std::move(pData));
+
+    Logger::Instance().Debug("WsClient", [payloadSize] {
+        return "[SEND][BINARY] " + std::to_string(payloadSize) + " bytes (moved)"; });
+
+    return true;
+}
+
+bool WsClient::SendBinary(std::shared_ptr<const std::vector<uint8_t>> pData)
+{
+    // Validate parameters
+    if (!pData || pData->empty())
+    {
+        Logger::Instance().Warning("WsClient",
+            "Cannot send binary: " +
+            std::string(pData ? "empty buffer" : "null buffer"));
+        return false;
+    }
+
+    // Check connection state before attempting to send (lock-free atomic read)
+    // NOTE: Intentional TOCTOU gap - see SendText() for detailed explanation
+    if (mImpl->state.load(std::memory_order_acquire) != ConnectionState::Connected)
+    {
+        mImpl->statSendsRejected.fetch_add(1, std::memory_order_relaxed);
+        Logger::Instance().Warning("WsClient",
+            "Cannot send binary: not connected");
+        return false;
+    }
+
+    // Optional backpressure: fail fast instead of growing the queue unbounded
+    if (mImpl->config.rejectSendsOverWatermark && mImpl->OverWatermark())
+    {
+        mImpl->statSendsRejected.fetch_add(1, std::memory_order_relaxed);
+        Logger::Instance().Warning("WsClient",
+            "Send rejected: " + std::to_string(mImpl->ws.bufferedAmount()) +
+            " bytes buffered exceeds watermark");
+        return false;
+    }
+
+    // Validate against maximum payload size
+    if (pData->size() > mImpl->config.maxBinaryPayloadSize)
+    {
+        Logger::Instance().Error("WsClient",
+            "Binary payload exceeds max size: " +
+            std::to_string(pData->size()) + " > " +
+            std::to_string(mImpl->config.maxBinaryPayloadSize));
+        return false;
+    }
+
+    mImpl->MaybeApplyCompressionPolicy(Protocol::CompressionHint::Default,
+                                       pData->data(), pData->size());
+
+    mImpl->CountSend(pData->size());
+    mImpl->RecordFrame(TrafficRecorder::Direction::Outbound, true,
+                       pData->data(), pData->size());
+
+    // Priority scheduler: bulk payloads are queued and sent in chunks so
+    // control frames can interleave
+    if (mImpl->config.enablePrioritySend)
+    {
+        mImpl->EnqueueBulk(std::string(
+            reinterpret_cast<const char*>(pData->data()), pData->size()));
+        Logger::Instance().Debug("WsClient", [&pData] {
+            return "[SEND][BINARY][BULK] " + std::to_string(pData->size()) + " bytes queued (shared)"; });
+        return true;
+    }
+
+    // The shared buffer is sent as-is; the WebSocket library copies the bytes
+    // into its own send queue, but the application-side buffer stays shared
+    // across however many clients fan this payload out
+    mImpl->ws.sendBinary(std::string(
+        reinterpret_cast<const char*>(pData->data()), pData->size()));
+
+    Logger::Instance().Debug("WsClient", [&pData] {
+        return "[SEND][BINARY] " + std::to_string(pData->size()) + " bytes (shared)"; });
+
+    return true;
+}
+
+bool WsClient::SendFile(const std::string& pPath, const std::string& pMsgId,
+                        size_t pChunkSize, SendProgressCallback pProgress)
+{
+    // Clamp the chunk size to something sane - tiny frames waste header and
+    // syscall overhead
+    const size_t chunkSize = pChunkSize < 4096 ? 4096 : pChunkSize;
+
+    // Check connection state before doing any file work (lock-free atomic read)
+    // NOTE: Intentional TOCTOU gap - see SendText() for detailed explanation
+    if (mImpl->state.load(std::memory_order_acquire) != ConnectionState::Connected)
+    {
+        Logger::Instance().Warning("WsClient",
+            "Cannot send file: not connected");
+        return false;
+    }
+
+#ifdef _WIN32
+    // Open and map the file; chunks are sent straight from the mapping so the
+    // file is never read into an application buffer
+    HANDLE file = CreateFileA(pPath.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        Logger::Instance().Error("WsClient",
+            "SendFile: failed to open " + pPath);
+        return false;
+    }
+
+    LARGE_INTEGER sizeInfo;
+    if (!GetFileSizeEx(file, &sizeInfo) || sizeInfo.QuadPart <= 0)
+    {
+        Logger::Instance().Error("WsClient",
+            "SendFile: failed to size (or empty file) " + pPath);
+        CloseHandle(file);
+        return false;
+    }
+    const size_t fileSize = static_cast<size_t>(sizeInfo.QuadPart);
+
+    // Validate against maximum payload size (mirrors SendBinary)
+    if (fileSize > mImpl->config.maxBinaryPayloadSize)
+    {
+        Logger::Instance().Error("WsClient",
+            "SendFile: file exceeds max size: " + std::to_string(fileSize) +
+            " > " + std::to_string(mImpl->config.maxBinaryPayloadSize));
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+    {
+        Logger::Instance().Error("WsClient",
+            "SendFile: CreateFileMapping failed for " + pPath);
+        CloseHandle(file);
+        return false;
+    }
+
+    const char* base = static_cast<const char*>(
+        MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, fileSize));
+    if (!base)
+    {
+        Logger::Instance().Error("WsClient",
+            "SendFile: MapViewOfFile failed for " + pPath);
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+#else
+    // Non-Windows fallback: buffered chunk reads (no mapping available here)
+    std::FILE* file = std::fopen(pPath.c_str(), "rb");
+    if (!file)
+    {
+        Logger::Instance().Error("WsClient",
+            "SendFile: failed to open " + pPath);
+        return false;
+    }
+    std::fseek(file, 0, SEEK_END);
+    const long fileSizeLong = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    if (fileSizeLong <= 0)
+    {
+        Logger::Instance().Error("WsClient",
+            "SendFile: failed to size (or empty file) " + pPath);
+        std::fclose(file);
+        return false;
+    }
+    const size_t fileSize = static_cast<size_t>(fileSizeLong);
+
+    if (fileSize > mImpl->config.maxBinaryPayloadSize)
+    {
+        Logger::Instance().Error("WsClient",
+            "SendFile: file exceeds max size: " + std::to_string(fileSize) +
+            " > " + std::to_string(mImpl->config.maxBinaryPayloadSize));
+        std::fclose(file);
+        return false;
+    }
+
+#endif
+
+    // Announce the transfer: BinaryStart metadata derived from the file size
+    Protocol::Message meta(Protocol::MessageType::BinaryStart, pMsgId);
+    meta.binarySize = fileSize;
+
+    // Negotiated encoding: JSON text or compact binary, whichever is active
+    bool ok = SendMessage(meta);
+
+    Logger::Instance().Info("WsClient",
+        "SendFile: " + pPath + " (" + std::to_string(fileSize) + " bytes, " +
+        std::to_string((fileSize + chunkSize - 1) / chunkSize) + " chunks)");
+
+    // Feed the file to the WebSocket chunk by chunk
+    size_t offset = 0;
+#ifndef _WIN32
+    std::string chunkBuffer;
+    chunkBuffer.resize(chunkSize);
+#endif
+    while (ok && offset < fileSize)
+    {
+        const size_t len = (fileSize - offset) < chunkSize ? (fileSize - offset) : chunkSize;
+
+        // Bail out if the connection dropped mid-transfer (lock-free read)
+        if (mImpl->state.load(std::memory_order_acquire) != ConnectionState::Connected)
+        {
+            Logger::Instance().Error("WsClient",
+                "SendFile: connection lost at offset " + std::to_string(offset));
+            ok = false;
+            break;
+        }
+
+        // Pace against the configured watermark so the whole file is never
+        // resident in the send queue at once
+        if (mImpl->OverWatermark() &&
+            !WaitForDrain(mImpl->config.messageTimeoutMs,
+                          mImpl->config.sendHighWatermarkBytes / 2))
+        {
+            Logger::Instance().Error("WsClient",
+                "SendFile: send queue failed to drain at offset " +
+                std::to_string(offset));
+            ok = false;
+            break;
+        }
+
+#ifdef _WIN32
+        // Chunks are handed to the send queue straight from the mapping; the
+        // library-boundary copy into the queue is the only copy made.
+        // The compression policy samples the first chunk - one decision per
+        // file, not per frame
+        if (offset == 0)
+            mImpl->MaybeApplyCompressionPolicy(
+                Protocol::CompressionHint::Default, base, len);
+        mImpl->RecordFrame(TrafficRecorder::Direction::Outbound, true,
+                           base + offset, len);
+        if (mImpl->config.enablePrioritySend)
+            mImpl->EnqueueBulk(std::string(base + offset, len));
+        else
+            mImpl->ws.sendBinary(std::string(base + offset, len));
+#else
+        if (std::fread(&chunkBuffer[0], 1, len, file) != len)
+        {
+            Logger::Instance().Error("WsClient",
+                "SendFile: read failed at offset " + std::to_string(offset));
+            ok = false;
+            break;
+        }
+        // One compression decision per file, sampled from the first chunk
+        if (offset == 0)
+            mImpl->MaybeApplyCompressionPolicy(
+                Protocol::CompressionHint::Default, chunkBuffer.data(), len);
+        mImpl->RecordFrame(TrafficRecorder::Direction::Outbound, true,
+                           chunkBuffer.data(), len);
+        if (mImpl->config.enablePrioritySend)
+            mImpl->EnqueueBulk(std::string(chunkBuffer.data(), len));
+        else
+            mImpl->ws.sendBinary(std::string(chunkBuffer.data(), len));
+#endif
+
+        offset += len;
+
+        // Report progress after each queued chunk
+        if (pProgress)
+            pProgress(offset, fileSize);
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(base);
+    CloseHandle(mapping);
+    CloseHandle(file);
+#else
+    std::fclose(file);
+#endif
+
+    if (ok)
+    {
+        Logger::Instance().Info("WsClient",
+            "SendFile: queued " + std::to_string(fileSize) + " bytes from " + pPath);
+    }
+    return ok;
+}
+
+bool WsClient::SendPing(const std::string& payload)
+{
+    // Check connection state before attempting to send (lock-free atomic read)
+    if (mImpl->state.load(std::memory_order_acquire) != ConnectionState::Connected)
+    {
+        Logger::Instance().Warning("WsClient", 
+            "Cannot send ping: not connected");
+        return false;
+    }
+
+    // Send the ping frame (payload limited to 125 bytes per RFC 6455)
+    std::string trimmedPayload = payload.substr(0, 125);
+
+    // Timestamp for the ping-to-pong latency sample (single outstanding ping;
+    // a new ping before the previous pong simply restarts the measurement)
+    mImpl->lastPingSentUs.store(Impl::NowUs(), std::memory_order_relaxed);
+
+    // Priority scheduler: heartbeats are control frames - they jump the queue
+    if (mImpl->config.enablePrioritySend)
+    {
+        Logger::Instance().Debug("WsClient", [&trimmedPayload] {
+            return "[SEND][PING][HI] " + (trimmedPayload.empty() ? "(empty)" : trimmedPayload); });
+        mImpl->EnqueueControl(true, std::move(trimmedPayload));
+        return true;
+    }
+
+    mImpl->ws.ping(trimmedPayload);
+    
+    Logger::Instance().Debug("WsClient", [&trimmedPayload] {
+        return "[SEND][PING] " + (trimmedPayload.empty() ? "(empty)" : trimmedPayload); });
+    
+    return true;
+}
+
+void WsClient::EnableCompression()
+{
+    mImpl->compressionActive.store(true, std::memory_order_relaxed);
+    mImpl->ws.enablePerMessageDeflate();
+    Logger::Instance().Info("WsClient", 
+        "Per-message deflate compression enabled");
+}
+
+void WsClient::DisableCompression()
+{
+    mImpl->compressionActive.store(false, std::memory_order_relaxed);
+    mImpl->ws.disablePerMessageDeflate();
+    Logger::Instance().Info("WsClient", 
+        "Per-message deflate compression disabled");
+}
+
+size_t WsClient::GetBufferedAmount() const
+{
+    // Library queue plus (when the priority scheduler is on) its bulk backlog,
+    // so backpressure decisions see every byte still waiting to leave
+    return mImpl->QueuedSendBytes();
+}
+
+bool WsClient::WaitForDrain(int pTimeoutMs, size_t pTargetBytes)
+{
+    // IXWebSocket gives no drain notification, so poll the queue depth at
+    // millisecond granularity against a shared deadline. Each tick is one
+    // atomic read - cheap enough that precision beats cleverness here.
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::milliseconds(pTimeoutMs);
+
+    while (true)
+    {
+        if (mImpl->QueuedSendBytes() <= pTargetBytes)
+            return true;
+
+        // A dead connection never drains - report failure instead of spinning
+        if (mImpl->state.load(std::memory_order_acquire) != ConnectionState::Connected)
+        {
+            Logger::Instance().Warning("WsClient",
+                "WaitForDrain aborted: connection lost");
+            return false;
+        }
+
+        if (std::chrono::steady_clock::now() >= deadline)
+        {
+            Logger::Instance().Warning("WsClient",
+                "WaitForDrain timeout: " + std::to_string(mImpl->QueuedSendBytes()) +
+                " bytes still buffered after " + std::to_string(pTimeoutMs) + "ms");
+            return false;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+bool WsClient::SendTextWithAck(const std::string& pMsgId, const std::string& pText)
+{
+    // Tracking only works with a configured window
+    if (mImpl->config.ackWindowSize == 0)
+    {
+        Logger::Instance().Warning("WsClient",
+            "SendTextWithAck requires ackWindowSize > 0");
+        return false;
+    }
+
+    // Check connection state before attempting to send (lock-free atomic read)
+    if (mImpl->state.load(std::memory_order_acquire) != ConnectionState::Connected)
+    {
+        Logger::Instance().Warning("WsClient",
+            "Cannot send tracked text: not connected");
+        return false;
+    }
+
+    // Register the entry before sending so the ack can't race the bookkeeping
+    {
+        std::unique_lock<std::mutex> lock(mImpl->ackMutex);
+
+        // Window full: wait for an entry to retire, bounded by the timeout
+        if (mImpl->pendingAcks.size() >= mImpl->config.ackWindowSize)
+        {
+            const bool space = mImpl->ackCV.wait_for(lock,
+                std::chrono::milliseconds(mImpl->config.messageTimeoutMs),
+                [this] {
+                    return mImpl->pendingAcks.size() < mImpl->config.ackWindowSize ||
+                           mImpl->ackShutdown;
+                });
+
+            if (!space || mImpl->ackShutdown)
+            {
+                Logger::Instance().Warning("WsClient",
+                    "Send window full - tracked send rejected for '" + pMsgId + "'");
+                return false;
+            }
+        }
+
+        Impl::PendingAck entry;
+        entry.payload = pText;
+        entry.sendTime = std::chrono::steady_clock::now();
+        entry.deadline = entry.sendTime +
+                         std::chrono::milliseconds(mImpl->config.messageTimeoutMs);
+        mImpl->pendingAcks[pMsgId] = std::move(entry);
+
+        // First tracked message wakes the deadline sweep
+        mImpl->ArmAckSweepLocked();
+    }
+
+    mImpl->SendTextFrame(std::string(pText));
+
+    Logger::Instance().Debug("WsClient", [&pMsgId] {
+        return "[SEND][TEXT][TRACKED] msgId=" + pMsgId; });
+    return true;
+}
+
+void WsClient::OnNextStateSettled(std::function<void(ConnectionState)> pCallback)
+{
+    {
+        std::unique_lock<std::mutex> lock(mImpl->stateMutex);
+
+        // Still in flight - park the callback for OnOpen/OnClose/OnError
+        if (mImpl->state == ConnectionState::Connecting)
+        {
+            mImpl->stateSettledCallbacks.push_back(std::move(pCallback));
+            return;
+        }
+    }
+
+    // Already settled - invoke immediately (caller thread) so a registration
+    // that races the transition can never be lost
+    pCallback(mImpl->state.load(std::memory_order_acquire));
+}
+
+bool WsClient::SendTextTracked(const std::string& pMsgId, const std::string& pText,
+                               std::function<void(bool)> pCompletion, int pTimeoutMs)
+{
+    // Tracking only works with a configured window
+    if (mImpl->config.ackWindowSize == 0)
+    {
+        Logger::Instance().Warning("WsClient",
+            "SendTextTracked requires ackWindowSize > 0");
+        return false;
+    }
+
+    // Check connection state before attempting to send (lock-free atomic read)
+    if (mImpl->state.load(std::memory_order_acquire) != ConnectionState::Connected)
+    {
+        Logger::Instance().Warning("WsClient",
+            "Cannot send tracked text: not connected");
+        return false;
+    }
+
+    const int timeoutMs = (pTimeoutMs > 0) ? pTimeoutMs
+                                           : mImpl->config.messageTimeoutMs;
+
+    // Register entry and continuation before sending so the ack can't race
+    // the bookkeeping
+    {
+        std::unique_lock<std::mutex> lock(mImpl->ackMutex);
+
+        if (mImpl->pendingAcks.size() >= mImpl->config.ackWindowSize)
+        {
+            // Unlike the blocking SendTextWithAck, fail immediately - the
+            // caller is a coroutine and must not block a thread here
+            Logger::Instance().Warning("WsClient",
+                "Send window full - tracked send rejected for '" + pMsgId + "'");
+            return false;
+        }
+
+        Impl::PendingAck entry;
+        entry.payload = pText;
+        entry.timeoutMs = timeoutMs;
+        entry.sendTime = std::chrono::steady_clock::now();
+        entry.deadline = entry.sendTime + std::chrono::milliseconds(timeoutMs);
+        mImpl->pendingAcks[pMsgId] = std::move(entry);
+
+        if (pCompletion)
+            mImpl->ackContinuations[pMsgId] = std::move(pCompletion);
+
+        // First tracked message wakes the deadline sweep
+        mImpl->ArmAckSweepLocked();
+    }
+
+    mImpl->SendTextFrame(std::string(pText));
+
+    Logger::Instance().Debug("WsClient", [&pMsgId] {
+        return "[SEND][TEXT][TRACKED] msgId=" + pMsgId + " (completion attached)"; });
+    return true;
+}
+
+size_t WsClient::GetUnackedCount() const
+{
+    std::lock_guard<std::mutex> lock(mImpl->ackMutex);
+    return mImpl->pendingAcks.size();
+}
+
+bool WsClient::WaitForAckWindow(int pTimeoutMs)
+{
+    if (mImpl->config.ackWindowSize == 0)
+        return false;
+
+    std::unique_lock<std::mutex> lock(mImpl->ackMutex);
+    return mImpl->ackCV.wait_for(lock, std::chrono::milliseconds(pTimeoutMs),
+        [this] {
+            return mImpl->pendingAcks.size() < mImpl->config.ackWindowSize;
+        });
+}
+
+WsClient::Stats WsClient::GetStats() const
+{
+    Stats stats;
+    stats.messagesSent = mImpl->statMessagesSent.load(std::memory_order_relaxed);
+    stats.bytesSent = mImpl->statBytesSent.load(std::memory_order_relaxed);
+    stats.messagesReceived = mImpl->statMessagesReceived.load(std::memory_order_relaxed);
+    stats.bytesReceived = mImpl->statBytesReceived.load(std::memory_order_relaxed);
+    stats.sendsRejected = mImpl->statSendsRejected.load(std::memory_order_relaxed);
+    stats.protocolErrors = mImpl->messageRouter.GetProtocolErrorCount();
+    stats.sendToAck = mImpl->sendAckHistogram.Snapshot();
+    stats.pingToPong = mImpl->pingPongHistogram.Snapshot();
+    return stats;
+}
+
+WsClient::ConnectionState WsClient::GetState() const
+{
+    // Lock-free atomic read of current state
+    return mImpl->state.load(std::memory_order_acquire);
+}
+
+std::string WsClient::GetStateString() const
+{
+    ConnectionState state = GetState();
+    switch (state)
+    {
+    case ConnectionState::Disconnected: return "Disconnected";
+    case ConnectionState::Connecting:   return "Connecting";
+    case ConnectionState::Connected:    return "Connected";
+    case ConnectionState::Closing:      return "Closing";
+    case ConnectionState::Error:        return "Error";
+    default:                            return "Unknown";
+    }
+}
+
+bool WsClient::StartRecording(const std::string& pPath)
+{
+    auto newRecorder = std::make_shared<TrafficRecorder>();
+    if (!newRecorder->Open(pPath))
+        return false;
+
+    {
+        std::lock_guard<std::mutex> lock(mImpl->recorderMutex);
+        mImpl->recorder = std::move(newRecorder);
+    }
+    mImpl->recordingEnabled.store(true, std::memory_order_release);
+
+    Logger::Instance().Info("WsClient", "Traffic recording started: " + pPath);
+    return true;
+}
+
+void WsClient::StopRecording()
+{
+    mImpl->recordingEnabled.store(false, std::memory_order_release);
+
+    std::shared_ptr<TrafficRecorder> finished;
+    {
+        std::lock_guard<std::mutex> lock(mImpl->recorderMutex);
+        finished = std::move(mImpl->recorder);
+        mImpl->recorder.reset();
+    }
+
+    // Threads mid-Record still hold a reference; the log closes (and flushes)
+    // when the last of them lets go
+    if (finished)
+        finished->Close();
+}
+
+void WsClient::SetMessageHandler(IMessageHandler* handler)
+{
+    // Pass the handler to the message router
+    mImpl->messageRouter.SetMessageHandler(handler);
+    
+    if (handler)
+    {
+        Logger::Instance().Debug("WsClient", 
+            "Message handler set");
+    }
+}
+
+void WsClient::SetBinarySink(BinarySink* sink)
+{
+    // Store the sink for the receive path; like the message handler, this
+    // should be configured before connecting
+    std::lock_guard<std::mutex> lock(mImpl->binaryMutex);
+    mImpl->binarySink = sink;
+
+    if (sink)
+    {
+        Logger::Instance().Debug("WsClient",
+            "Binary sink set - transfers will stream to sink");
+    }
+}
+
+bool WsClient::InitiateClose()
+{
+    // A user-initiated close must never be fought by the reconnection engine:
+    // latch the intent first, then retire the wheel timers and the sender
+    mImpl->userClosing.store(true, std::memory_order_release);
+    mImpl->StopReconnect();
+    mImpl->StopSenderThread();
+    mImpl->StopAckTimer();
+    mImpl->StopPingTimer();
+
+    // Gracefully close the connection
+    {
+        std::lock_guard<std::mutex> lock(mImpl->stateMutex);
+        
+        // Silently succeed if already disconnected
+        if (mImpl->state == ConnectionState::Disconnected)
+            return false;
+        
+        // Mark as closing and reset shutdown completion flag
+        mImpl->state = ConnectionState::Closing;
+        mImpl->shutdownComplete = false;
+    }
+
+    // Ask the WebSocket to stop - the library thread confirms via OnClose
+    mImpl->ws.stop();
+    return true;
+}
+
+bool WsClient::AwaitClose(int pDeadlineMs)
+{
+    const int deadlineMs = (pDeadlineMs > 0)
+        ? pDeadlineMs
+        : mImpl->config.shutdownTimeoutMs;
+
+    // Wait for the internal thread to exit gracefully with proper synchronization
+    // IXWebSocket will trigger OnClose callback when the thread has completed shutdown
+    std::unique_lock<std::mutex> lock(mImpl->stateMutex);
+
+    // Already landed (or never left) - nothing to wait for
+    if (mImpl->state == ConnectionState::Disconnected)
+        return true;
+
+    const bool completed = mImpl->shutdownCV.wait_for(
+        lock,
+        std::chrono::milliseconds(deadlineMs),
+        [this] { return mImpl->shutdownComplete; }
+    );
+
+    if (!completed)
+    {
+        Logger::Instance().Warning("WsClient", 
+            "Shutdown timeout - internal thread may still be running");
+    }
+
+    // Land in Disconnected regardless of how shutdown went, so the
+    // client can be reused with a fresh Connect()
+    mImpl->state = ConnectionState::Disconnected;
+    return completed;
+}
+
+void WsClient::Close()
+{
+    if (!InitiateClose())
+        return;
+
+    AwaitClose(-1);
+
+    Logger::Instance().Info("WsClient", 
+        "Connection closed");
+}
+
+WsClient::CloseHandle WsClient::CloseAsync()
+{
+    // Kick off the teardown; whether anything was actually connected only
+    // affects how long Wait blocks (not at all when already disconnected)
+    const bool pending = InitiateClose();
+
+    Logger::Instance().Debug("WsClient", [pending] {
+        return std::string("CloseAsync initiated") +
+               (pending ? "" : " (already disconnected)"); });
+
+    return CloseHandle(this);
+}
+
+bool WsClient::CloseHandle::Wait(int pTimeoutMs)
+{
+    return mClient ? mClient->AwaitClose(pTimeoutMs) : true;
+}
+
+bool WsClient::CloseHandle::IsComplete() const
+{
+    return !mClient ||
+           mClient->GetState() == ConnectionState::Disconnected;
+}
+
+size_t WsClient::CloseAll(std::span<WsClient* const> pClients, int pDeadlineMs)
+{
+    // Phase 1: initiate every close - all library sockets start tearing down
+    // concurrently before anyone waits
+    std::vector<CloseHandle> handles;
+    handles.reserve(pClients.size());
+    for (WsClient* client : pClients)
+    {
+        if (client)
+            handles.push_back(client->CloseAsync());
+    }
+
+    // Phase 2: collect completions. With an overall deadline, each wait gets
+    // whatever budget remains; without one, each client waits out its own
+    // configured deadline - still in parallel wall time, since the slow
+    // teardowns overlap
+    const auto start = std::chrono::steady_clock::now();
+    size_t completed = 0;
+    for (CloseHandle& handle : handles)
+    {
+        int waitMs = -1;
+        if (pDeadlineMs > 0)
+        {
+            const auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count();
+            waitMs = pDeadlineMs - static_cast<int>(elapsedMs);
+            if (waitMs <= 0)
+            {
+                // Budget exhausted - just poll the remaining handles
+                if (handle.IsComplete())
+                    ++completed;
+                continue;
+            }
+        }
+
+        if (handle.Wait(waitMs))
+            ++completed;
+    }
+
+    Logger::Instance().Info("WsClient",
+        "Fleet close: " + std::to_string(completed) + "/" +
+        std::to_string(handles.size()) + " clients closed cleanly");
+    return completed;
+}
+
+//
+// Private callback handlers - invoked from IXWebSocket's internal thread
+// All state modifications are protected by mutex
+//
+
+void WsClient::OnOpen()
+{
+    // Connection established - update state and notify waiters
+    {
+        std::lock_guard<std::mutex> lock(mImpl->stateMutex);
+        mImpl->state = ConnectionState::Connected;
+    }
+    
+    // Notify all threads waiting in WaitForConnection()
+    mImpl->stateCV.notify_all();
+
+    // Resume coroutines awaiting the connection outcome
+    mImpl->FireStateSettled(ConnectionState::Connected);
+
+    // If this open resolves an outage, let the reconnection engine retire
+    // its pending timers and report the recovery
+    mImpl->OnConnectionRestored();
+
+    Logger::Instance().Info("WsClient",
+        "Connected to server");
+}
+
+void WsClient::OnMessage(std::string&& pMsg, bool pIsBinary)
+{
+    // Receive-side counters - one relaxed add each, no branching on config
+    mImpl->statMessagesReceived.fetch_add(1, std::memory_order_relaxed);
+    mImpl->statBytesReceived.fetch_add(pMsg.size(), std::memory_order_relaxed);
+
+    mImpl->RecordFrame(TrafficRecorder::Direction::Inbound, pIsBinary,
+                       pMsg.data(), pMsg.size());
+
+    if (pIsBinary)
+    {
+        // Compact-encoded control message? Only considered while binary
+        // protocol mode is enabled; everything else is a raw data chunk
+        if (mImpl->config.enableBinaryProtocol &&
+            Protocol::IsBinaryProtocolFrame(pMsg))
+        {
+            Logger::Instance().Debug("WsClient", [&pMsg] {
+                return "[RECV][BINCTL] " + std::to_string(pMsg.size()) + " bytes"; });
+            HandleControlMessage(Protocol::ParseBinaryMessageView(pMsg));
+            return;
+        }
+
+        // Addressed chunk? Framed chunks carry stream id, sequence, and byte
+        // offset, so they may arrive out of order (striped across a pool's
+        // connections) and are reassembled through the reorder window
+        if (mImpl->config.enableChunkFraming &&
+            Protocol::IsBinaryChunkFrame(pMsg))
+        {
+            HandleFramedChunk(pMsg);
+            return;
+        }
+
+        // Binary data received - reassemble multipart binary transfers
+        // (lazy: per-chunk message construction skipped unless Debug is emitted)
+        Logger::Instance().Debug("WsClient", [&pMsg] {
+            return "[RECV][BINARY] " + std::to_string(pMsg.size()) + " bytes"; });
+        
+        // Thread-safe update of binary transfer state. Chunks carry no framing
+        // of their own, so each one is credited to the oldest incomplete stream
+        // (announcement order); completed streams are retired so the following
+        // pipelined transfer starts filling immediately.
+        bool transferComplete = false;
+        bool sinkBound = false;
+        bool verifyCrc = false;
+        bool checksumValid = false;
+        std::string streamId;
+        {
+            std::lock_guard<std::mutex> lock(mImpl->binaryMutex);
+
+            if (!mImpl->binaryStreams.empty())
+            {
+                Impl::BinaryStream& stream = mImpl->binaryStreams.front();
+                streamId = stream.id;
+                sinkBound = stream.sinkBound;
+                verifyCrc = stream.verifyCrc;
+
+                // Check for integer overflow before adding
+                if (pMsg.size() > SIZE_MAX - stream.bytesReceived)
+                {
+                    Logger::Instance().Error("WsClient",
+                        "Binary transfer overflow detected - resetting");
+                    mImpl->binaryStreams.clear();
+                    mImpl->messageRouter.RouteProtocolError(
+                        "Binary transfer size overflow - possible attack or corruption");
+                    return;
+                }
+
+                // Update total bytes received for this stream
+                stream.bytesReceived += pMsg.size();
+
+                // Fold the chunk into the running checksum as it arrives, so
+                // verification never needs a second pass over the payload
+                if (stream.verifyCrc)
+                    stream.crcState = Crc32c::Extend(
+                        stream.crcState, pMsg.data(), pMsg.size());
+
+                // Check if this stream's transfer is complete
+                // (received >= expected size from BinaryStart message)
+                if (stream.bytesReceived >= stream.expectedSize)
+                {
+                    transferComplete = true;
+                    if (stream.verifyCrc)
+                        checksumValid =
+                            (Crc32c::Finalize(stream.crcState) == stream.expectedCrc);
+                    mImpl->binaryStreams.pop_front();
+                }
+            }
+            // else: chunk with no announced transfer - routed below with an
+            // empty stream id, matching the previous tolerant behavior
+        }
+
+        if (sinkBound && mImpl->binarySink)
+        {
+            // A sink accepted this transfer - stream the chunk straight into
+            // it (outside the lock), keeping memory bounded regardless of
+            // transfer size. The message handler is not involved for chunks.
+            if (!mImpl->binarySink->Write(
+                    reinterpret_cast<const uint8_t*>(pMsg.data()), pMsg.size()))
+            {
+                Logger::Instance().Error("WsClient",
+                    "Binary sink write failed for stream '" + streamId + "'");
+                mImpl->binarySink->OnAbort("sink write failure");
+                mImpl->messageRouter.RouteProtocolError(
+                    "Binary sink write failed for stream: " + streamId);
+
+                // Drop all pending reassembly state; the sink was already told
+                // about the abort above
+                {
+                    std::lock_guard<std::mutex> lock(mImpl->binaryMutex);
+                    mImpl->binaryStreams.clear();
+                }
+                return;
+            }
+
+            if (transferComplete)
+            {
+                // The sink still sees the completion on a checksum mismatch;
+                // the error path tells the application the data is suspect
+                if (verifyCrc && !checksumValid)
+                {
+                    Logger::Instance().Error("WsClient",
+                        "Checksum mismatch on binary stream '" + streamId + "'");
+                    mImpl->messageRouter.RouteProtocolError(
+                        "Checksum mismatch on binary stream '" + streamId + "'");
+                }
+                mImpl->binarySink->OnComplete(streamId);
+            }
+        }
+        else
+        {
+            // Route binary chunk to application handler (outside lock to avoid
+            // deadlock). The buffer is offered with ownership transfer: handlers
+            // implementing OnBinaryChunkOwned receive it zero-copy, everyone
+            // else gets the traditional copy-based OnBinaryChunk fallback.
+            mImpl->messageRouter.RouteBinaryDataOwned(streamId, std::move(pMsg));
+
+            if (transferComplete)
+            {
+                // Notify handler that this stream's transfer is complete,
+                // with the verification verdict when one was requested
+                if (verifyCrc)
+                    mImpl->messageRouter.RouteBinaryComplete(streamId, checksumValid);
+                else
+                    mImpl->messageRouter.RouteBinaryComplete(streamId);
+            }
+        }
+    }
+    else
+    {
+        // Text message received (usually JSON protocol)
+        // (lazy: the substring copy is skipped unless Debug is emitted)
+        Logger::Instance().Debug("WsClient", [&pMsg] {
+            return "[RECV][TEXT] " + pMsg.substr(0, 100) +
+                   (pMsg.length() > 100 ? "..." : ""); });
+        
+        // Coalesced batch frame? (RFC 7464-style: 0x1E record separator
+        // before each JSON record). Unpack and route each record so handlers
+        // see individual messages exactly as with per-frame sends.
+        if (!pMsg.empty() && pMsg[0] == '\x1E')
+        {
+            std::string_view rest(pMsg);
+            size_t batchCount = 0;
+            size_t pos = 0;
+            while (pos < rest.size() && rest[pos] == '\x1E')
+            {
+                size_t end = rest.find('\x1E', pos + 1);
+                if (end == std::string_view::npos)
+                    end = rest.size();
+
+                std::string_view record = rest.substr(pos + 1, end - pos - 1);
+                if (!record.empty() && record.back() == '\n')
+                    record.remove_suffix(1);
+
+                if (!record.empty())
+                {
+                    HandleControlMessage(Protocol::ParseJsonMessageView(record));
+                    ++batchCount;
+                }
+                pos = end;
+            }
+
+            Logger::Instance().Debug("WsClient", [batchCount] {
+                return "[RECV][BATCH] " + std::to_string(batchCount) +
+                       " coalesced messages"; });
+            return;
+        }
+
+        // Parse JSON into a non-owning view - no allocations on the hot path -
+        // and run the shared control-message logic (ack retirement, binary-mode
+        // negotiation, BinaryStart bookkeeping, handler routing)
+        HandleControlMessage(Protocol::ParseJsonMessageView(pMsg));
+    }
+}
+
+void WsClient::HandleFramedChunk(const std::string& pMsg)
+{
+    const Protocol::BinaryChunkView chunk = Protocol::ParseBinaryChunkView(pMsg);
+    if (!chunk.valid)
+    {
+        Logger::Instance().Warning("WsClient",
+            "Malformed framed binary chunk (" + std::to_string(pMsg.size()) +
+            " bytes)");
+        mImpl->messageRouter.RouteProtocolError("Malformed framed binary chunk");
+        return;
+    }
+
+    Logger::Instance().Debug("WsClient", [&chunk] {
+        return "[RECV][CHUNK] stream '" + std::string(chunk.streamId) +
+               "' seq " + std::to_string(chunk.sequence) +
+               " offset " + std::to_string(chunk.offset) + ", " +
+               std::to_string(chunk.payload.size()) + " bytes"; });
+
+    const std::string streamId(chunk.streamId);
+
+    // Commit decisions are made under the lock; sink and handler calls happen
+    // outside it, mirroring the unframed chunk path
+    bool transferComplete = false;
+    bool sinkBound = false;
+    bool verifyCrc = false;
+    bool checksumValid = false;
+    bool offsetDelivery = false;
+    bool deliverLive = false;
+    bool duplicate = false;
+    std::string abortReason;
+    std::vector<std::string> released;  // Window chunks this commit made contiguous
+    {
+        std::lock_guard<std::mutex> lock(mImpl->binaryMutex);
+
+        auto it = std::find_if(
+            mImpl->binaryStreams.begin(), mImpl->binaryStreams.end(),
+            [&streamId](const Impl::BinaryStream& s) { return s.id == streamId; });
+        if (it == mImpl->binaryStreams.end())
+        {
+            Logger::Instance().Warning("WsClient",
+                "Framed chunk for unknown stream '" + streamId + "'");
+            mImpl->messageRouter.RouteProtocolError(
+                "Framed chunk for unknown stream: " + streamId);
+            return;
+        }
+
+        Impl::BinaryStream& stream = *it;
+        sinkBound = stream.sinkBound;
+        verifyCrc = stream.verifyCrc;
+        offsetDelivery = stream.offsetDelivery;
+
+        // A chunk addressed past the announced size is corruption or attack
+        if (chunk.offset > stream.expectedSize ||
+            chunk.payload.size() > stream.expectedSize - chunk.offset)
+        {
+            abortReason = "Framed chunk exceeds announced size on stream '" +
+                          streamId + "'";
+            mImpl->binaryStreams.erase(it);
+        }
+        else if (offsetDelivery)
+        {
+            // Committed straight at its offset below - just account for it
+            stream.bytesReceived += chunk.payload.size();
+            if (stream.bytesReceived >= stream.expectedSize)
+            {
+                transferComplete = true;
+                mImpl->binaryStreams.erase(it);
+            }
+        }
+        else if (chunk.offset < stream.nextOffset)
+        {
+            duplicate = true;  // Replay of an already-committed range
+        }
+        else if (chunk.offset == stream.nextOffset)
+        {
+            // In-order: commit the live chunk, then every window entry the
+            // freed gap makes contiguous (checksum folds in commit order, so
+            // verification stays single-pass even with reordering)
+            deliverLive = true;
+            stream.nextOffset += chunk.payload.size();
+            stream.bytesReceived += chunk.payload.size();
+            if (stream.verifyCrc)
+                stream.crcState = Crc32c::Extend(
+                    stream.crcState, chunk.payload.data(), chunk.payload.size());
+
+            auto next = stream.window.begin();
+            while (next != stream.window.end() &&
+                   next->first == stream.nextOffset)
+            {
+                std::string& piece = next->second;
+                stream.nextOffset += piece.size();
+                stream.bytesReceived += piece.size();
+                stream.windowBytes -= piece.size();
+                if (stream.verifyCrc)
+                    stream.crcState = Crc32c::Extend(
+                        stream.crcState, piece.data(), piece.size());
+                released.push_back(std::move(piece));
+                next = stream.window.erase(next);
+            }
+
+            if (stream.bytesReceived >= stream.expectedSize &&
+                stream.window.empty())
+            {
+                transferComplete = true;
+                if (stream.verifyCrc)
+                    checksumValid =
+                        (Crc32c::Finalize(stream.crcState) == stream.expectedCrc);
+                mImpl->binaryStreams.erase(it);
+            }
+        }
+        else if (stream.window.find(chunk.offset) != stream.window.end())
+        {
+            duplicate = true;  // Already buffered at this offset
+        }
+        else if (stream.windowBytes + chunk.payload.size() >
+                 mImpl->config.chunkReassemblyWindowBytes)
+        {
+            abortReason = "Reorder window exceeded on stream '" + streamId +
+                          "' (" + std::to_string(stream.windowBytes) +
+                          " bytes buffered)";
+            mImpl->binaryStreams.erase(it);
+        }
+        else
+        {
+            // Future chunk - park it until the gap before it fills
+            stream.windowBytes += chunk.payload.size();
+            stream.window.emplace(chunk.offset, std::string(chunk.payload));
+        }
+    }
+
+    if (duplicate)
+    {
+        Logger::Instance().Debug("WsClient", [&chunk] {
+            return "Duplicate framed chunk ignored (offset " +
+                   std::to_string(chunk.offset) + ")"; });
+        return;
+    }
+
+    if (!abortReason.empty())
+    {
+        Logger::Instance().Error("WsClient", abortReason);
+        if (sinkBound && mImpl->binarySink)
+            mImpl->binarySink->OnAbort(abortReason);
+        mImpl->messageRouter.RouteProtocolError(abortReason);
+        return;
+    }
+
+    if (offsetDelivery)
+    {
+        // Offset-capable sink: the chunk lands at its final position with no
+        // reorder buffering at all, whatever order it arrived in
+        if (!mImpl->binarySink->WriteAt(
+                chunk.offset,
+                reinterpret_cast<const uint8_t*>(chunk.payload.data()),
+                chunk.payload.size()))
+        {
+            Logger::Instance().Error("WsClient",
+                "Binary sink write failed for stream '" + streamId + "'");
+            mImpl->binarySink->OnAbort("sink write failure");
+            mImpl->messageRouter.RouteProtocolError(
+                "Binary sink write failed for stream: " + streamId);
+            std::lock_guard<std::mutex> lock(mImpl->binaryMutex);
+            mImpl->binaryStreams.clear();
+            return;
+        }
+
+        if (transferComplete)
+            mImpl->binarySink->OnComplete(streamId);
+        return;
+    }
+
+    // Ordered delivery: the live chunk first, then whatever it released
+    if (sinkBound && mImpl->binarySink)
+    {
+        bool writeOk = true;
+        if (deliverLive)
+            writeOk = mImpl->binarySink->Write(
+                reinterpret_cast<const uint8_t*>(chunk.payload.data()),
+                chunk.payload.size());
+        for (const std::string& piece : released)
+        {
+            if (!writeOk)
+                break;
+            writeOk = mImpl->binarySink->Write(
+                reinterpret_cast<const uint8_t*>(piece.data()), piece.size());
+        }
+
+        if (!writeOk)
+        {
+            Logger::Instance().Error("WsClient",
+                "Binary sink write failed for stream '" + streamId + "'");
+            mImpl->binarySink->OnAbort("sink write failure");
+            mImpl->messageRouter.RouteProtocolError(
+                "Binary sink write failed for stream: " + streamId);
+            std::lock_guard<std::mutex> lock(mImpl->binaryMutex);
+            mImpl->binaryStreams.clear();
+            return;
+        }
+
+        if (transferComplete)
+        {
+            // The sink still sees the completion on a checksum mismatch;
+            // the error path tells the application the data is suspect
+            if (verifyCrc && !checksumValid)
+            {
+                Logger::Instance().Error("WsClient",
+                    "Checksum mismatch on binary stream '" + streamId + "'");
+                mImpl->messageRouter.RouteProtocolError(
+                    "Checksum mismatch on binary stream '" + streamId + "'");
+            }
+            mImpl->binarySink->OnComplete(streamId);
+        }
+    }
+    else
+    {
+        if (deliverLive)
+            mImpl->messageRouter.RouteBinaryDataOwned(
+                streamId, std::string(chunk.payload));
+        for (std::string& piece : released)
+            mImpl->messageRouter.RouteBinaryDataOwned(streamId, std::move(piece));
+
+        if (transferComplete)
+        {
+            if (verifyCrc)
+                mImpl->messageRouter.RouteBinaryComplete(streamId, checksumValid);
+            else
+                mImpl->messageRouter.RouteBinaryComplete(streamId);
+        }
+    }
+}
+
+void WsClient::HandleControlMessage(const Protocol::MessageView& msg)
+{
+    // Retire the matching send-window entry when an Acknowledge arrives
+    // (no-op unless ack tracking is enabled and the id is in flight)
+    if (msg.type == Protocol::MessageType::Acknowledge &&
+        mImpl->config.ackWindowSize > 0)
+    {
+        mImpl->CompleteAck(std::string(msg.msgId));
+    }
+
+    // Binary protocol negotiation: a Hello whose content advertises a 2.x
+    // version (token "ver=<version>") upgrades this connection's control
+    // messages from JSON to the compact binary encoding. Peers that never
+    // advertise 2.x keep talking JSON - nothing to do.
+    if (msg.type == Protocol::MessageType::Hello &&
+        mImpl->config.enableBinaryProtocol &&
+        Protocol::VersionSupportsBinary(mImpl->config.protocolVersion) &&
+        !mImpl->binaryProtocolActive.load(std::memory_order_relaxed))
+    {
+        const size_t verPos = msg.content.find("ver=");
+        if (verPos != std::string_view::npos &&
+            Protocol::VersionSupportsBinary(msg.content.substr(verPos + 4)))
+        {
+            mImpl->binaryProtocolActive.store(true, std::memory_order_relaxed);
+            Logger::Instance().Info("WsClient",
+                "Binary protocol mode negotiated (peer advertised " +
+                std::string(msg.content.substr(verPos + 4)) + ")");
+        }
+    }
+
+    // Track expected binary size if this is a BinaryStart message
+    if (msg.type == Protocol::MessageType::BinaryStart)
+    {
+        std::lock_guard<std::mutex> lock(mImpl->binaryMutex);
+        
+        // Validate against maximum payload size (security check)
+        if (msg.binarySize > mImpl->config.maxBinaryPayloadSize)
+        {
+            Logger::Instance().Error("WsClient", 
+                "BinaryStart size exceeds max: " + 
+                std::to_string(msg.binarySize) + " > " + 
+                std::to_string(mImpl->config.maxBinaryPayloadSize));
+            mImpl->messageRouter.RouteProtocolError(
+                "Binary payload size exceeds maximum allowed: " + 
+                std::to_string(msg.binarySize));
+            return;
+        }
+        
+        // Validate non-zero size
+        if (msg.binarySize == 0)
+        {
+            Logger::Instance().Warning("WsClient", 
+                "BinaryStart with zero size - ignoring");
+            mImpl->messageRouter.RouteProtocolError(
+                "BinaryStart message with zero size is invalid");
+            return;
+        }
+        
+        // Open a new reassembly stream keyed by the announcing msgId;
+        // multiple announcements may be outstanding at once (pipelining)
+        Impl::BinaryStream stream;
+        stream.id = std::string(msg.msgId);
+        stream.expectedSize = msg.binarySize;
+
+        // Opt into incremental verification when the sender announced a
+        // checksum (optional field - absent means no verification)
+        if (msg.hasCrc32c)
+        {
+            stream.verifyCrc = true;
+            stream.expectedCrc = msg.crc32c;
+        }
+
+        // Offer the transfer to the registered sink so it can reserve its
+        // destination up front; if it declines, chunks fall back to the
+        // message-handler path for this stream
+        if (mImpl->binarySink)
+            stream.sinkBound = mImpl->binarySink->OnStart(stream.id, stream.expectedSize);
+
+        // Offset-capable sinks take framed chunks straight at their final
+        // position - no reorder buffering at all. CRC verification needs the
+        // bytes folded in order, so verified streams keep the ordered window
+        if (stream.sinkBound && mImpl->config.enableChunkFraming &&
+            !stream.verifyCrc && mImpl->binarySink->SupportsOffsetWrites())
+        {
+            stream.offsetDelivery = true;
+        }
+
+        mImpl->binaryStreams.push_back(std::move(stream));
+
+        Logger::Instance().Debug("WsClient", [this, &msg] {
+            return "Binary transfer starting: stream '" + std::string(msg.msgId) +
+                   "', " + std::to_string(msg.binarySize) + " bytes expected (" +
+                   std::to_string(mImpl->binaryStreams.size()) + " in flight)"; });
+    }
+
+    // Route parsed message to application handler (view-first; the router
+    // materializes an owning Message only if the handler doesn't opt in)
+    mImpl->messageRouter.RouteMessageView(msg);
+}
+
+void WsClient::OnClose()
+{
+    // Connection closed by server - update state and notify waiters
+    {
+        std::lock_guard<std::mutex> lock(mImpl->stateMutex);
+        mImpl->state = ConnectionState::Disconnected;
+        mImpl->shutdownComplete = true;  // Signal that shutdown is complete
+    }
+    
+    // Reset binary transfer state to prevent stale values on reconnect
+    mImpl->ResetBinaryState();
+    
+    // Notify all threads waiting in WaitForConnection()
+    mImpl->stateCV.notify_all();
+    
+    // Notify any threads waiting in Close() for shutdown to complete
+    mImpl->shutdownCV.notify_all();
+
+    // Unexpected disconnects wake the reconnection engine (no-op when
+    // disabled or when the user is closing intentionally)
+    mImpl->SignalConnectionLost();
+
+    // Resume coroutines awaiting the connection outcome
+    mImpl->FireStateSettled(ConnectionState::Disconnected);
+
+    Logger::Instance().Info("WsClient", 
+        "Server closed the connection");
+}
+
+void WsClient::OnError(const std::string& pReason)
+{
+    // Error occurred - update state and notify waiters
+    {
+        std::lock_guard<std::mutex> lock(mImpl->stateMutex);
+        mImpl->state = ConnectionState::Error;
+    }
+    
+    // Notify all threads waiting in WaitForConnection()
+    mImpl->stateCV.notify_all();
+
+    // Errors drop the connection too - wake the reconnection engine
+    mImpl->SignalConnectionLost();
+
+    // Resume coroutines awaiting the connection outcome
+    mImpl->FireStateSettled(ConnectionState::Error);
+
+    Logger::Instance().Error("WsClient", 
+        "Connection error: " + pReason);
+}
@@ -1,370 +1,971 @@
-// CodeRabbit: Please review this file thoroughly for production readiness
-#pragma once
-
-#include <string>
-#include <memory>
-#include <mutex>
-#include <condition_variable>
-#include "Protocol.hpp"
-#include "MessageHandler.hpp"
-
-/**
- * @class WsClient
- * @brief Production-grade WebSocket client with thread-safe synchronization.
- * 
- * This class provides a high-level WebSocket client interface for TallyIX communication.
- * It manages connection state, sends/receives messages, and routes protocol messages to
- * application handlers. The client is designed to be:
- * 
- * - **Thread-Safe**: Multiple threads can call Send* methods safely without coordination
- * - **Async-Friendly**: Connection is non-blocking; use WaitForConnection() for sync
- * - **State-Managed**: Internal state machine prevents invalid operations (e.g., sending before connected)
- * - **Exception-Safe**: Uses smart pointers; proper cleanup on error or destruction
- * 
- * Architecture:
- * - Uses Pimpl (Pointer to Implementation) pattern for clean separation
- * - IXWebSocket library handles low-level WebSocket protocol
- * - State changes guarded by mutex + condition variable
- * - Callbacks dispatched to IMessageHandler via MessageRouter
- * 
- * Usage Pattern:
- * @code
- *   WsClient client(config);
- *   client.SetMessageHandler(&myHandler);
- *   client.Open();                          // Initialize system
- *   client.Connect("ws://server.com");      // Start connection (non-blocking)
- *   client.WaitForConnection(5000);         // Wait up to 5 seconds
- *   client.SendText(json_message);          // Send when connected
- *   client.Close();                         // Graceful shutdown
- * @endcode
- * 
- * Thread Safety:
- * - Constructor/Destructor: Main thread only
- * - Open/Connect/Close: Main thread (called before/after using Send*)
- * - SendText/SendBinary: Any thread (thread-safe)
- * - GetState: Any thread (atomic read)
- * - Callbacks (OnOpen, OnMessage, etc.): WebSocket internal thread
- * 
- * @note The WebSocket client runs an internal thread managed by IXWebSocket.
- *       All callbacks (OnOpen, OnMessage, OnClose, OnError) are called from
- *       this thread, not your main thread.
- * 
- * @see IMessageHandler for how to handle incoming messages
- * @see Protocol for message structure and configuration
- */
-class WsClient
-{
-public:
-    /**
-     * @enum ConnectionState
-     * @brief Enumeration of possible WebSocket connection states.
-     * 
-     * These states represent the lifecycle of a WebSocket connection:
-     */
-    enum class ConnectionState
-    {
-        Disconnected,  ///< Not connected or connection was closed
-        Connecting,    ///< Connection in progress (after Connect(), before OnOpen())
-        Connected,     ///< Connection established and ready for communication
-        Closing,       ///< Graceful shutdown in progress
-        Error          ///< Error state (connection failed or error received)
-    };
-
-    /**
-     * @brief Construct a WebSocket client with protocol configuration.
-     * 
-     * @param config Protocol configuration including timeouts and size limits.
-     *               Defaults to Protocol::Config() if not provided.
-     * 
-     * @note The client is initially in Disconnected state and requires Open() before use.
-     * 
-     * @example
-     *   Protocol::Config config;
-     *   config.connectionTimeoutMs = 30000;  // 30 second timeout
-     *   WsClient client(config);
-     */
-    WsClient(const Protocol::Config& config = Protocol::Config());
-
-    /**
-     * @brief Destructor - closes connection and cleans up resources.
-     * 
-     * @note If the connection is still open, it will be closed gracefully.
-     *       The destructor blocks briefly to allow the background thread to exit.
-     */
-    ~WsClient();
-
-    // Prevent copying and moving (singleton-like usage per connection)
-    /// @brief Copy constructor - deleted (not copyable)
-    WsClient(const WsClient&) = delete;
-    
-    /// @brief Assignment operator - deleted (not assignable)
-    WsClient& operator=(const WsClient&) = delete;
-
-    /**
-     * @brief Initialize the WebSocket network system (must be called once).
-     * 
-     * This function initializes the underlying IXWebSocket library, which sets up
-     * the network stack. Must be called before any connection attempts. Safe to call
-     * multiple times, but subsequent calls have no effect.
-     * 
-     * @return true if initialization succeeded, false on error
-     * 
-     * @note Must be called from the main thread before calling Connect()
-     * 
-     * @example
-     *   if (!client.Open()) {
-     *       Logger::Instance().Error("App", "Failed to open network system");
-     *       return;
-     *   }
-     */
-    bool Open();
-
-    /**
-     * @brief Initiate connection to WebSocket server (non-blocking).
-     * 
-     * This starts a connection attempt to the given URL. The function returns
-     * immediately; use WaitForConnection() to block until the connection is
-     * established or times out.
-     * 
-     * @param pUrl WebSocket URL (e.g., "ws://localhost:9001" or "wss://secure.host")
-     * @return true if connection was initiated, false if already connecting/connected
-     * 
-     * @note This is non-blocking. Call WaitForConnection() to wait for actual connection.
-     * @note Returns false if not in Disconnected state (to prevent multiple connections)
-     * 
-     * @example
-     *   client.Connect("ws://127.0.0.1:9001");
-     *   bool connected = client.WaitForConnection(10000);  // Wait up to 10 seconds
-     * 
-     * @see WaitForConnection
-     */
-    bool Connect(const std::string& pUrl);
-
-    /**
-     * @brief Block until connection is established (with timeout).
-     * 
-     * This function blocks the calling thread until one of three things happens:
-     * 1. Connection succeeds (returns true)
-     * 2. Connection fails (returns false)
-     * 3. Timeout expires (returns false)
-     * 
-     * Uses a condition variable for efficient waiting (not busy-polling).
-     * 
-     * @param timeoutMs Timeout in milliseconds (how long to wait)
-     * @return true if connected successfully, false if timeout or error
-     * 
-     * @note This blocks the calling thread; call from non-critical paths
-     * @note Must be called after Connect(); otherwise waits for the timeout and returns false
-     * 
-     * @example
-     *   client.Connect("ws://server");
-     *   if (!client.WaitForConnection(5000)) {
-     *       Logger::Instance().Error("App", "Connection timeout");
-     *       return;
-     *   }
-     *   // Connection now established
-     * 
-     * @see Connect
-     */
-    bool WaitForConnection(int timeoutMs);
-
-    /**
-     * @brief Send a text message (thread-safe).
-     * 
-     * Sends a text message to the connected server. This is the typical way to send
-     * protocol messages (which are JSON format). Thread-safe - can be called from
-     * any thread without synchronization.
-     * 
-     * @param pText The message text to send (e.g., JSON string)
-     * @return true if message was queued for sending, false if not connected or error
-     * 
-     * @note Returns false silently if not connected; no exception is thrown
-     * @note Message is queued for sending; actual transmission is asynchronous
-     * 
-     * @example
-     *   Protocol::Message msg(MessageType::Hello, "123", "Hello Server");
-     *   std::string json = Protocol::SerializeJsonMessage(msg);
-     *   if (!client.SendText(json)) {
-     *       Logger::Instance().Error("App", "Failed to send hello message");
-     *   }
-     * 
-     * @see SendBinary
-     */
-    bool SendText(const std::string& pText);
-
-    /**
-     * @brief Send a binary message (thread-safe).
-     * 
-     * Sends binary data to the connected server. Thread-safe - can be called from
-     * any thread without synchronization. The data is typically preceded by a
-     * BinaryStart text message containing size metadata.
-     * 
-     * @param pData Pointer to binary data to send
-     * @param pSize Size of data in bytes
-     * @return true if message was queued for sending, false if not connected or too large
-     * 
-     * @note Returns false if data exceeds maxBinaryPayloadSize from config
-     * @note Data must remain valid until this function returns; it's copied internally
-     * @note Message is queued for sending; actual transmission is asynchronous
-     * 
-     * @example
-     *   // First send metadata
-     *   Protocol::Message meta(MessageType::BinaryStart, "456");
-     *   meta.binarySize = 1024;
-     *   client.SendText(Protocol::SerializeJsonMessage(meta));
-     *   
-     *   // Then send binary data
-     *   uint8_t data[1024];
-     *   if (!client.SendBinary(data, 1024)) {
-     *       Logger::Instance().Error("App", "Failed to send binary");
-     *   }
-     * 
-     * @see SendText
-     */
-    bool SendBinary(const void* pData, size_t pSize);
-
-    /**
-     * @brief Send a WebSocket ping frame (thread-safe).
-     * 
-     * Sends a ping frame to the server for keep-alive or latency measurement.
-     * The server should respond with a pong frame. Thread-safe - can be called
-     * from any thread.
-     * 
-     * @param payload Optional ping payload data (max 125 bytes per RFC 6455)
-     * @return true if ping was queued for sending, false if not connected
-     * 
-     * @note Pong responses are handled automatically by IXWebSocket
-     * @note For automatic heartbeat, use pingIntervalSeconds in Config instead
-     * 
-     * @example
-     *   client.SendPing("heartbeat");  // Manual ping
-     * 
-     * @see Config::pingIntervalSeconds for automatic heartbeat
-     */
-    bool SendPing(const std::string& payload = "");
-
-    /**
-     * @brief Enable per-message deflate compression at runtime.
-     * 
-     * Enables compression for subsequent messages. Both client and server must
-     * support compression (RFC 7692) for this to have any effect.
-     * 
-     * @note Call before Connect() for best results; some servers negotiate
-     *       compression only during the initial handshake.
-     * @note Compression adds CPU overhead but reduces bandwidth usage.
-     * 
-     * @see DisableCompression
-     */
-    void EnableCompression();
-
-    /**
-     * @brief Disable per-message deflate compression at runtime.
-     * 
-     * Disables compression for subsequent messages. Useful when sending
-     * already-compressed data (images, video) or on low-power devices.
-     * 
-     * @see EnableCompression
-     */
-    void DisableCompression();
-
-    /**
-     * @brief Get the current connection state.
-     * 
-     * Returns the current state of the connection. This is an atomic read and can
-     * be safely called from any thread.
-     * 
-     * @return Current ConnectionState enum value
-     * 
-     * @note This is informational only; checking state before Send* may not be
-     *       reliable due to race conditions. Send* methods will safely fail if
-     *       not connected.
-     * 
-     * @example
-     *   if (client.GetState() == WsClient::ConnectionState::Connected) {
-     *       // We might be connected, but still check SendText return value
-     *   }
-     */
-    ConnectionState GetState() const;
-
-    /**
-     * @brief Get the current connection state as a human-readable string.
-     * 
-     * Useful for debugging and logging purposes.
-     * 
-     * @return String representation of current state (e.g., "Connected", "Disconnected")
-     */
-    std::string GetStateString() const;
-
-    /**
-     * @brief Set the handler for receiving parsed protocol messages.
-     * 
-     * Registers an IMessageHandler implementation that will receive callbacks
-     * when protocol messages arrive. The handler is called from the WebSocket
-     * thread, not your main thread.
-     * 
-     * @param handler Pointer to IMessageHandler implementation, or nullptr to disable routing
-     * 
-     * @note Should be called before connecting to avoid missing initial messages
-     * @note The handler must outlive the client (or call again with nullptr before handler is destroyed)
-     * @note All handler callbacks come from the WebSocket thread
-     * 
-     * @example
-     *   class MyHandler : public IMessageHandler {
-     *       // ... implement pure virtual methods
-     *   };
-     *   MyHandler handler;
-     *   client.SetMessageHandler(&handler);
-     *   client.Connect("ws://...");
-     * 
-     * @see IMessageHandler
-     */
-    void SetMessageHandler(IMessageHandler* handler);
-
-    /**
-     * @brief Close the connection gracefully.
-     * 
-     * Gracefully closes the WebSocket connection and waits briefly for the
-     * background thread to exit. After Close(), the client cannot be reused;
-     * create a new WsClient to reconnect.
-     * 
-     * @note Blocks briefly (up to 100ms) for thread cleanup
-     * @note Safe to call multiple times (subsequent calls do nothing)
-     * @note Called automatically by destructor
-     * 
-     * @example
-     *   client.Connect("ws://server");
-     *   // ... use client ...
-     *   client.Close();  // Graceful shutdown
-     */
-    void Close();
-
-private:
-    /**
-     * @class Impl
-     * @brief Private implementation class (Pimpl pattern).
-     * 
-     * Contains all internal state for the WebSocket client. Hidden here to avoid
-     * exposing IXWebSocket headers in the public interface.
-     */
-    class Impl;
-    
-    /// @brief Unique pointer to implementation (RAII - automatic cleanup)
-    std::unique_ptr<Impl> mImpl;
-
-    // Private callback handlers (invoked from IXWebSocket internal thread)
-    
-    /// @brief Callback when connection is established
-    void OnOpen();
-    
-    /// @brief Callback when message is received
-    void OnMessage(const std::string& pMsg, bool pIsBinary);
-    
-    /// @brief Callback when connection is closed by server
-    void OnClose();
-    
-    /// @brief Callback when connection error occurs
-    void OnError(const std::string& pReason);
-
-    /// @brief Allow Impl to call private callback methods
-    friend class Impl;
-};
+// CodeRabbit: Please review this file thoroughly for production readiness
+#pragma once
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <span>
+#include <functional>
+#include "Protocol.hpp"
+#include "MessageHandler.hpp"
+
+// Forward declaration - full definition in BinarySink.hpp
+class BinarySink;
+
+/**
+ * @class WsClient
+ * @brief Production-grade WebSocket client with thread-safe synchronization.
+ * 
+ * This class provides a high-level WebSocket client interface for TallyIX communication.
+ * It manages connection state, sends/receives messages, and routes protocol messages to
+ * application handlers. The client is designed to be:
+ * 
+ * - **Thread-Safe**: Multiple threads can call Send* methods safely without coordination
+ * - **Async-Friendly**: Connection is non-blocking; use WaitForConnection() for sync
+ * - **State-Managed**: Internal state machine prevents invalid operations (e.g., sending before connected)
+ * - **Exception-Safe**: Uses smart pointers; proper cleanup on error or destruction
+ * 
+ * Architecture:
+ * - Uses Pimpl (Pointer to Implementation) pattern for clean separation
+ * - IXWebSocket library handles low-level WebSocket protocol
+ * - State changes guarded by mutex + condition variable
+ * - Callbacks dispatched to IMessageHandler via MessageRouter
+ * 
+ * Usage Pattern:
+ * @code
+ *   WsClient client(config);
+ *   client.SetMessageHandler(&myHandler);
+ *   client.Open();                          // Initialize system
+ *   client.Connect("ws://server.com");      // Start connection (non-blocking)
+ *   client.WaitForConnection(5000);         // Wait up to 5 seconds
+ *   client.SendText(json_message);          // Send when connected
+ *   client.Close();                         // Graceful shutdown
+ * @endcode
+ * 
+ * Thread Safety:
+ * - Constructor/Destructor: Main thread only
+ * - Open/Connect/Close: Main thread (called before/after using Send*)
+ * - SendText/SendBinary: Any thread (thread-safe)
+ * - GetState: Any thread (atomic read)
+ * - Callbacks (OnOpen, OnMessage, etc.): WebSocket internal thread
+ * 
+ * @note The WebSocket client runs an internal thread managed by IXWebSocket.
+ *       All callbacks (OnOpen, OnMessage, OnClose, OnError) are called from
+ *       this thread, not your main thread.
+ * 
+ * @see IMessageHandler for how to handle incoming messages
+ * @see Protocol for message structure and configuration
+ */
+class WsClient
+{
+public:
+    /**
+     * @enum ConnectionState
+     * @brief Enumeration of possible WebSocket connection states.
+     * 
+     * These states represent the lifecycle of a WebSocket connection:
+     */
+    enum class ConnectionState
+    {
+        Disconnected,  ///< Not connected or connection was closed
+        Connecting,    ///< Connection in progress (after Connect(), before OnOpen())
+        Connected,     ///< Connection established and ready for communication
+        Closing,       ///< Graceful shutdown in progress
+        Error          ///< Error state (connection failed or error received)
+    };
+
+    /**
+     * @brief Construct a WebSocket client with protocol configuration.
+     * 
+     * @param config Protocol configuration including timeouts and size limits.
+     *               Defaults to Protocol::Config() if not provided.
+     * 
+     * @note The client is initially in Disconnected state and requires Open() before use.
+     * 
+     * @example
+     *   Protocol::Config config;
+     *   config.connectionTimeoutMs = 30000;  // 30 second timeout
+     *   WsClient client(config);
+     */
+    WsClient(const Protocol::Config& config = Protocol::Config());
+
+    /**
+     * @brief Destructor - closes connection and cleans up resources.
+     * 
+     * @note If the connection is still open, it will be closed gracefully.
+     *       The destructor blocks briefly to allow the background thread to exit.
+     */
+    ~WsClient();
+
+    // Prevent copying and moving (singleton-like usage per connection)
+    /// @brief Copy constructor - deleted (not copyable)
+    WsClient(const WsClient&) = delete;
+    
+    /// @brief Assignment operator - deleted (not assignable)
+    WsClient& operator=(const WsClient&) = delete;
+
+    /**
+     * @brief Initialize the WebSocket network system (must be called once).
+     * 
+     * This function initializes the underlying IXWebSocket library, which sets up
+     * the network stack. Must be called before any connection attempts. Safe to call
+     * multiple times, but subsequent calls have no effect.
+     * 
+     * @return true if initialization succeeded, false on error
+     * 
+     * @note Must be called from the main thread before calling Connect()
+     * 
+     * @example
+     *   if (!client.Open()) {
+     *       Logger::Instance().Error("App", "Failed to open network system");
+     *       return;
+     *   }
+     */
+    bool Open();
+
+    /**
+     * @brief Warm the network path to a server before Connect is called.
+     *
+     * Performs the slow first-contact work ahead of time: resolves the URL's
+     * hostname (priming the OS resolver cache) and, when pEstablishTcp is
+     * true, opens and immediately closes a TCP connection to the server
+     * (priming ARP/route state and confirming reachability). A subsequent
+     * Connect() then skips the cold DNS lookup that otherwise dominates
+     * fleet startup.
+     *
+     * Also performs the process-wide network system initialization, so a
+     * prewarmed process never pays it again in Open().
+     *
+     * @param pUrl WebSocket URL to warm (e.g., "ws://host:9001/path")
+     * @param pEstablishTcp Also open/close a throwaway TCP connection
+     * @return true if the hostname resolved (and, if requested, TCP connected)
+     *
+     * @note TLS sessions are negotiated per-connection by the WebSocket
+     *       library and cannot be pre-established here; for wss:// URLs the
+     *       DNS and TCP warm-up still removes most of the cold-start cost.
+     * @note Thread-safe and instance-free - call before constructing clients.
+     *
+     * @example
+     *   WsClient::Prewarm("ws://server:9001");
+     *   // ... later, per client:
+     *   client.Open();
+     *   client.Connect("ws://server:9001");  // No cold DNS lookup
+     */
+    static bool Prewarm(const std::string& pUrl, bool pEstablishTcp = true);
+
+    /**
+     * @brief Warm the network path to many servers in parallel.
+     *
+     * Runs Prewarm for every URL on a bounded set of worker threads, so a
+     * fleet of hundreds of endpoints warms in roughly the time of the slowest
+     * handful rather than the sum of all lookups.
+     *
+     * @param pUrls URLs to warm
+     * @param pEstablishTcp Also open/close a throwaway TCP connection per URL
+     * @return Number of URLs that warmed successfully
+     *
+     * @example
+     *   const size_t warmed = WsClient::PrewarmAll(fleetUrls);
+     *   Logger::Instance().Info("App", std::to_string(warmed) + " endpoints warm");
+     */
+    static size_t PrewarmAll(const std::vector<std::string>& pUrls,
+                             bool pEstablishTcp = true);
+
+    /**
+     * @brief Initiate connection to WebSocket server (non-blocking).
+     * 
+     * This starts a connection attempt to the given URL. The function returns
+     * immediately; use WaitForConnection() to block until the connection is
+     * established or times out.
+     * 
+     * @param pUrl WebSocket URL (e.g., "ws://localhost:9001" or "wss://secure.host")
+     * @return true if connection was initiated, false if already connecting/connected
+     * 
+     * @note This is non-blocking. Call WaitForConnection() to wait for actual connection.
+     * @note Returns false if not in Disconnected state (to prevent multiple connections)
+     * 
+     * @example
+     *   client.Connect("ws://127.0.0.1:9001");
+     *   bool connected = client.WaitForConnection(10000);  // Wait up to 10 seconds
+     * 
+     * @see WaitForConnection
+     */
+    bool Connect(const std::string& pUrl);
+
+    /**
+     * @brief Block until connection is established (with timeout).
+     * 
+     * This function blocks the calling thread until one of three things happens:
+     * 1. Connection succeeds (returns true)
+     * 2. Connection fails (returns false)
+     * 3. Timeout expires (returns false)
+     * 
+     * Uses a condition variable for efficient waiting (not busy-polling).
+     * 
+     * @param timeoutMs Timeout in milliseconds (how long to wait)
+     * @return true if connected successfully, false if timeout or error
+     * 
+     * @note This blocks the calling thread; call from non-critical paths
+     * @note Must be called after Connect(); otherwise waits for the timeout and returns false
+     * 
+     * @example
+     *   client.Connect("ws://server");
+     *   if (!client.WaitForConnection(5000)) {
+     *       Logger::Instance().Error("App", "Connection timeout");
+     *       return;
+     *   }
+     *   // Connection now established
+     * 
+     * @see Connect
+     */
+    bool WaitForConnection(int timeoutMs);
+
+    /**
+     * @brief Send a text message (thread-safe).
+     * 
+     * Sends a text message to the connected server. This is the typical way to send
+     * protocol messages (which are JSON format). Thread-safe - can be called from
+     * any thread without synchronization.
+     * 
+     * @param pText The message text to send (e.g., JSON string)
+     * @return true if message was queued for sending, false if not connected or error
+     * 
+     * @note Returns false silently if not connected; no exception is thrown
+     * @note Message is queued for sending; actual transmission is asynchronous
+     * 
+     * @example
+     *   Protocol::Message msg(MessageType::Hello, "123", "Hello Server");
+     *   std::string json = Protocol::SerializeJsonMessage(msg);
+     *   if (!client.SendText(json)) {
+     *       Logger::Instance().Error("App", "Failed to send hello message");
+     *   }
+     * 
+     * @see SendBinary
+     */
+    bool SendText(const std::string& pText);
+
+    /**
+     * @brief Send a text message, moving the caller's buffer (thread-safe, no copy).
+     *
+     * Ownership-transfer overload of SendText. The caller's string is moved into
+     * the send path instead of being copied, avoiding the payload duplication the
+     * copy-based overload pays for large messages.
+     *
+     * @param pText The message text to send; left in a valid but unspecified state
+     * @return true if message was queued for sending, false if not connected or error
+     *
+     * @example
+     *   std::string json = Protocol::SerializeJsonMessage(msg);
+     *   client.SendText(std::move(json));  // No payload copy on our side
+     *
+     * @see SendText(const std::string&)
+     */
+    bool SendText(std::string&& pText);
+
+    /**
+     * @brief Send a text message with a per-call compression preference (thread-safe).
+     *
+     * Hint overload for callers that know their payload better than the
+     * connection-level policy: Always forces deflate for this message, Never
+     * sends it raw, Default defers to the adaptive classifier (or the static
+     * setting when adaptive mode is off).
+     *
+     * @param pText The message text to send
+     * @param pHint Compression preference for this payload
+     * @return true if message was queued for sending, false if not connected or error
+     *
+     * @note Requires compression to have been negotiated at the handshake
+     *       (Config::enableCompression) for Always/adaptive decisions to
+     *       change anything on the wire.
+     *
+     * @see SendText(const std::string&), Protocol::CompressionHint
+     */
+    bool SendText(const std::string& pText, Protocol::CompressionHint pHint);
+
+    /**
+     * @brief Send a burst of text messages in one pass (thread-safe).
+     *
+     * Batch counterpart of SendText for telemetry-style bursts: the
+     * connection state is checked once for the whole span and the messages
+     * are queued in a single loop without per-call logging, instead of
+     * paying the full per-message send preamble hundreds of times. With
+     * Config::enableBatchCoalescing set, the entire batch is additionally
+     * packed into one WebSocket frame (RFC 7464-style record separators),
+     * collapsing the per-frame header and queue overhead as well; the
+     * receive path unpacks such frames before routing, so handlers observe
+     * individual messages either way.
+     *
+     * @param pMessages Messages to send, in order
+     * @return Number of messages queued (0 if not connected; all or nothing
+     *         in coalescing mode)
+     *
+     * @example
+     *   std::vector<std::string> burst = BuildTelemetry();
+     *   const size_t sent = client.SendTextBatch(burst);
+     *
+     * @see SendText, Protocol::Config::enableBatchCoalescing
+     */
+    size_t SendTextBatch(std::span<const std::string> pMessages);
+
+    /**
+     * @brief Send a protocol control message in the negotiated encoding (thread-safe).
+     *
+     * Serializes the message as JSON text by default, or - once compact
+     * binary protocol mode has been negotiated with the peer
+     * (Config::enableBinaryProtocol plus a 2.x Hello exchange) - as a
+     * fixed-layout binary frame at a fraction of the bytes and parse cost.
+     * Callers that use this instead of serializing JSON themselves get the
+     * encoding switch for free.
+     *
+     * @param pMsg The protocol message to send
+     * @return true if the message was queued for sending, false if not connected
+     *
+     * @example
+     *   Protocol::Message ack(Protocol::MessageType::Acknowledge, "msg_042");
+     *   client.SendMessage(ack);  // JSON or binary, whichever was negotiated
+     *
+     * @see Protocol::Config::enableBinaryProtocol, Protocol::SerializeBinaryMessage
+     */
+    bool SendMessage(const Protocol::Message& pMsg);
+
+    /**
+     * @brief Send a binary message (thread-safe).
+     * 
+     * Sends binary data to the connected server. Thread-safe - can be called from
+     * any thread without synchronization. The data is typically preceded by a
+     * BinaryStart text message containing size metadata.
+     * 
+     * @param pData Pointer to binary data to send
+     * @param pSize Size of data in bytes
+     * @return true if message was queued for sending, false if not connected or too large
+     * 
+     * @note Returns false if data exceeds maxBinaryPayloadSize from config
+     * @note Data must remain valid until this function returns; it's copied internally
+     * @note Message is queued for sending; actual transmission is asynchronous
+     * 
+     * @example
+     *   // First send metadata
+     *   Protocol::Message meta(MessageType::BinaryStart, "456");
+     *   meta.binarySize = 1024;
+     *   client.SendText(Protocol::SerializeJsonMessage(meta));
+     *   
+     *   // Then send binary data
+     *   uint8_t data[1024];
+     *   if (!client.SendBinary(data, 1024)) {
+     *       Logger::Instance().Error("App", "Failed to send binary");
+     *   }
+     * 
+     * @see SendText
+     */
+    bool SendBinary(const void* pData, size_t pSize);
+
+    /**
+     * @brief Send a binary message, moving the caller's buffer (thread-safe, no copy).
+     *
+     * Ownership-transfer overload of SendBinary. The caller's buffer is moved into
+     * the send path instead of being copied. For a 100MB payload the copy-based
+     * overload constructs a second 100MB string before queueing; this overload does not,
+     * keeping peak memory at roughly one payload instead of 2-3x.
+     *
+     * @param pData The binary payload to send; left in a valid but unspecified state
+     * @return true if message was queued for sending, false if not connected or too large
+     *
+     * @note Still subject to maxBinaryPayloadSize from config
+     *
+     * @example
+     *   std::string payload = BuildPayload();          // e.g. 100MB
+     *   client.SendBinary(std::move(payload));         // No payload copy on our side
+     *
+     * @see SendBinary(const void*, size_t)
+     */
+    bool SendBinary(std::string&& pData);
+
+    /**
+     * @brief Send binary data with a per-call compression preference (thread-safe).
+     *
+     * Hint overload of SendBinary - see the SendText hint overload for the
+     * semantics. Typical use is Never for already-compressed media so the
+     * connection doesn't burn CPU re-deflating it.
+     *
+     * @param pData Pointer to binary data to send
+     * @param pSize Size of data in bytes
+     * @param pHint Compression preference for this payload
+     * @return true if message was queued for sending, false if not connected or too large
+     *
+     * @see SendBinary(const void*, size_t), Protocol::CompressionHint
+     */
+    bool SendBinary(const void* pData, size_t pSize, Protocol::CompressionHint pHint);
+
+    /**
+     * @brief Send a shared binary buffer, allowing fan-out to several clients (thread-safe).
+     *
+     * Shared-ownership overload of SendBinary for the case where one payload must be
+     * sent through multiple WsClient instances. The application builds the buffer
+     * once and passes the same shared_ptr to each client, instead of materializing
+     * a private copy per client.
+     *
+     * @param pData Shared pointer to the binary payload (must not be null or empty)
+     * @return true if message was queued for sending, false if not connected or too large
+     *
+     * @note The underlying WebSocket library copies the bytes into its own send
+     *       queue, so one transient copy per connection remains at that boundary;
+     *       this overload eliminates the per-client application-side duplicates.
+     *
+     * @example
+     *   auto payload = std::make_shared<const std::vector<uint8_t>>(BuildPayload());
+     *   for (auto* client : clients)
+     *       client->SendBinary(payload);  // One buffer, many connections
+     *
+     * @see SendBinary(std::string&&)
+     */
+    bool SendBinary(std::shared_ptr<const std::vector<uint8_t>> pData);
+
+    /**
+     * @brief Send one framed (addressed) binary chunk (thread-safe).
+     *
+     * Prefixes the payload with the chunk framing header - stream id,
+     * sequence number, byte offset (Protocol::SerializeBinaryChunk) - so the
+     * receiver can commit it to the right position even when chunks arrive
+     * out of order. This is the building block for striping one transfer
+     * across several connections: each socket sends its share of the chunks
+     * and the peer's reorder window (or offset-capable sink) reassembles.
+     *
+     * The transfer must have been announced with a BinaryStart message whose
+     * msgId is pStreamId; the receiver rejects chunks for unknown streams.
+     *
+     * @param pStreamId msgId of the announcing BinaryStart message
+     * @param pSequence Chunk ordinal within the stream (0-based)
+     * @param pOffset Byte offset of this payload within the transfer
+     * @param pData Pointer to the payload bytes
+     * @param pSize Payload size in bytes
+     * @return true if the framed chunk was queued for sending
+     *
+     * @note The peer must have Config::enableChunkFraming set, or the frame
+     *       is credited as a raw chunk - header bytes and all.
+     *
+     * @see WsClientPool::SendBinaryStriped, Protocol::SerializeBinaryChunk
+     */
+    bool SendBinaryChunk(const std::string& pStreamId, uint32_t pSequence,
+                         uint64_t pOffset, const void* pData, size_t pSize);
+
+    /**
+     * @brief Progress callback for SendFile: (bytes sent so far, total bytes).
+     *
+     * Invoked on the calling thread after each chunk is queued.
+     */
+    using SendProgressCallback = std::function<void(size_t bytesSent, size_t totalBytes)>;
+
+    /**
+     * @struct LatencyStats
+     * @brief Percentile summary of one latency distribution (microseconds).
+     */
+    struct LatencyStats
+    {
+        uint64_t count = 0;  ///< Samples recorded
+        uint64_t minUs = 0;  ///< Fastest observed round trip
+        uint64_t p50Us = 0;  ///< Median
+        uint64_t p99Us = 0;  ///< 99th percentile
+        uint64_t maxUs = 0;  ///< Slowest observed round trip
+    };
+
+    /**
+     * @struct Stats
+     * @brief Point-in-time snapshot of this connection's counters and latencies.
+     *
+     * All counters are cumulative since construction; latency percentiles are
+     * computed from HDR-style histograms (logarithmic buckets, ~25% value
+     * resolution) so they stay accurate across the full range without
+     * unbounded memory.
+     */
+    struct Stats
+    {
+        uint64_t messagesSent = 0;      ///< Frames accepted by a Send* call
+        uint64_t bytesSent = 0;         ///< Payload bytes accepted by Send* calls
+        uint64_t messagesReceived = 0;  ///< Frames delivered to OnMessage
+        uint64_t bytesReceived = 0;     ///< Payload bytes delivered to OnMessage
+        uint64_t sendsRejected = 0;     ///< Sends refused (not connected / over watermark)
+        uint64_t protocolErrors = 0;    ///< Errors routed via RouteProtocolError
+        LatencyStats sendToAck;         ///< Tracked-send to Acknowledge round trips
+        LatencyStats pingToPong;        ///< SendPing to pong round trips
+    };
+
+    /**
+     * @brief Send a file as a binary transfer, memory-mapped and chunked (zero read copy).
+     *
+     * Streams a file to the server without reading it into an application
+     * buffer first: the file is memory-mapped and fed to the WebSocket in
+     * chunks directly from the mapping, so the OS pages data in lazily and
+     * peak memory stays at roughly one chunk regardless of file size. The
+     * Protocol::MessageType::BinaryStart metadata message (with the file size)
+     * is emitted automatically before the first chunk.
+     *
+     * @param pPath Path of the file to send
+     * @param pMsgId Unique message id for the BinaryStart announcement (and
+     *               therefore the receiver's stream id)
+     * @param pChunkSize Bytes per WebSocket frame (default 1MB); clamped to at
+     *                   least 4KB
+     * @param pProgress Optional callback invoked after each chunk is queued
+     * @return true if the whole file was queued for sending, false on open/map
+     *         failure, disconnection mid-transfer, or size exceeding
+     *         maxBinaryPayloadSize
+     *
+     * @note Blocks the calling thread until all chunks are queued; call from a
+     *       worker thread for very large files.
+     * @note Memory mapping uses the Win32 file-mapping API on Windows; other
+     *       platforms fall back to buffered chunk reads.
+     *
+     * @example
+     *   client.SendFile("backup.tar", "msg_042", 1024 * 1024,
+     *       [](size_t sent, size_t total) {
+     *           Logger::Instance().Info("App",
+     *               "Upload " + std::to_string(sent * 100 / total) + "%");
+     *       });
+     */
+    bool SendFile(const std::string& pPath, const std::string& pMsgId,
+                  size_t pChunkSize = 1024 * 1024,
+                  SendProgressCallback pProgress = nullptr);
+
+    /**
+     * @brief Send a WebSocket ping frame (thread-safe).
+     * 
+     * Sends a ping frame to the server for keep-alive or latency measurement.
+     * The server should respond with a pong frame. Thread-safe - can be called
+     * from any thread.
+     * 
+     * @param payload Optional ping payload data (max 125 bytes per RFC 6455)
+     * @return true if ping was queued for sending, false if not connected
+     * 
+     * @note Pong responses are handled automatically by IXWebSocket
+     * @note For automatic heartbeat, use pingIntervalSeconds in Config instead
+     * 
+     * @example
+     *   client.SendPing("heartbeat");  // Manual ping
+     * 
+     * @see Config::pingIntervalSeconds for automatic heartbeat
+     */
+    bool SendPing(const std::string& payload = "");
+
+    /**
+     * @brief Get the number of bytes queued for sending but not yet written to the socket.
+     *
+     * IXWebSocket queues outbound payloads internally; this reports how far
+     * the writer has fallen behind the producers. Used by WsClientPool's
+     * least-buffered balancing to steer traffic toward idle connections, and
+     * useful on its own to pace a fast producer against a slow link.
+     *
+     * @return Bytes currently buffered for transmission (0 when fully drained)
+     *
+     * @note Lock-free and safe to call from any thread.
+     */
+    size_t GetBufferedAmount() const;
+
+    /**
+     * @brief Block until the send queue drains to the given level.
+     *
+     * Backpressure primitive for fast producers on slow links: instead of a
+     * blind sleep, wait precisely until IXWebSocket has written the queued
+     * bytes down to pTargetBytes (default 0 = fully drained). Pair with
+     * Protocol::Config::sendHighWatermarkBytes - e.g. wait back down to the
+     * watermark after a rejected send.
+     *
+     * @param pTimeoutMs Maximum time to wait in milliseconds
+     * @param pTargetBytes Return once GetBufferedAmount() <= this value
+     * @return true if the queue drained to the target within the timeout;
+     *         false on timeout or if the connection dropped while waiting
+     *
+     * @note IXWebSocket exposes no drain notification, so this polls the
+     *       buffered amount at millisecond granularity rather than waiting on
+     *       a condition variable. The poll is a single atomic-read per tick.
+     *
+     * @example
+     *   if (!client.SendBinary(chunk.data(), chunk.size()))
+     *       client.WaitForDrain(5000, config.sendHighWatermarkBytes / 2);
+     */
+    bool WaitForDrain(int pTimeoutMs, size_t pTargetBytes = 0);
+
+    /**
+     * @brief Send a text message tracked by the acknowledgment window.
+     *
+     * Registers pMsgId as in-flight before sending, so the application can
+     * pipeline up to Protocol::Config::ackWindowSize messages without waiting
+     * for round trips - throughput becomes bandwidth-bound instead of
+     * RTT-bound. The entry is retired when a matching Acknowledge arrives
+     * (OnMessageAcked); if Protocol::Config::messageTimeoutMs expires first,
+     * the payload is retransmitted up to maxRetransmits times before
+     * OnMessageTimeout reports delivery failure.
+     *
+     * When the window is full, this blocks up to messageTimeoutMs for an
+     * entry to retire, then fails.
+     *
+     * @param pMsgId The msgId embedded in the message - the server's
+     *               Acknowledge must carry the same id
+     * @param pText The serialized message to send (and to retransmit verbatim)
+     * @return true if the message was tracked and queued for sending
+     *
+     * @note Requires Protocol::Config::ackWindowSize > 0; returns false otherwise.
+     * @note The ack is matched on the Acknowledge message's msg_id field.
+     *
+     * @example
+     *   Protocol::Message msg(Protocol::MessageType::Hello, "msg_42");
+     *   client.SendTextWithAck("msg_42", Protocol::SerializeJsonMessage(msg));
+     */
+    bool SendTextWithAck(const std::string& pMsgId, const std::string& pText);
+
+    /**
+     * @brief Get the number of sent messages still awaiting acknowledgment.
+     *
+     * @return In-flight entry count (0 when the ack window is disabled or idle)
+     */
+    size_t GetUnackedCount() const;
+
+    /**
+     * @brief Block until the ack window has room for another tracked send.
+     *
+     * @param pTimeoutMs Maximum time to wait in milliseconds
+     * @return true if the window has space; false on timeout or disabled window
+     */
+    bool WaitForAckWindow(int pTimeoutMs);
+
+    /**
+     * @brief Register a one-shot callback for the next settled connection state.
+     *
+     * If the state is currently Connecting, the callback fires (from the
+     * WebSocket thread) when it settles to Connected, Disconnected, or Error;
+     * otherwise it fires immediately on the caller's thread. This is the
+     * completion hook the coroutine ConnectAsync awaitable (WsClientCoro.hpp)
+     * resumes on - most applications want that wrapper, not this primitive.
+     *
+     * @param pCallback Invoked exactly once with the settled state
+     */
+    void OnNextStateSettled(std::function<void(ConnectionState)> pCallback);
+
+    /**
+     * @brief Send a tracked text message with a completion callback.
+     *
+     * Non-blocking variant of SendTextWithAck for asynchronous callers: the
+     * message enters the ack window and pCompletion fires exactly once -
+     * with true when the matching Acknowledge arrives, or false when the
+     * retransmit budget is exhausted or the window shuts down. A full window
+     * fails immediately instead of blocking. This is the completion hook the
+     * coroutine SendTextAwaitAck awaitable (WsClientCoro.hpp) resumes on.
+     *
+     * @param pMsgId The msgId embedded in the message
+     * @param pText The serialized message to send
+     * @param pCompletion Invoked exactly once with the delivery outcome
+     *                    (from the WebSocket or shared timer-wheel thread)
+     * @param pTimeoutMs Per-message timeout override (0 = Config::messageTimeoutMs)
+     * @return true if the message was tracked and queued (pCompletion will
+     *         fire); false if it was rejected (pCompletion never fires)
+     */
+    bool SendTextTracked(const std::string& pMsgId, const std::string& pText,
+                         std::function<void(bool)> pCompletion, int pTimeoutMs = 0);
+
+    /**
+     * @brief Take a snapshot of this connection's counters and latency percentiles.
+     *
+     * Counters are maintained with relaxed atomics on the hot paths (one
+     * fetch_add per event) and the histograms are fixed-size arrays of
+     * atomics, so both recording and snapshotting are cheap enough to poll
+     * every second in production.
+     *
+     * @return Stats snapshot; see the struct docs for field meanings
+     *
+     * @note Send-to-ack samples require the ack window engine
+     *       (Config::ackWindowSize > 0); ping-to-pong samples require
+     *       SendPing calls. Both are empty (count 0) otherwise.
+     */
+    Stats GetStats() const;
+
+    /**
+     * @brief Start capturing wire traffic to a binary log file.
+     *
+     * Every frame this client sends or receives (text and binary payloads;
+     * ping/pong control frames are not captured) is appended to a compact
+     * length-prefixed log with buffered writes - cheap enough to leave on
+     * against production traffic. The log can later be fed through the
+     * parser and router offline with TrafficReplayer, turning a real session
+     * into a repeatable profiling workload.
+     *
+     * @param pPath Log file path (overwritten if it exists)
+     * @return true if recording started
+     *
+     * @note Recording survives reconnects; it stops on StopRecording or
+     *       when the client is destroyed.
+     *
+     * @see TrafficRecorder, TrafficReplayer, StopRecording
+     */
+    bool StartRecording(const std::string& pPath);
+
+    /**
+     * @brief Flush and close the traffic capture log.
+     *
+     * Safe to call when no recording is active.
+     *
+     * @see StartRecording
+     */
+    void StopRecording();
+
+    /**
+     * @brief Enable per-message deflate compression at runtime.
+     * 
+     * Enables compression for subsequent messages. Both client and server must
+     * support compression (RFC 7692) for this to have any effect.
+     * 
+     * @note Call before Connect() for best results; some servers negotiate
+     *       compression only during the initial handshake.
+     * @note Compression adds CPU overhead but reduces bandwidth usage.
+     * 
+     * @see DisableCompression
+     */
+    void EnableCompression();
+
+    /**
+     * @brief Disable per-message deflate compression at runtime.
+     * 
+     * Disables compression for subsequent messages. Useful when sending
+     * already-compressed data (images, video) or on low-power devices.
+     * 
+     * @see EnableCompression
+     */
+    void DisableCompression();
+
+    /**
+     * @brief Get the current connection state.
+     * 
+     * Returns the current state of the connection. This is an atomic read and can
+     * be safely called from any thread.
+     * 
+     * @return Current ConnectionState enum value
+     * 
+     * @note This is informational only; checking state before Send* may not be
+     *       reliable due to race conditions. Send* methods will safely fail if
+     *       not connected.
+     * 
+     * @example
+     *   if (client.GetState() == WsClient::ConnectionState::Connected) {
+     *       // We might be connected, but still check SendText return value
+     *   }
+     */
+    ConnectionState GetState() const;
+
+    /**
+     * @brief Get the current connection state as a human-readable string.
+     * 
+     * Useful for debugging and logging purposes.
+     * 
+     * @return String representation of current state (e.g., "Connected", "Disconnected")
+     */
+    std::string GetStateString() const;
+
+    /**
+     * @brief Set the handler for receiving parsed protocol messages.
+     * 
+     * Registers an IMessageHandler implementation that will receive callbacks
+     * when protocol messages arrive. The handler is called from the WebSocket
+     * thread, not your main thread.
+     * 
+     * @param handler Pointer to IMessageHandler implementation, or nullptr to disable routing
+     * 
+     * @note Should be called before connecting to avoid missing initial messages
+     * @note The handler must outlive the client (or call again with nullptr before handler is destroyed)
+     * @note All handler callbacks come from the WebSocket thread
+     * 
+     * @example
+     *   class MyHandler : public IMessageHandler {
+     *       // ... implement pure virtual methods
+     *   };
+     *   MyHandler handler;
+     *   client.SetMessageHandler(&handler);
+     *   client.Connect("ws://...");
+     * 
+     * @see IMessageHandler
+     */
+    void SetMessageHandler(IMessageHandler* handler);
+
+    /**
+     * @brief Register a streaming sink for binary transfers (bounded memory).
+     *
+     * With a sink registered, received binary chunks are streamed directly into
+     * it from the receive path instead of being delivered through
+     * IMessageHandler::OnBinaryChunk - the sink's destination (preallocated
+     * file, memory mapping) is reserved from the BinaryStart size metadata up
+     * front, so arbitrarily large transfers complete with a small constant
+     * memory footprint.
+     *
+     * Text messages, including the BinaryStart metadata itself, are still
+     * routed to the message handler as before. If the sink rejects a transfer
+     * (OnStart returns false), that transfer's chunks fall back to the
+     * message-handler path.
+     *
+     * @param sink Pointer to BinarySink implementation, or nullptr to restore
+     *             handler-based chunk delivery
+     *
+     * @note Should be set before connecting, like SetMessageHandler
+     * @note The sink must outlive the client (or be cleared with nullptr first)
+     * @note All sink callbacks come from the WebSocket thread
+     *
+     * @example
+     *   FileBinarySink sink("download.bin");
+     *   client.SetBinarySink(&sink);
+     *   client.Connect("ws://...");   // Transfers stream to disk
+     *
+     * @see BinarySink, FileBinarySink, MemoryMappedBinarySink
+     */
+    void SetBinarySink(BinarySink* sink);
+
+    /**
+     * @brief Close the connection gracefully.
+     * 
+     * Gracefully closes the WebSocket connection and waits briefly for the
+     * background thread to exit. The client can be reused afterwards: a new
+     * Connect() on the same instance skips object teardown and network-system
+     * re-initialization, which is what the built-in reconnection engine
+     * (Protocol::Config::enableAutoReconnect) relies on for fast recovery.
+     * A user-initiated Close() always stops automatic reconnection.
+     * 
+     * @note Blocks briefly (up to 100ms) for thread cleanup
+     * @note Safe to call multiple times (subsequent calls do nothing)
+     * @note Called automatically by destructor
+     * 
+     * @example
+     *   client.Connect("ws://server");
+     *   // ... use client ...
+     *   client.Close();  // Graceful shutdown
+     */
+    void Close();
+
+    /**
+     * @class CloseHandle
+     * @brief Completion handle for an asynchronous close (see CloseAsync).
+     *
+     * Lets a caller initiate many closes and then wait for all of them,
+     * overlapping the per-connection teardown instead of serializing it.
+     * The handle does not own the client - the client must stay alive until
+     * the handle is waited on or discarded.
+     */
+    class CloseHandle
+    {
+    public:
+        /**
+         * @brief Block until this client's shutdown completes or the deadline passes.
+         *
+         * @param pTimeoutMs Deadline in milliseconds; <= 0 uses the client's
+         *                   Config::shutdownTimeoutMs
+         * @return true if shutdown completed within the deadline
+         *
+         * @note The client lands in Disconnected either way, so it can be
+         *       reused or destroyed after this returns.
+         */
+        bool Wait(int pTimeoutMs = -1);
+
+        /**
+         * @brief Whether the close has already completed (non-blocking).
+         *
+         * @return true if the client is back in the Disconnected state
+         */
+        bool IsComplete() const;
+
+    private:
+        friend class WsClient;
+
+        /// @brief Only WsClient::CloseAsync constructs handles
+        explicit CloseHandle(WsClient* pClient) : mClient(pClient) {}
+
+        WsClient* mClient = nullptr;  ///< The closing client (not owned)
+    };
+
+    /**
+     * @brief Initiate a graceful close without blocking on completion.
+     *
+     * Performs everything Close() does up to the shutdown wait - stops the
+     * worker threads, transitions to Closing, and asks the library socket to
+     * stop - then returns immediately with a handle. Call Wait on the handle
+     * (or just destroy the client, whose destructor closes synchronously) to
+     * finish. Closing many clients this way overlaps their teardown, so a
+     * fleet drains in roughly the time of the slowest connection.
+     *
+     * @return Completion handle; Wait() on it to block until shutdown
+     *
+     * @example
+     *   auto handle = client.CloseAsync();
+     *   // ... initiate other closes, flush logs, etc. ...
+     *   handle.Wait();  // Bounded by Config::shutdownTimeoutMs
+     *
+     * @see Close, CloseAll
+     */
+    CloseHandle CloseAsync();
+
+    /**
+     * @brief Close a fleet of clients in parallel.
+     *
+     * Initiates every close first, then waits for each in turn - all library
+     * sockets tear down concurrently, bringing total drain time down from the
+     * sum of the per-client waits to roughly the slowest single connection.
+     *
+     * @param pClients Clients to close (null entries are skipped)
+     * @param pDeadlineMs Overall fleet deadline in milliseconds; <= 0 lets
+     *                    each client use its own Config::shutdownTimeoutMs
+     * @return Number of clients whose shutdown completed within the deadline
+     *
+     * @example
+     *   std::vector<WsClient*> fleet = ...;
+     *   const size_t closed = WsClient::CloseAll(fleet, 3000);
+     *   Logger::Instance().Info("App", std::to_string(closed) + " closed cleanly");
+     */
+    static size_t CloseAll(std::span<WsClient* const> pClients,
+                           int pDeadlineMs = -1);
+
+private:
+    /**
+     * @class Impl
+     * @brief Private implementation class (Pimpl pattern).
+     * 
+     * Contains all internal state for the WebSocket client. Hidden here to avoid
+     * exposing IXWebSocket headers in the public interface.
+     */
+    class Impl;
+    
+    /// @brief Unique pointer to implementation (RAII - automatic cleanup)
+    std::unique_ptr<Impl> mImpl;
+
+    // Private callback handlers (invoked from IXWebSocket internal thread)
+    
+    /// @brief Callback when connection is established
+    void OnOpen();
+    
+    /// @brief Callback when message is received
+    /// @note Takes the frame buffer by rvalue reference so binary chunks can be
+    ///       handed to the application without a copy (see IMessageHandler::OnBinaryChunkOwned)
+    void OnMessage(std::string&& pMsg, bool pIsBinary);
+    
+    /// @brief Callback when connection is closed by server
+    void OnClose();
+    
+    /// @brief Callback when connection error occurs
+    void OnError(const std::string& pReason);
+
+    /// @brief Non-blocking half of Close: stop workers, enter Closing, ask the
+    ///        library socket to stop. Returns false if already disconnected.
+    bool InitiateClose();
+
+    /// @brief Blocking half of Close: wait for shutdownComplete up to the
+    ///        deadline (<= 0 = Config::shutdownTimeoutMs), then land in
+    ///        Disconnected. Returns true if shutdown confirmed in time.
+    bool AwaitClose(int pDeadlineMs);
+
+    /// @brief Process a parsed control message (ack retirement, binary-mode
+    ///        negotiation, BinaryStart stream bookkeeping, handler routing).
+    ///        Shared by the JSON text path and the binary-encoded frame path.
+    void HandleControlMessage(const Protocol::MessageView& pMsg);
+
+    /// @brief Commit one framed (addressed) binary chunk: in-order chunks are
+    ///        delivered immediately, out-of-order ones wait in the stream's
+    ///        bounded reorder window (or land directly via an offset-capable
+    ///        sink). Only reached while Config::enableChunkFraming is set.
+    void HandleFramedChunk(const std::string& pMsg);
+
+    /// @brief Allow Impl to call private callback methods
+    friend class Impl;
+};
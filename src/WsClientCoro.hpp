@@ -0,0 +1,329 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#pragma once
+
+#include <coroutine>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "Protocol.hpp"
+#include "WsClient.hpp"
+#include "MessageHandler.hpp"
+
+/**
+ * @file WsClientCoro.hpp
+ * @brief C++20 coroutine surface over WsClient (header-only).
+ *
+ * WaitForConnection blocks a whole thread on a condition variable, so a
+ * service orchestrating hundreds of clients burns a thread per pending
+ * connection. The awaitables here suspend a coroutine frame instead:
+ * thousands of idle or connecting clients cost heap frames, not OS threads.
+ *
+ * Built entirely on WsClient's public completion hooks (OnNextStateSettled,
+ * SendTextTracked), so nothing here touches client internals:
+ *
+ * @example
+ *   WsCoro::FireAndForget Session(WsClient& client)
+ *   {
+ *       auto state = co_await WsCoro::ConnectAsync(client, "ws://server:8080");
+ *       if (state != WsClient::ConnectionState::Connected)
+ *           co_return;
+ *
+ *       bool acked = co_await WsCoro::SendTextAwaitAck(client, "msg_1", frame);
+ *
+ *       WsCoro::MessageStream stream;   // set as the client's handler
+ *       client.SetMessageHandler(&stream);
+ *       Protocol::Message msg = co_await stream.Next();
+ *   }
+ *
+ * @warning Coroutines resume on whichever thread completes the operation
+ *          (the WebSocket thread or the ack monitor) - treat the code after
+ *          a co_await like an IMessageHandler callback: keep it short and
+ *          post heavy work elsewhere.
+ */
+namespace WsCoro
+{
+    /**
+     * @struct FireAndForget
+     * @brief Minimal detached coroutine return type.
+     *
+     * For top-level coroutines that run for their side effects - there is no
+     * result to await and the frame destroys itself on completion. Exceptions
+     * escaping the coroutine terminate, matching what an escaped exception in
+     * a handler callback would do.
+     */
+    struct FireAndForget
+    {
+        struct promise_type
+        {
+            FireAndForget get_return_object() { return {}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_never final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception() { std::terminate(); }
+        };
+    };
+
+    /**
+     * @class ConnectAwaitable
+     * @brief Awaitable wrapping WsClient::Connect + the settled-state hook.
+     *
+     * Starts the connection on await_ready and suspends until the state
+     * settles; co_await yields the settled ConnectionState.
+     *
+     * @see ConnectAsync for the factory most callers use
+     */
+    class ConnectAwaitable
+    {
+    public:
+        ConnectAwaitable(WsClient& pClient, std::string pUrl)
+            : mClient(pClient)
+            , mUrl(std::move(pUrl))
+        {
+        }
+
+        /// @brief Initiate the connection; a failed initiation skips suspension
+        bool await_ready()
+        {
+            mStarted = mClient.Connect(mUrl);
+            return !mStarted;
+        }
+
+        /// @brief Park the coroutine on the next settled state transition
+        void await_suspend(std::coroutine_handle<> pHandle)
+        {
+            mClient.OnNextStateSettled(
+                [this, pHandle](WsClient::ConnectionState settled)
+                {
+                    mResult = settled;
+                    pHandle.resume();
+                });
+        }
+
+        /// @brief The settled connection state (current state if Connect failed)
+        WsClient::ConnectionState await_resume()
+        {
+            return mStarted ? mResult : mClient.GetState();
+        }
+
+    private:
+        WsClient& mClient;
+        std::string mUrl;
+        bool mStarted = false;
+        WsClient::ConnectionState mResult = WsClient::ConnectionState::Error;
+    };
+
+    /**
+     * @brief Awaitable connect: co_await yields the settled ConnectionState.
+     *
+     * @param pClient The client to connect (must outlive the await)
+     * @param pUrl WebSocket URL to connect to
+     * @return Awaitable yielding Connected on success, Error/Disconnected otherwise
+     *
+     * @note The client must already be Open()ed, exactly as with Connect().
+     */
+    inline ConnectAwaitable ConnectAsync(WsClient& pClient, const std::string& pUrl)
+    {
+        return ConnectAwaitable(pClient, pUrl);
+    }
+
+    /**
+     * @class SendAckAwaitable
+     * @brief Awaitable wrapping WsClient::SendTextTracked.
+     *
+     * Suspends until the message is acknowledged, times out past its
+     * retransmit budget, or the window shuts down; co_await yields the
+     * delivery outcome as bool.
+     *
+     * @see SendTextAwaitAck for the factory most callers use
+     */
+    class SendAckAwaitable
+    {
+    public:
+        SendAckAwaitable(WsClient& pClient, std::string pMsgId,
+                         std::string pText, int pTimeoutMs)
+            : mClient(pClient)
+            , mMsgId(std::move(pMsgId))
+            , mText(std::move(pText))
+            , mTimeoutMs(pTimeoutMs)
+        {
+        }
+
+        bool await_ready() { return false; }
+
+        /// @brief Register the completion and send; a rejected send skips suspension
+        bool await_suspend(std::coroutine_handle<> pHandle)
+        {
+            mQueued = mClient.SendTextTracked(
+                mMsgId, mText,
+                [this, pHandle](bool acked)
+                {
+                    mResult = acked;
+                    pHandle.resume();
+                },
+                mTimeoutMs);
+
+            // false = resume immediately with a failed outcome
+            return mQueued;
+        }
+
+        /// @brief true if the message was acknowledged within its budget
+        bool await_resume() { return mQueued && mResult; }
+
+    private:
+        WsClient& mClient;
+        std::string mMsgId;
+        std::string mText;
+        int mTimeoutMs;
+        bool mQueued = false;
+        bool mResult = false;
+    };
+
+    /**
+     * @brief Awaitable tracked send: co_await yields the delivery outcome.
+     *
+     * Built on the ack window engine - requires Protocol::Config::ackWindowSize
+     * to be configured, like SendTextWithAck.
+     *
+     * @param pClient The client to send through (must outlive the await)
+     * @param pMsgId The msgId embedded in the message
+     * @param pText The serialized message to send
+     * @param pTimeoutMs Per-message timeout override (0 = Config::messageTimeoutMs)
+     * @return Awaitable yielding true when acknowledged, false on failure
+     */
+    inline SendAckAwaitable SendTextAwaitAck(WsClient& pClient,
+                                             const std::string& pMsgId,
+                                             const std::string& pText,
+                                             int pTimeoutMs = 0)
+    {
+        return SendAckAwaitable(pClient, pMsgId, pText, pTimeoutMs);
+    }
+
+    /**
+     * @class MessageStream
+     * @brief IMessageHandler that turns the callback stream into an awaitable queue.
+     *
+     * Set an instance as the client's message handler and pull protocol
+     * messages with co_await stream.Next() instead of implementing callback
+     * methods. Text messages, BinaryStart announcements, and protocol errors
+     * (as Error-typed messages) are queued; raw binary chunks are not - use a
+     * BinarySink or a conventional handler for bulk binary delivery.
+     *
+     * @note One consumer coroutine at a time: a second co_await Next() while
+     *       one is already suspended replaces the first waiter.
+     * @warning The consumer resumes on the WebSocket thread (or the executor
+     *          worker, if the router runs in executor mode).
+     */
+    class MessageStream : public IMessageHandler
+    {
+    public:
+        /**
+         * @class NextAwaitable
+         * @brief Awaitable yielding the next queued Protocol::Message.
+         */
+        class NextAwaitable
+        {
+        public:
+            explicit NextAwaitable(MessageStream& pStream)
+                : mStream(pStream)
+            {
+            }
+
+            /// @brief Skip suspension when a message is already queued
+            bool await_ready()
+            {
+                std::lock_guard<std::mutex> lock(mStream.mMutex);
+                return !mStream.mQueue.empty();
+            }
+
+            /// @brief Park the coroutine until a message arrives
+            bool await_suspend(std::coroutine_handle<> pHandle)
+            {
+                std::lock_guard<std::mutex> lock(mStream.mMutex);
+
+                // A message slipped in between await_ready and here
+                if (!mStream.mQueue.empty())
+                    return false;
+
+                mStream.mWaiter = pHandle;
+                return true;
+            }
+
+            /// @brief Pop and return the front message
+            Protocol::Message await_resume()
+            {
+                std::lock_guard<std::mutex> lock(mStream.mMutex);
+                Protocol::Message msg = std::move(mStream.mQueue.front());
+                mStream.mQueue.pop_front();
+                return msg;
+            }
+
+        private:
+            MessageStream& mStream;
+        };
+
+        /// @brief Awaitable for the next protocol message
+        NextAwaitable Next() { return NextAwaitable(*this); }
+
+        /// @brief Number of messages queued and not yet consumed
+        size_t Pending() const
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            return mQueue.size();
+        }
+
+        //
+        // IMessageHandler - producers (WebSocket thread)
+        //
+
+        void OnTextMessage(const Protocol::Message& msg) override { Push(msg); }
+
+        void OnBinaryStart(const Protocol::Message& msg) override { Push(msg); }
+
+        void OnBinaryChunk(const uint8_t* data, size_t size) override
+        {
+            // Bulk binary is not queued - see class notes
+            (void)data;
+            (void)size;
+        }
+
+        void OnBinaryComplete() override {}
+
+        void OnProtocolError(const std::string& reason) override
+        {
+            // Surface errors in-band as Error-typed messages
+            Protocol::Message msg;
+            msg.type = Protocol::MessageType::Error;
+            msg.content = reason;
+            Push(msg);
+        }
+
+    private:
+        /// @brief Queue a message and resume the waiting consumer, if any
+        void Push(const Protocol::Message& msg)
+        {
+            std::coroutine_handle<> waiter;
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mQueue.push_back(msg);
+
+                waiter = mWaiter;
+                mWaiter = nullptr;
+            }
+
+            // Resume outside the lock - the consumer will re-take it in await_resume
+            if (waiter)
+                waiter.resume();
+        }
+
+        /// @brief Queued messages awaiting consumption (protected by mMutex)
+        std::deque<Protocol::Message> mQueue;
+
+        /// @brief The suspended consumer coroutine, if one is waiting
+        std::coroutine_handle<> mWaiter = nullptr;
+
+        /// @brief Protects the queue and the waiter handle
+        mutable std::mutex mMutex;
+    };
+}
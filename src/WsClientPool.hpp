@@ -0,0 +1,242 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include <atomic>
+
+#include "Protocol.hpp"
+#include "WsClient.hpp"
+
+// Forward declaration - applications provide an IMessageHandler (MessageHandler.hpp)
+class IMessageHandler;
+
+/**
+ * @class WsClientPool
+ * @brief N parallel connections to one endpoint with load-balanced sends.
+ *
+ * One WsClient wraps one ix::WebSocket and therefore one socket thread, which
+ * caps a single logical endpoint at roughly one core of receive-side
+ * throughput. WsClientPool opens N connections to the same URL and spreads
+ * traffic across them, so throughput scales with connection count across
+ * cores while the application keeps talking to one object.
+ *
+ * Sends are balanced over the connected members using either:
+ * - RoundRobin: rotate through connections (cheap, even spread)
+ * - LeastBuffered: pick the connection with the fewest queued bytes
+ *   (adapts to uneven drain rates, e.g. one member on a congested path)
+ *
+ * All members share one IMessageHandler, so the application sees a single
+ * aggregated message stream.
+ *
+ * Thread Safety:
+ * - Send* methods are safe to call concurrently from multiple threads
+ * - Open/Connect/Close follow the same single-caller rules as WsClient
+ *
+ * @warning The shared handler is invoked from N socket threads concurrently -
+ *          it must be thread-safe, or each member's router can be switched to
+ *          executor mode to serialize dispatch per connection.
+ *
+ * @note Server-side message ordering is only guaranteed per connection;
+ *       messages balanced over different members may be processed out of
+ *       order relative to each other. Keep causally-ordered traffic on one
+ *       WsClient if that matters.
+ *
+ * @example
+ *   WsClientPool pool(4);                   // 4 connections, 4 socket threads
+ *   pool.SetMessageHandler(&myHandler);
+ *   pool.Open();
+ *   pool.Connect("ws://server:8080");
+ *   pool.WaitForConnection(10000);          // All members connected
+ *   pool.SendText(Protocol::SerializeJsonMessage(msg));  // Balanced send
+ */
+class WsClientPool
+{
+public:
+    /**
+     * @enum Balancing
+     * @brief Strategy for picking the member connection of the next send.
+     */
+    enum class Balancing
+    {
+        RoundRobin,    ///< Rotate through connected members (default)
+        LeastBuffered  ///< Pick the member with the fewest queued send bytes
+    };
+
+    /**
+     * @brief Construct a pool of the given size.
+     *
+     * Members are created up front but not opened or connected.
+     *
+     * @param pConnectionCount Number of parallel connections (clamped to >= 1)
+     * @param pConfig Protocol configuration applied to every member
+     */
+    explicit WsClientPool(size_t pConnectionCount,
+                          const Protocol::Config& pConfig = Protocol::Config());
+
+    /// @brief Destructor - closes all member connections
+    ~WsClientPool();
+
+    // Non-copyable, non-movable (members hold threads and callbacks into this)
+    WsClientPool(const WsClientPool&) = delete;
+    WsClientPool& operator=(const WsClientPool&) = delete;
+
+    /**
+     * @brief Initialize all member clients (network system, callbacks).
+     *
+     * @return true if every member opened successfully
+     *
+     * @see WsClient::Open
+     */
+    bool Open();
+
+    /**
+     * @brief Start connecting every member to the same URL (non-blocking).
+     *
+     * @param pUrl WebSocket URL shared by all members
+     * @return true if every member initiated its connection
+     *
+     * @see WsClient::Connect
+     */
+    bool Connect(const std::string& pUrl);
+
+    /**
+     * @brief Block until members are connected, mirroring WsClient::WaitForConnection.
+     *
+     * @param pTimeoutMs Maximum total time to wait in milliseconds
+     * @param pMinConnections How many members must be connected before
+     *                        returning success (0 = all of them, the default)
+     * @return true if the required number of members connected within the timeout
+     *
+     * @note With pMinConnections < pool size, the pool is usable as soon as
+     *       this returns - stragglers keep connecting in the background and
+     *       join the balancing rotation when they arrive.
+     */
+    bool WaitForConnection(int pTimeoutMs = 10000, size_t pMinConnections = 0);
+
+    /**
+     * @brief Set the shared message handler receiving the aggregated stream.
+     *
+     * The same handler is attached to every member, so all N connections
+     * deliver into one logical stream.
+     *
+     * @param pHandler Handler for the aggregated stream (must be thread-safe)
+     *
+     * @warning Called concurrently from N socket threads - see class notes.
+     */
+    void SetMessageHandler(IMessageHandler* pHandler);
+
+    /**
+     * @brief Select the balancing strategy for subsequent sends.
+     *
+     * @param pBalancing RoundRobin (default) or LeastBuffered
+     */
+    void SetBalancing(Balancing pBalancing);
+
+    /**
+     * @brief Send a text message over the best member per the balancing strategy.
+     *
+     * @param pText The text message to send
+     * @return true if a connected member accepted the message
+     */
+    bool SendText(const std::string& pText);
+
+    /**
+     * @brief Send binary data over the best member per the balancing strategy.
+     *
+     * @param pData Pointer to the binary data
+     * @param pSize Size of the data in bytes
+     * @return true if a connected member accepted the data
+     */
+    bool SendBinary(const void* pData, size_t pSize);
+
+    /**
+     * @brief Stripe one binary transfer across every connected member.
+     *
+     * Announces the transfer with a BinaryStart message (carrying the total
+     * size and a CRC-32C of the payload), then chops the payload into framed
+     * chunks - each prefixed with the stream id, sequence number, and byte
+     * offset - and spreads them over the connected members per the active
+     * balancing strategy. With N healthy connections the transfer drains at
+     * roughly N sockets' aggregate bandwidth instead of being capped by one,
+     * and one slow member only delays its own share.
+     *
+     * The receiving peer reassembles from the chunk offsets (it must support
+     * the chunk framing - Config::enableChunkFraming on a WsClient, with
+     * reordering absorbed by its reorder window or offset-capable sink).
+     *
+     * @param pStreamId Stream identifier, used as the BinaryStart msgId
+     * @param pData Pointer to the full payload
+     * @param pSize Payload size in bytes
+     * @param pChunkSizeBytes Stripe granularity (default 256KB; smaller
+     *                        chunks spread more evenly, more per-frame overhead)
+     * @return true if the announcement and every chunk were queued
+     *
+     * @note Ordering across members is not preserved on the wire - that is
+     *       the point; the framing makes it safe.
+     *
+     * @see WsClient::SendBinaryChunk, Protocol::SerializeBinaryChunk
+     */
+    bool SendBinaryStriped(const std::string& pStreamId, const void* pData,
+                           size_t pSize, size_t pChunkSizeBytes = 256 * 1024);
+
+    /**
+     * @brief Get the number of members currently in the Connected state.
+     *
+     * @return Count of connected members (0..GetSize())
+     */
+    size_t GetConnectedCount() const;
+
+    /**
+     * @brief Get the total number of member connections in the pool.
+     *
+     * @return Pool size as passed to the constructor
+     */
+    size_t GetSize() const;
+
+    /**
+     * @brief Get the sum of queued send bytes across all members.
+     *
+     * @return Aggregate buffered amount in bytes
+     *
+     * @see WsClient::GetBufferedAmount
+     */
+    size_t GetBufferedAmount() const;
+
+    /**
+     * @brief Access an individual member, e.g. to pin ordered traffic to one connection.
+     *
+     * @param pIndex Member index (0..GetSize()-1)
+     * @return Reference to the member client
+     *
+     * @warning No bounds checking beyond assert-level expectations; callers
+     *          must pass a valid index.
+     */
+    WsClient& GetClient(size_t pIndex);
+
+    /**
+     * @brief Close every member connection gracefully.
+     *
+     * @see WsClient::Close
+     */
+    void Close();
+
+private:
+    /**
+     * @brief Pick the member for the next send per the active strategy.
+     *
+     * @return Pointer to a connected member, or nullptr if none is connected
+     */
+    WsClient* PickClient();
+
+    /// @brief Member connections (created in the constructor, fixed size)
+    std::vector<std::unique_ptr<WsClient>> mClients;
+
+    /// @brief Round-robin cursor (wraps via modulo, incremented lock-free)
+    std::atomic<size_t> mNextIndex{0};
+
+    /// @brief Active balancing strategy
+    std::atomic<Balancing> mBalancing{Balancing::RoundRobin};
+};
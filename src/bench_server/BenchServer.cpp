@@ -0,0 +1,339 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#include "BenchServer.hpp"
+#include "../Logger.hpp"
+
+#include <ixwebsocket/IXNetSystem.h>
+#include <ixwebsocket/IXWebSocket.h>
+#include <ixwebsocket/IXWebSocketServer.h>
+
+#include <chrono>
+#include <thread>
+#include <algorithm>
+
+/**
+ * @file BenchServer.cpp
+ * @brief Implementation of the native benchmark server.
+ *
+ * Design notes:
+ * - All per-frame work happens on IXWebSocket's per-connection threads; the
+ *   controlling thread only starts, waits, and stops. There is no shared
+ *   dispatch loop to become the bottleneck the Python mock was.
+ * - The hot paths (echo, ack) avoid allocations beyond the reply itself:
+ *   frames are parsed with ParseJsonMessageView (zero-allocation) and the
+ *   counters are relaxed atomics.
+ */
+
+BenchServer::BenchServer(const Options& pOptions)
+    : mOptions(pOptions)
+{
+}
+
+BenchServer::~BenchServer()
+{
+    Stop();
+}
+
+bool BenchServer::Start()
+{
+    // Initialize platform networking (WSAStartup on Windows, no-op elsewhere)
+    ix::initNetSystem();
+
+    mServer = std::make_unique<ix::WebSocketServer>(mOptions.port, mOptions.host);
+
+    if (mOptions.enableCompression)
+        mServer->enablePerMessageDeflate();
+
+    mServer->setOnClientMessageCallback(
+        [this](std::shared_ptr<ix::ConnectionState> connectionState,
+               ix::WebSocket& webSocket,
+               const ix::WebSocketMessagePtr& msg)
+        {
+            const std::string connectionId = connectionState->getId();
+
+            switch (msg->type)
+            {
+            case ix::WebSocketMessageType::Open:
+                mConnectionsTotal.fetch_add(1, std::memory_order_relaxed);
+                mConnectionsActive.fetch_add(1, std::memory_order_relaxed);
+                {
+                    std::lock_guard<std::mutex> lock(mContextMutex);
+                    mContexts[connectionId] = ConnectionContext();
+                }
+                Logger::Instance().Info("BenchServer",
+                    "Client connected: " + connectionId + " (active: " +
+                    std::to_string(mConnectionsActive.load(std::memory_order_relaxed)) + ")");
+                break;
+
+            case ix::WebSocketMessageType::Close:
+                mConnectionsActive.fetch_sub(1, std::memory_order_relaxed);
+                {
+                    std::lock_guard<std::mutex> lock(mContextMutex);
+                    mContexts.erase(connectionId);
+                }
+                Logger::Instance().Info("BenchServer",
+                    "Client disconnected: " + connectionId +
+                    " (code=" + std::to_string(msg->closeInfo.code) + ")");
+                break;
+
+            case ix::WebSocketMessageType::Message:
+                mMessagesReceived.fetch_add(1, std::memory_order_relaxed);
+                mBytesReceived.fetch_add(msg->str.size(), std::memory_order_relaxed);
+
+                if (msg->binary)
+                    HandleBinaryFrame(connectionId, webSocket, msg->str);
+                else
+                    HandleTextFrame(connectionId, webSocket, msg->str);
+                break;
+
+            case ix::WebSocketMessageType::Error:
+                Logger::Instance().Warning("BenchServer",
+                    "Connection error on " + connectionId + ": " + msg->errorInfo.reason);
+                break;
+
+            default:
+                // Ping/Pong/Fragment - the library answers pings itself
+                break;
+            }
+        });
+
+    const auto result = mServer->listen();
+    if (!result.first)
+    {
+        Logger::Instance().Error("BenchServer",
+            "Failed to listen on " + mOptions.host + ":" +
+            std::to_string(mOptions.port) + " - " + result.second);
+        return false;
+    }
+
+    mServer->start();
+    mRunning.store(true, std::memory_order_release);
+
+    Logger::Instance().Info("BenchServer",
+        std::string("Listening on ws://") + mOptions.host + ":" +
+        std::to_string(mOptions.port) + " (mode: " + ModeToString(mOptions.mode) + ")");
+
+    return true;
+}
+
+void BenchServer::Wait()
+{
+    // Coarse poll against the running flag - Stop() may be called from a
+    // signal-triggered path, where waking a CV is not reliably safe
+    while (mRunning.load(std::memory_order_acquire))
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+}
+
+void BenchServer::Stop()
+{
+    if (!mRunning.exchange(false, std::memory_order_acq_rel))
+        return;
+
+    Logger::Instance().Info("BenchServer", "Stopping...");
+
+    if (mServer)
+        mServer->stop();
+
+    const Stats stats = GetStats();
+    Logger::Instance().Info("BenchServer",
+        "Final: connections=" + std::to_string(stats.connectionsTotal) +
+        " received=" + std::to_string(stats.messagesReceived) + " msgs/" +
+        std::to_string(stats.bytesReceived) + " bytes, sent=" +
+        std::to_string(stats.messagesSent) + " msgs/" +
+        std::to_string(stats.bytesSent) + " bytes");
+}
+
+BenchServer::Stats BenchServer::GetStats() const
+{
+    Stats stats;
+    stats.connectionsTotal = mConnectionsTotal.load(std::memory_order_relaxed);
+    stats.connectionsActive = mConnectionsActive.load(std::memory_order_relaxed);
+    stats.messagesReceived = mMessagesReceived.load(std::memory_order_relaxed);
+    stats.bytesReceived = mBytesReceived.load(std::memory_order_relaxed);
+    stats.messagesSent = mMessagesSent.load(std::memory_order_relaxed);
+    stats.bytesSent = mBytesSent.load(std::memory_order_relaxed);
+    return stats;
+}
+
+const char* BenchServer::ModeToString(Mode pMode)
+{
+    switch (pMode)
+    {
+    case Mode::Echo:        return "echo";
+    case Mode::Ack:         return "ack";
+    case Mode::BinaryFlood: return "flood";
+    }
+    return "unknown";
+}
+
+bool BenchServer::ParseMode(const std::string& pText, Mode& pMode)
+{
+    if (pText == "echo")
+    {
+        pMode = Mode::Echo;
+        return true;
+    }
+    if (pText == "ack")
+    {
+        pMode = Mode::Ack;
+        return true;
+    }
+    if (pText == "flood")
+    {
+        pMode = Mode::BinaryFlood;
+        return true;
+    }
+    return false;
+}
+
+void BenchServer::HandleTextFrame(const std::string& pConnectionId,
+                                  ix::WebSocket& pWebSocket,
+                                  const std::string& pText)
+{
+    if (mOptions.mode == Mode::Echo)
+    {
+        // Round-trip baseline: no parsing on the hot path at all
+        SendCounted(pWebSocket, pText);
+        return;
+    }
+
+    // Ack and BinaryFlood modes need to know what arrived - parse without
+    // allocating, exactly like the client's receive path does
+    const Protocol::MessageView view = Protocol::ParseJsonMessageView(pText);
+
+    if (view.type == Protocol::MessageType::Unknown || view.msgId.empty())
+    {
+        Logger::Instance().Debug("BenchServer", [&pConnectionId, &pText] {
+            return "[" + pConnectionId + "] Non-protocol text (" +
+                   std::to_string(pText.size()) + " bytes), ignored"; });
+        return;
+    }
+
+    if (mOptions.mode == Mode::BinaryFlood)
+    {
+        // A Hello is the flood trigger; everything else is counted and dropped
+        if (view.type == Protocol::MessageType::Hello)
+            RunBinaryFlood(pWebSocket, std::string(view.msgId));
+        return;
+    }
+
+    // Ack mode
+    switch (view.type)
+    {
+    case Protocol::MessageType::BinaryStart:
+        // Remember the announcement; the Acknowledge is sent when the full
+        // payload has arrived, mirroring a real receiving peer
+        {
+            std::lock_guard<std::mutex> lock(mContextMutex);
+            auto it = mContexts.find(pConnectionId);
+            if (it != mContexts.end())
+            {
+                it->second.binaryExpected = view.binarySize;
+                it->second.binaryReceived = 0;
+                it->second.binaryMsgId.assign(view.msgId);
+            }
+        }
+        break;
+
+    case Protocol::MessageType::Acknowledge:
+        // Acks of our own acks would ping-pong forever - drop them
+        break;
+
+    default:
+        // Hello, Error, and application messages are acknowledged directly
+        {
+            Protocol::Message ack(Protocol::MessageType::Acknowledge,
+                                  std::string(view.msgId));
+            SendCounted(pWebSocket, Protocol::SerializeJsonMessage(ack));
+        }
+        break;
+    }
+}
+
+void BenchServer::HandleBinaryFrame(const std::string& pConnectionId,
+                                    ix::WebSocket& pWebSocket,
+                                    const std::string& pData)
+{
+    if (mOptions.mode == Mode::Echo)
+    {
+        mMessagesSent.fetch_add(1, std::memory_order_relaxed);
+        mBytesSent.fetch_add(pData.size(), std::memory_order_relaxed);
+        pWebSocket.sendBinary(pData);
+        return;
+    }
+
+    if (mOptions.mode != Mode::Ack)
+        return;
+
+    // Ack mode: track progress toward the announced size and acknowledge the
+    // BinaryStart once the transfer completes
+    std::string completedMsgId;
+    {
+        std::lock_guard<std::mutex> lock(mContextMutex);
+        auto it = mContexts.find(pConnectionId);
+        if (it == mContexts.end() || it->second.binaryExpected == 0)
+            return;
+
+        it->second.binaryReceived += pData.size();
+        if (it->second.binaryReceived >= it->second.binaryExpected)
+        {
+            completedMsgId = std::move(it->second.binaryMsgId);
+            it->second.binaryExpected = 0;
+            it->second.binaryReceived = 0;
+        }
+    }
+
+    if (!completedMsgId.empty())
+    {
+        Logger::Instance().Debug("BenchServer", [&pConnectionId] {
+            return "[" + pConnectionId + "] Binary transfer complete, acking"; });
+
+        Protocol::Message ack(Protocol::MessageType::Acknowledge, completedMsgId);
+        SendCounted(pWebSocket, Protocol::SerializeJsonMessage(ack));
+    }
+}
+
+void BenchServer::RunBinaryFlood(ix::WebSocket& pWebSocket,
+                                 const std::string& pTriggerMsgId)
+{
+    Logger::Instance().Info("BenchServer",
+        "Flooding " + std::to_string(mOptions.floodTotalBytes) +
+        " bytes (trigger: " + pTriggerMsgId + ")");
+
+    // Announce the transfer the same way the client does
+    Protocol::Message start(Protocol::MessageType::BinaryStart, "flood_" + pTriggerMsgId);
+    start.binarySize = mOptions.floodTotalBytes;
+    SendCounted(pWebSocket, Protocol::SerializeJsonMessage(start));
+
+    // One chunk buffer, reused for every frame - the payload content doesn't
+    // matter for receive-path benchmarks, only the byte volume does
+    const std::string chunk(mOptions.floodChunkBytes, 'x');
+
+    size_t remaining = mOptions.floodTotalBytes;
+    while (remaining > 0)
+    {
+        const size_t frameSize = std::min(remaining, mOptions.floodChunkBytes);
+
+        mMessagesSent.fetch_add(1, std::memory_order_relaxed);
+        mBytesSent.fetch_add(frameSize, std::memory_order_relaxed);
+
+        if (frameSize == chunk.size())
+            pWebSocket.sendBinary(chunk);
+        else
+            pWebSocket.sendBinary(chunk.substr(0, frameSize));
+
+        remaining -= frameSize;
+
+        // Stop flooding promptly on shutdown
+        if (!mRunning.load(std::memory_order_acquire))
+            break;
+    }
+
+    Logger::Instance().Info("BenchServer", "Flood finished");
+}
+
+void BenchServer::SendCounted(ix::WebSocket& pWebSocket, const std::string& pText)
+{
+    mMessagesSent.fetch_add(1, std::memory_order_relaxed);
+    mBytesSent.fetch_add(pText.size(), std::memory_order_relaxed);
+    pWebSocket.sendText(pText);
+}
@@ -0,0 +1,243 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#pragma once
+
+#include <string>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+#include "../Protocol.hpp"
+
+// Forward declarations - the IXWebSocket server types are only needed in the
+// implementation file
+namespace ix
+{
+    class WebSocketServer;
+    class WebSocket;
+}
+
+/**
+ * @class BenchServer
+ * @brief Native multi-connection benchmark server for the TallyIX protocol.
+ *
+ * Replaces the Python echo mock (a single-threaded asyncio server that capped
+ * out far below the client): every benchmark against it measured the mock, not
+ * WsClient. This server is built on the same IXWebSocket dependency as the
+ * client, serves each connection on its own thread, and stays out of the way
+ * so throughput and latency numbers reflect the client under test.
+ *
+ * Modes (selected at startup, matching the Protocol message types):
+ * - Echo: every text and binary frame is sent straight back unchanged.
+ *   The baseline for round-trip throughput and RTT measurements.
+ * - Ack: text frames are parsed as protocol messages and answered with an
+ *   Acknowledge carrying the original msgId - exercises the client's ack
+ *   window engine. A completed binary transfer (announced via BinaryStart)
+ *   is acknowledged with the BinaryStart's msgId.
+ * - BinaryFlood: a received Hello triggers a push of BinaryStart plus a
+ *   configurable volume of binary chunks to that client - exercises the
+ *   client's receive pipeline (reassembly, sinks, parsing) at wire speed.
+ *
+ * Thread Safety:
+ * - Start/Wait/Stop are intended for one controlling thread
+ * - Message handling runs on IXWebSocket's per-connection threads; the
+ *   aggregate counters are atomics and per-connection state is under a mutex
+ *
+ * @example
+ *   BenchServer::Options options;
+ *   options.port = 9001;
+ *   options.mode = BenchServer::Mode::Ack;
+ *
+ *   BenchServer server(options);
+ *   if (server.Start())
+ *       server.Wait();                        // Blocks until Stop()
+ */
+class BenchServer
+{
+public:
+    /**
+     * @enum Mode
+     * @brief Traffic behavior of the server, fixed for its lifetime.
+     */
+    enum class Mode
+    {
+        Echo,         ///< Echo every frame back unchanged (round-trip baseline)
+        Ack,          ///< Answer protocol messages with Acknowledge replies
+        BinaryFlood   ///< Push binary data to each client that sends Hello
+    };
+
+    /**
+     * @struct Options
+     * @brief Startup configuration for the benchmark server.
+     */
+    struct Options
+    {
+        /// Host address to bind to
+        std::string host = "127.0.0.1";
+
+        /// Port to listen on (same default as the old Python mock)
+        int port = 9001;
+
+        /// Traffic behavior - see Mode
+        Mode mode = Mode::Echo;
+
+        /// Enable per-message deflate (RFC 7692) on accepted connections
+        bool enableCompression = false;
+
+        /// Total bytes pushed per Hello in BinaryFlood mode
+        size_t floodTotalBytes = 100 * 1024 * 1024;
+
+        /// Chunk size of the flood frames
+        size_t floodChunkBytes = 256 * 1024;
+    };
+
+    /**
+     * @struct Stats
+     * @brief Aggregate server counters, readable while the server runs.
+     */
+    struct Stats
+    {
+        uint64_t connectionsTotal = 0;    ///< Connections accepted since start
+        uint64_t connectionsActive = 0;   ///< Currently open connections
+        uint64_t messagesReceived = 0;    ///< Frames received (text + binary)
+        uint64_t bytesReceived = 0;       ///< Payload bytes received
+        uint64_t messagesSent = 0;        ///< Frames sent (echoes, acks, flood chunks)
+        uint64_t bytesSent = 0;           ///< Payload bytes sent
+    };
+
+    /**
+     * @brief Construct the server with its startup options (does not listen yet).
+     *
+     * @param pOptions Host, port, mode, and mode parameters
+     */
+    explicit BenchServer(const Options& pOptions);
+
+    /// @brief Destructor - stops the server if still running
+    ~BenchServer();
+
+    // Non-copyable, non-movable (the message callback captures this)
+    BenchServer(const BenchServer&) = delete;
+    BenchServer& operator=(const BenchServer&) = delete;
+
+    /**
+     * @brief Bind, listen, and start accepting connections.
+     *
+     * @return true if the server is listening, false on bind/listen failure
+     */
+    bool Start();
+
+    /**
+     * @brief Block the calling thread until Stop() is called.
+     */
+    void Wait();
+
+    /**
+     * @brief Stop accepting connections and close the existing ones.
+     *
+     * Safe to call from a signal-triggered path or another thread while
+     * Wait() is blocking.
+     */
+    void Stop();
+
+    /**
+     * @brief Snapshot the aggregate counters.
+     *
+     * @return Consistent-enough snapshot for progress and final reporting
+     */
+    Stats GetStats() const;
+
+    /**
+     * @brief Convert a Mode to its command-line spelling.
+     *
+     * @param pMode The mode to convert
+     * @return "echo", "ack", or "flood"
+     */
+    static const char* ModeToString(Mode pMode);
+
+    /**
+     * @brief Parse a command-line mode spelling.
+     *
+     * @param pText One of "echo", "ack", "flood"
+     * @param pMode Receives the parsed mode on success
+     * @return true if the text named a known mode
+     */
+    static bool ParseMode(const std::string& pText, Mode& pMode);
+
+private:
+    /**
+     * @struct ConnectionContext
+     * @brief Per-connection protocol state (keyed by IXWebSocket connection id).
+     */
+    struct ConnectionContext
+    {
+        size_t binaryExpected = 0;   ///< Bytes announced by the last BinaryStart
+        size_t binaryReceived = 0;   ///< Bytes received toward that announcement
+        std::string binaryMsgId;     ///< msgId of the BinaryStart (acked on completion)
+    };
+
+    /**
+     * @brief Handle one text frame per the active mode.
+     *
+     * @param pConnectionId Connection the frame arrived on
+     * @param pWebSocket Socket to reply on
+     * @param pText The frame payload
+     */
+    void HandleTextFrame(const std::string& pConnectionId,
+                         ix::WebSocket& pWebSocket,
+                         const std::string& pText);
+
+    /**
+     * @brief Handle one binary frame per the active mode.
+     *
+     * @param pConnectionId Connection the frame arrived on
+     * @param pWebSocket Socket to reply on
+     * @param pData The frame payload
+     */
+    void HandleBinaryFrame(const std::string& pConnectionId,
+                           ix::WebSocket& pWebSocket,
+                           const std::string& pData);
+
+    /**
+     * @brief Push BinaryStart plus floodTotalBytes of chunks to one client.
+     *
+     * Runs on the connection's own handler thread, so a slow client only
+     * stalls its own flood.
+     *
+     * @param pWebSocket Socket to flood
+     * @param pTriggerMsgId msgId of the Hello that triggered the flood
+     */
+    void RunBinaryFlood(ix::WebSocket& pWebSocket, const std::string& pTriggerMsgId);
+
+    /**
+     * @brief Send a text reply and count it.
+     *
+     * @param pWebSocket Socket to send on
+     * @param pText Payload to send
+     */
+    void SendCounted(ix::WebSocket& pWebSocket, const std::string& pText);
+
+    /// @brief Startup options (fixed after construction)
+    Options mOptions;
+
+    /// @brief The underlying IXWebSocket server
+    std::unique_ptr<ix::WebSocketServer> mServer;
+
+    /// @brief Set while the server is accepting connections
+    std::atomic<bool> mRunning{false};
+
+    /// @brief Per-connection protocol state (protected by mContextMutex)
+    std::unordered_map<std::string, ConnectionContext> mContexts;
+
+    /// @brief Protects mContexts
+    std::mutex mContextMutex;
+
+    // Aggregate counters - relaxed atomics, bumped on the per-connection threads
+    std::atomic<uint64_t> mConnectionsTotal{0};
+    std::atomic<uint64_t> mConnectionsActive{0};
+    std::atomic<uint64_t> mMessagesReceived{0};
+    std::atomic<uint64_t> mBytesReceived{0};
+    std::atomic<uint64_t> mMessagesSent{0};
+    std::atomic<uint64_t> mBytesSent{0};
+};
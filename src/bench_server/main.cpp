@@ -0,0 +1,117 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#include <iostream>
+#include <string>
+#include <csignal>
+#include <cstdlib>
+
+#include "BenchServer.hpp"
+#include "../Logger.hpp"
+
+/**
+ * @file main.cpp
+ * @brief Entry point of the native benchmark server (BenchServer target).
+ *
+ * Replaces src/server_mock/echo_server.py as the test and benchmark peer.
+ * Runs until Ctrl+C, then prints final counters and exits cleanly.
+ *
+ * Usage:
+ *   BenchServer.exe [--host HOST] [--port PORT] [--mode echo|ack|flood]
+ *                   [--flood-bytes N] [--chunk-bytes N] [--compress] [--verbose]
+ *
+ *   Default: ws://127.0.0.1:9001 in echo mode (same endpoint the old mock used)
+ */
+
+namespace
+{
+    /// The running server, reachable from the signal handler
+    BenchServer* gServer = nullptr;
+
+    /// @brief Ctrl+C handler - request a graceful stop
+    void OnSignal(int)
+    {
+        if (gServer)
+            gServer->Stop();
+    }
+
+    /// @brief Print usage and exit
+    void PrintUsageAndExit(const char* pProgram)
+    {
+        std::cout << "Usage: " << pProgram << " [options]\n"
+                  << "  --host HOST       Bind address (default 127.0.0.1)\n"
+                  << "  --port PORT       Listen port (default 9001)\n"
+                  << "  --mode MODE       echo | ack | flood (default echo)\n"
+                  << "  --flood-bytes N   Bytes pushed per Hello in flood mode (default 100MB)\n"
+                  << "  --chunk-bytes N   Flood chunk size (default 256KB)\n"
+                  << "  --compress        Enable per-message deflate\n"
+                  << "  --verbose         Enable debug logging\n";
+        std::exit(1);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    BenchServer::Options options;
+    bool verbose = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = (i + 1 < argc);
+
+        if (arg == "--host" && hasValue)
+        {
+            options.host = argv[++i];
+        }
+        else if (arg == "--port" && hasValue)
+        {
+            options.port = std::atoi(argv[++i]);
+        }
+        else if (arg == "--mode" && hasValue)
+        {
+            if (!BenchServer::ParseMode(argv[++i], options.mode))
+                PrintUsageAndExit(argv[0]);
+        }
+        else if (arg == "--flood-bytes" && hasValue)
+        {
+            options.floodTotalBytes = static_cast<size_t>(std::atoll(argv[++i]));
+        }
+        else if (arg == "--chunk-bytes" && hasValue)
+        {
+            options.floodChunkBytes = static_cast<size_t>(std::atoll(argv[++i]));
+        }
+        else if (arg == "--compress")
+        {
+            options.enableCompression = true;
+        }
+        else if (arg == "--verbose")
+        {
+            verbose = true;
+        }
+        else
+        {
+            PrintUsageAndExit(argv[0]);
+        }
+    }
+
+    if (options.port <= 0 || options.floodChunkBytes == 0)
+        PrintUsageAndExit(argv[0]);
+
+    // Debug logging costs throughput - keep the benchmark peer quiet by default
+    Logger::Instance().SetMinLevel(verbose ? Logger::Level::Debug
+                                           : Logger::Level::Info);
+
+    BenchServer server(options);
+    gServer = &server;
+    std::signal(SIGINT, OnSignal);
+
+    if (!server.Start())
+    {
+        gServer = nullptr;
+        return 1;
+    }
+
+    server.Wait();
+    gServer = nullptr;
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+// CodeRabbit: Please review this file thoroughly for production readiness
+#pragma once
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <cstdint>
+
+/**
+ * @namespace Bench
+ * @brief Minimal benchmark harness: timing, result collection, JSON output.
+ *
+ * Kept deliberately tiny (one header, no dependencies beyond the standard
+ * library) so the benchmark target never drags a framework into the solution.
+ * Results are collected into a Reporter and written as a JSON array, one
+ * object per benchmark, so CI can diff throughput numbers between builds and
+ * gate releases on regressions.
+ *
+ * @example
+ *   Bench::Reporter reporter;
+ *   reporter.Add(Bench::RunMicro("parse_hello", 1000, 200000, [&] {
+ *       Protocol::ParseJsonMessage(json);
+ *   }));
+ *   reporter.WriteJson("bench_results.json");
+ */
+namespace Bench
+{
+    /**
+     * @struct Result
+     * @brief One benchmark measurement, ready for JSON serialization.
+     */
+    struct Result
+    {
+        std::string name;        ///< Stable identifier, e.g. "parse_view_hello"
+        std::string unit;        ///< Unit of value, e.g. "ns/op", "msgs/sec", "MB/sec"
+        double value = 0.0;      ///< The headline number in that unit
+        uint64_t iterations = 0; ///< Operations measured (0 for one-shot timings)
+        double elapsedSeconds = 0.0;  ///< Wall time of the measured region
+    };
+
+    /// @brief Steady-clock seconds as a double (benchmark timing only)
+    inline double NowSeconds()
+    {
+        return std::chrono::duration<double>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * @brief Run a microbenchmark: warm up, then time pIterations calls of pBody.
+     *
+     * @param pName Stable result identifier
+     * @param pWarmupIterations Untimed calls to settle caches and allocators
+     * @param pIterations Timed calls
+     * @param pBody The operation under test
+     * @return Result with value = nanoseconds per operation
+     */
+    template <typename Body>
+    Result RunMicro(const std::string& pName,
+                    uint64_t pWarmupIterations,
+                    uint64_t pIterations,
+                    Body&& pBody)
+    {
+        for (uint64_t i = 0; i < pWarmupIterations; ++i)
+            pBody();
+
+        const double start = NowSeconds();
+        for (uint64_t i = 0; i < pIterations; ++i)
+            pBody();
+        const double elapsed = NowSeconds() - start;
+
+        Result result;
+        result.name = pName;
+        result.unit = "ns/op";
+        result.value = (elapsed * 1e9) / static_cast<double>(pIterations);
+        result.iterations = pIterations;
+        result.elapsedSeconds = elapsed;
+        return result;
+    }
+
+    /**
+     * @class Reporter
+     * @brief Collects results and writes them as a JSON array.
+     */
+    class Reporter
+    {
+    public:
+        /// @brief Record one result and echo its headline number to stdout
+        void Add(const Result& pResult)
+        {
+            mResults.push_back(pResult);
+
+            std::cout << "  " << pResult.name << ": " << pResult.value << " "
+                      << pResult.unit << " (" << pResult.iterations
+                      << " iterations)" << std::endl;
+        }
+
+        /**
+         * @brief Write all collected results to a JSON file.
+         *
+         * @param pPath Output file path (overwritten)
+         * @return true if the file was written
+         */
+        bool WriteJson(const std::string& pPath) const
+        {
+            std::ofstream out(pPath, std::ios::trunc);
+            if (!out)
+                return false;
+
+            out << "[\n";
+            for (size_t i = 0; i < mResults.size(); ++i)
+            {
+                const Result& r = mResults[i];
+                out << "  {\"name\":\"" << r.name
+                    << "\",\"unit\":\"" << r.unit
+                    << "\",\"value\":" << r.value
+                    << ",\"iterations\":" << r.iterations
+                    << ",\"elapsed_seconds\":" << r.elapsedSeconds << "}"
+                    << (i + 1 < mResults.size() ? "," : "") << "\n";
+            }
+            out << "]\n";
+            return static_cast<bool>(out);
+        }
+
+        /// @brief Number of results collected so far
+        size_t Count() const { return mResults.size(); }
+
+    private:
+        /// @brief Collected results in run order
+        std::vector<Result> mResults;
+    };
+}
@@ -1,601 +1,601 @@
-// CodeRabbit: Please review this file thoroughly for production readiness
-#include <iostream>
-#include <vector>
-#include <thread>
-#include <chrono>
-#include <atomic>
-#include "WsClient.hpp"
-#include "MessageHandler.hpp"
-#include "Logger.hpp"
-
-/**
- * @file main.cpp
- * @brief Example application demonstrating TallyIX WebSocket client usage.
- * 
- * This is a complete working example that shows the recommended pattern for using
- * the WebSocket client:
- * 
- * 1. Implement IMessageHandler to define how your app handles messages
- * 2. Create and configure a WsClient instance
- * 3. Connect to the server
- * 4. Send and receive protocol messages
- * 5. Clean up and disconnect
- * 
- * To test this example:
- * - Start the mock server: python src/server_mock/echo_server.py
- * - Run this application: x64\Debug\VS_Websocket.exe
- * - Observe: Connection -> Send Hello -> Send Binary Metadata -> Send 1MB Data -> Echo Response
- * 
- * @author Your Name
- * @date 2024
- * 
- * @note All logging output is printed to console with timestamps and severity levels
- * @note The WebSocket client uses an internal thread for message handling
- */
-
-/**
- * @class TallyIXMessageHandler
- * @brief Example implementation of IMessageHandler for the TallyIX application.
- * 
- * This class demonstrates how to implement the message handler interface to:
- * - Track incoming messages
- * - Handle different message types appropriately
- * - Accumulate binary data transfers
- * - Report errors and status
- * 
- * In a real application, this would update UI, save to database, trigger business logic, etc.
- * 
- * @note THREAD SAFETY: All handler methods are called from IXWebSocket's internal thread,
- *       NOT the main application thread. If your handler accesses shared state (UI, database,
- *       shared data structures), you MUST provide your own synchronization (mutex, atomic, etc.).
- *       
- *       This example uses mTotalBytesReceived without synchronization because:
- *       1. The protocol guarantees sequential binary transfers (no concurrent chunks)
- *       2. The variable is only accessed from the callback thread
- *       
- *       For production code with shared state, add appropriate mutex protection.
- */
-class TallyIXMessageHandler : public IMessageHandler
-{
-public:
-    /**
-     * @brief Called when a text protocol message is received.
-     * 
-     * This example logs the message type and ID. In a real application,
-     * you would examine the message type and content to decide what to do.
-     * 
-     * @param msg The received text message
-     * @note Called from IXWebSocket's internal thread - synchronize if accessing shared state
-     */
-    void OnTextMessage(const Protocol::Message& msg) override
-    {
-        // Log the message details using the new helper function
-        Logger::Instance().Info("App", 
-            "Received text message - Type: " + 
-            Protocol::MessageTypeToString(msg.type) + 
-            ", MsgID: " + msg.msgId + 
-            ", Content: " + msg.content);
-        
-        // Validate the message using the new helper
-        if (!Protocol::IsValidMessage(msg))
-        {
-            Logger::Instance().Warning("App",
-                "Received invalid or incomplete message");
-            return;
-        }
-        
-        // In a real application, switch on message type and handle accordingly
-        // Example:
-        //   if (msg.type == MessageType::Hello)
-        //       HandleHello(msg);
-        //   else if (msg.type == MessageType::Acknowledge)
-        //       HandleAck(msg);
-    }
-
-    /**
-     * @brief Called when binary data transfer is about to start.
-     * 
-     * The size of the incoming transfer is provided so you can pre-allocate
-     * buffers or prepare for receiving large amounts of data.
-     * 
-     * @param msg Message containing binarySize (total bytes to expect)
-     */
-    void OnBinaryStart(const Protocol::Message& msg) override
-    {
-        // Log the start of binary transfer
-        Logger::Instance().Info("App", 
-            "Binary transfer starting - Expected size: " + 
-            std::to_string(msg.binarySize) + " bytes");
-        
-        // Reset accumulated bytes counter
-        mTotalBytesReceived = 0;
-        
-        // In a real application, you might:
-        // - Pre-allocate a buffer
-        // - Open a file for writing
-        // - Prepare a decompression context
-        // - Etc.
-    }
-
-    /**
-     * @brief Called when a chunk of binary data is received.
-     * 
-     * This may be called multiple times for a single transfer.
-     * Accumulate or process the data as it arrives.
-     * 
-     * @param data Pointer to binary chunk
-     * @param size Size of this chunk in bytes
-     */
-    void OnBinaryChunk(const uint8_t* data, size_t size) override
-    {
-        // Update total received (for progress reporting)
-        mTotalBytesReceived += size;
-        
-        // Log progress (every chunk)
-        Logger::Instance().Debug("App", 
-            "Received binary chunk: " + std::to_string(size) + " bytes " +
-            "(Total: " + std::to_string(mTotalBytesReceived) + ")");
-        
-        // In a real application, you would:
-        // - Write to file
-        // - Append to buffer
-        // - Process data (e.g., decompression, decryption)
-        // - Update progress UI
-        // - Validate checksums
-        // - Etc.
-        
-        // This example just accumulates the count
-    }
-
-    /**
-     * @brief Called when a complete binary transfer finishes.
-     * 
-     * All expected data has been received and passed to OnBinaryChunk calls.
-     * Now validate or finalize the transfer.
-     */
-    void OnBinaryComplete() override
-    {
-        // Log completion
-        Logger::Instance().Info("App", 
-            "Binary transfer complete - " + 
-            std::to_string(mTotalBytesReceived) + " bytes received");
-        
-        // In a real application, you would:
-        // - Close the file
-        // - Finalize decompression/decryption
-        // - Validate checksum
-        // - Update database
-        // - Notify user
-        // - Etc.
-    }
-
-    /**
-     * @brief Called when a protocol error occurs.
-     * 
-     * Report the error and take appropriate action (retry, abort, etc.)
-     * 
-     * @param reason Human-readable error description
-     */
-    void OnProtocolError(const std::string& reason) override
-    {
-        // Log the protocol error with details
-        Logger::Instance().Error("App", 
-            "Protocol error: " + reason);
-        
-        // In a real application, you would:
-        // - Abort ongoing operations
-        // - Request reconnection
-        // - Log to error tracking system
-        // - Notify user
-        // - Implement retry logic
-        // - Etc.
-    }
-
-    /**
-     * @brief Called when a ping frame is received from the server.
-     * 
-     * @param payload The ping payload data
-     */
-    void OnPing(const std::string& payload) override
-    {
-        Logger::Instance().Info("App", 
-            "Received PING from server" + 
-            (payload.empty() ? "" : ": " + payload));
-        ++mPingCount;  // Atomic increment (thread-safe)
-    }
-
-    /**
-     * @brief Called when a pong frame is received (response to our ping).
-     * 
-     * @param payload The pong payload data (echoes our ping payload)
-     */
-    void OnPong(const std::string& payload) override
-    {
-        Logger::Instance().Info("App", 
-            "Received PONG from server" + 
-            (payload.empty() ? "" : ": " + payload));
-        ++mPongCount;  // Atomic increment (thread-safe)
-    }
-
-    /// @brief Get the number of pings received (thread-safe)
-    int GetPingCount() const { return mPingCount.load(); }
-    
-    /// @brief Get the number of pongs received (thread-safe)
-    int GetPongCount() const { return mPongCount.load(); }
-
-private:
-    /// Running total of bytes received in current binary transfer
-    size_t mTotalBytesReceived = 0;
-    
-    /// Count of ping frames received (atomic for thread safety)
-    std::atomic<int> mPingCount{0};
-    
-    /// Count of pong frames received (atomic for thread safety)
-    std::atomic<int> mPongCount{0};
-};
-
-/**
- * @brief Main application entry point.
- * 
- * Demonstrates the complete lifecycle of WebSocket client usage:
- * 1. Configure the client
- * 2. Set up message handler
- * 3. Initialize and connect
- * 4. Exchange protocol messages
- * 5. Gracefully shutdown
- * 
- * @return 0 on success, -1 on error
- */
-int main()
-{
-    // === INITIALIZATION ===
-    
-    // Configure logging level (Debug shows everything, Info hides debug messages)
-    // For production, use Logger::Level::Warning to reduce noise
-#ifdef NDEBUG
-    Logger::Instance().SetMinLevel(Logger::Level::Info);  // Release: less verbose
-#else
-    Logger::Instance().SetMinLevel(Logger::Level::Debug); // Debug: show everything
-#endif
-    
-    Logger::Instance().Info("Main", 
-        "====================================================");
-    Logger::Instance().Info("Main", 
-        "  TallyIX WebSocket POC - v2.0");
-    Logger::Instance().Info("Main", 
-        "====================================================");
-
-    // Create protocol configuration
-    // These settings can be adjusted based on your network conditions and data sizes
-    Protocol::Config config;
-    config.connectionTimeoutMs = 10000;      // Wait up to 10 seconds for connection
-    config.messageTimeoutMs = 5000;          // Wait up to 5 seconds for responses
-    config.maxBinaryPayloadSize = 100 * 1024 * 1024;  // Allow 100MB binary messages
-    config.enableCompression = true;         // Enable per-message deflate compression
-    config.pingIntervalSeconds = 30;         // Automatic heartbeat every 30 seconds
-
-    Logger::Instance().Info("Main", 
-        "Configuration: timeout=" + 
-        std::to_string(config.connectionTimeoutMs) + "ms, " +
-        "maxBinarySize=" + 
-        std::to_string(config.maxBinaryPayloadSize / (1024 * 1024)) + "MB, " +
-        "compression=" + (config.enableCompression ? "ON" : "OFF") + ", " +
-        "heartbeat=" + std::to_string(config.pingIntervalSeconds) + "s");
-
-    // Create WebSocket client with configuration
-    WsClient client(config);
-
-    // Create and attach the message handler
-    // The handler will receive all protocol messages from the server
-    TallyIXMessageHandler appHandler;
-    client.SetMessageHandler(&appHandler);
-
-    Logger::Instance().Info("Main", "Message handler attached");
-
-    // === NETWORK INITIALIZATION ===
-
-    // Initialize the network system (must be called once per application)
-    // Retry logic for Open() in case of transient failures
-    const int maxOpenAttempts = 3;
-    bool openSuccess = false;
-    
-    for (int attempt = 1; attempt <= maxOpenAttempts; ++attempt)
-    {
-        Logger::Instance().Info("Main", 
-            "Network initialization attempt " + std::to_string(attempt) + 
-            "/" + std::to_string(maxOpenAttempts));
-        
-        if (client.Open())
-        {
-            openSuccess = true;
-            Logger::Instance().Info("Main", "Network system initialized");
-            break;
-        }
-        
-        Logger::Instance().Error("Main", 
-            "Failed to initialize WebSocket client (attempt " + 
-            std::to_string(attempt) + "/" + std::to_string(maxOpenAttempts) + ")");
-        
-        if (attempt < maxOpenAttempts)
-        {
-            int backoffMs = 1000 * attempt;  // Linear backoff: 1s, 2s, 3s
-            Logger::Instance().Info("Main", 
-                "Retrying in " + std::to_string(backoffMs) + "ms...");
-            std::this_thread::sleep_for(std::chrono::milliseconds(backoffMs));
-        }
-    }
-    
-    if (!openSuccess)
-    {
-        Logger::Instance().Error("Main", 
-            "FATAL: Failed to initialize WebSocket client after " + 
-            std::to_string(maxOpenAttempts) + " attempts");
-        return -1;  // Fatal error - cannot continue without network system
-    }
-
-    // === CONNECTION WITH RETRY LOGIC ===
-
-    // Connection retry configuration
-    const int maxConnectionAttempts = 5;
-    int initialBackoffMs = 500;  // Start with 500ms
-    bool connectionSuccess = false;
-    
-    Logger::Instance().Info("Main", 
-        "Starting connection attempts (max: " + 
-        std::to_string(maxConnectionAttempts) + 
-        ", exponential backoff)");
-
-    for (int attempt = 1; attempt <= maxConnectionAttempts; ++attempt)
-    {
-        // Calculate exponential backoff: 500ms, 1s, 2s, 4s, 8s
-        int backoffMs = initialBackoffMs * (1 << (attempt - 1));
-        
-        Logger::Instance().Info("Main", 
-            "Connection attempt " + std::to_string(attempt) + 
-            "/" + std::to_string(maxConnectionAttempts) + 
-            " to ws://127.0.0.1:9001");
-        
-        // Initiate connection to the server (non-blocking)
-        if (!client.Connect("ws://127.0.0.1:9001"))
-        {
-            Logger::Instance().Error("Main", 
-                "Failed to initiate connection (attempt " + 
-                std::to_string(attempt) + ")");
-            
-            if (attempt < maxConnectionAttempts)
-            {
-                Logger::Instance().Info("Main", 
-                    "Retrying in " + std::to_string(backoffMs) + "ms...");
-                std::this_thread::sleep_for(std::chrono::milliseconds(backoffMs));
-            }
-            continue;  // Try next attempt
-        }
-
-        Logger::Instance().Info("Main", 
-            "Connection initiated, waiting for establishment...");
-
-        // Block until connection is established or times out
-        if (!client.WaitForConnection(config.connectionTimeoutMs))
-        {
-            Logger::Instance().Error("Main", 
-                "Connection failed or timed out after " + 
-                std::to_string(config.connectionTimeoutMs) + 
-                "ms (attempt " + std::to_string(attempt) + ")");
-            
-            // Close failed connection before retry
-            client.Close();
-            
-            if (attempt < maxConnectionAttempts)
-            {
-                Logger::Instance().Info("Main", 
-                    "Retrying in " + std::to_string(backoffMs) + "ms...");
-                std::this_thread::sleep_for(std::chrono::milliseconds(backoffMs));
-            }
-            continue;  // Try next attempt
-        }
-
-        // Success!
-        connectionSuccess = true;
-        Logger::Instance().Info("Main", 
-            "Connected to server successfully on attempt " + 
-            std::to_string(attempt) + "!");
-        Logger::Instance().Debug("Main",
-            "Connection state: " + client.GetStateString());
-        break;
-    }
-
-    // Handle connection failure after all retries exhausted
-    if (!connectionSuccess)
-    {
-        Logger::Instance().Error("Main", 
-            "FATAL: Failed to connect to server after " + 
-            std::to_string(maxConnectionAttempts) + " attempts");
-        
-        // Graceful degradation: could implement fallback behavior here
-        // For example:
-        // - Enable offline mode
-        // - Queue operations for later retry
-        // - Trigger monitoring/alerting system
-        // - Start with limited functionality
-        
-        Logger::Instance().Warning("Main", 
-            "Consider implementing graceful degradation or alerting here");
-        
-        return -1;  // Exit application - no fallback implemented yet
-    }
-
-    // === PROTOCOL COMMUNICATION ===
-
-    // Send a Hello message to initiate communication
-    Logger::Instance().Info("Main", 
-        "Sending Hello message...");
-    
-    Protocol::Message helloMsg(
-        Protocol::MessageType::Hello, 
-        "msg_001",                           // Unique message ID
-        "Hello from TallyIX POC");           // Message content
-    std::string helloJson = Protocol::SerializeJsonMessage(helloMsg);
-    
-    if (!client.SendText(helloJson))
-    {
-        Logger::Instance().Error("Main", 
-            "ERROR: Failed to send hello message");
-        client.Close();
-        return -1;
-    }
-
-    Logger::Instance().Info("Main", 
-        "Hello message sent: " + helloJson);
-
-    // === BINARY TRANSFER EXAMPLE ===
-
-    // Send metadata about upcoming binary data
-    Logger::Instance().Info("Main", 
-        "Preparing to send 1MB binary data...");
-    
-    Protocol::Message binaryMetaMsg(
-        Protocol::MessageType::BinaryStart,
-        "msg_002");                          // Unique message ID
-    binaryMetaMsg.binarySize = 1024 * 1024; // 1MB of binary data coming
-    std::string metaJson = Protocol::SerializeJsonMessage(binaryMetaMsg);
-    
-    if (!client.SendText(metaJson))
-    {
-        Logger::Instance().Error("Main", 
-            "ERROR: Failed to send binary metadata");
-        client.Close();
-        return -1;
-    }
-
-    Logger::Instance().Info("Main", 
-        "Binary metadata sent - 1MB transfer announced");
-
-    // Create 1MB of binary payload
-    // In a real application, this would be actual data (images, files, etc.)
-    // Using 0xAB (171) as a test pattern
-    std::vector<uint8_t> binaryData(1024 * 1024, 0xAB);
-
-    Logger::Instance().Info("Main", 
-        "Sending 1MB binary payload...");
-    
-    if (!client.SendBinary(binaryData.data(), binaryData.size()))
-    {
-        Logger::Instance().Error("Main", 
-            "ERROR: Failed to send binary data");
-        client.Close();
-        return -1;
-    }
-
-    Logger::Instance().Info("Main", 
-        "Binary payload sent: " + 
-        std::to_string(binaryData.size()) + " bytes");
-
-    // === PING/PONG DEMO ===
-
-    Logger::Instance().Info("Main", 
-        "=== PING/PONG Demo ===");
-    
-    // Send a manual ping to the server
-    Logger::Instance().Info("Main", 
-        "Sending manual ping...");
-    
-    if (client.SendPing("manual_ping_1"))
-    {
-        Logger::Instance().Info("Main", 
-            "Ping sent successfully");
-    }
-    else
-    {
-        Logger::Instance().Warning("Main", 
-            "Failed to send ping");
-    }
-
-    // Wait a moment for pong response
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
-
-    // Send another ping with different payload
-    if (client.SendPing("manual_ping_2"))
-    {
-        Logger::Instance().Info("Main", 
-            "Second ping sent");
-    }
-
-    // === COMPRESSION DEMO ===
-
-    Logger::Instance().Info("Main", 
-        "=== COMPRESSION Demo ===");
-    
-    // Compression is already enabled via config
-    // Let's demonstrate toggling it
-    Logger::Instance().Info("Main", 
-        "Compression is " + std::string(config.enableCompression ? "ENABLED" : "DISABLED"));
-    
-    // Send a text message (will be compressed if enabled)
-    Protocol::Message compressedMsg(
-        Protocol::MessageType::Hello,
-        "msg_003",
-        "This text message is sent with compression enabled");
-    
-    if (client.SendText(Protocol::SerializeJsonMessage(compressedMsg)))
-    {
-        Logger::Instance().Info("Main", 
-            "Sent message (with compression)");
-    }
-
-    // Toggle compression off and send another message
-    client.DisableCompression();
-    
-    Protocol::Message uncompressedMsg(
-        Protocol::MessageType::Hello,
-        "msg_004",
-        "This text message is sent WITHOUT compression");
-    
-    if (client.SendText(Protocol::SerializeJsonMessage(uncompressedMsg)))
-    {
-        Logger::Instance().Info("Main", 
-            "Sent message (without compression)");
-    }
-
-    // Re-enable compression
-    client.EnableCompression();
-
-    // === WAIT FOR SERVER RESPONSE ===
-
-    Logger::Instance().Info("Main", 
-        "Waiting for server response (3 seconds)...");
-    
-    // Wait for the server to echo back the messages
-    // The handler will log all received messages
-    std::this_thread::sleep_for(std::chrono::seconds(3));
-
-    Logger::Instance().Info("Main", 
-        "Wait period complete");
-
-    // === STATISTICS ===
-    
-    Logger::Instance().Info("Main", 
-        "=== Session Statistics ===");
-    Logger::Instance().Info("Main", 
-        "Pings received: " + std::to_string(appHandler.GetPingCount()));
-    Logger::Instance().Info("Main", 
-        "Pongs received: " + std::to_string(appHandler.GetPongCount()));
-
-    // === CLEANUP ===
-
-    Logger::Instance().Info("Main", 
-        "Closing connection...");
-    
-    // Gracefully close the connection
-    client.Close();
-
-    Logger::Instance().Info("Main", 
-        "Final state: " + client.GetStateString());
-    Logger::Instance().Info("Main", 
-        "====================================================");
-    Logger::Instance().Info("Main", 
-        "  TallyIX WebSocket POC - Complete");
-    Logger::Instance().Info("Main", 
-        "====================================================");
-
-    return 0;  // Success!
-}
+// CodeRabbit: Please review this file thoroughly for production readiness
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include "WsClient.hpp"
+#include "MessageHandler.hpp"
+#include "Logger.hpp"
+
+/**
+ * @file main.cpp
+ * @brief Example application demonstrating TallyIX WebSocket client usage.
+ * 
+ * This is a complete working example that shows the recommended pattern for using
+ * the WebSocket client:
+ * 
+ * 1. Implement IMessageHandler to define how your app handles messages
+ * 2. Create and configure a WsClient instance
+ * 3. Connect to the server
+ * 4. Send and receive protocol messages
+ * 5. Clean up and disconnect
+ * 
+ * To test this example:
+ * - Start the benchmark server: x64\Debug\BenchServer.exe
+ * - Run this application: x64\Debug\VS_Websocket.exe
+ * - Observe: Connection -> Send Hello -> Send Binary Metadata -> Send 1MB Data -> Echo Response
+ * 
+ * @author Your Name
+ * @date 2024
+ * 
+ * @note All logging output is printed to console with timestamps and severity levels
+ * @note The WebSocket client uses an internal thread for message handling
+ */
+
+/**
+ * @class TallyIXMessageHandler
+ * @brief Example implementation of IMessageHandler for the TallyIX application.
+ * 
+ * This class demonstrates how to implement the message handler interface to:
+ * - Track incoming messages
+ * - Handle different message types appropriately
+ * - Accumulate binary data transfers
+ * - Report errors and status
+ * 
+ * In a real application, this would update UI, save to database, trigger business logic, etc.
+ * 
+ * @note THREAD SAFETY: All handler methods are called from IXWebSocket's internal thread,
+ *       NOT the main application thread. If your handler accesses shared state (UI, database,
+ *       shared data structures), you MUST provide your own synchronization (mutex, atomic, etc.).
+ *       
+ *       This example uses mTotalBytesReceived without synchronization because:
+ *       1. The protocol guarantees sequential binary transfers (no concurrent chunks)
+ *       2. The variable is only accessed from the callback thread
+ *       
+ *       For production code with shared state, add appropriate mutex protection.
+ */
+class TallyIXMessageHandler : public IMessageHandler
+{
+public:
+    /**
+     * @brief Called when a text protocol message is received.
+     * 
+     * This example logs the message type and ID. In a real application,
+     * you would examine the message type and content to decide what to do.
+     * 
+     * @param msg The received text message
+     * @note Called from IXWebSocket's internal thread - synchronize if accessing shared state
+     */
+    void OnTextMessage(const Protocol::Message& msg) override
+    {
+        // Log the message details using the new helper function
+        Logger::Instance().Info("App", 
+            "Received text message - Type: " + 
+            Protocol::MessageTypeToString(msg.type) + 
+            ", MsgID: " + msg.msgId + 
+            ", Content: " + msg.content);
+        
+        // Validate the message using the new helper
+        if (!Protocol::IsValidMessage(msg))
+        {
+            Logger::Instance().Warning("App",
+                "Received invalid or incomplete message");
+            return;
+        }
+        
+        // In a real application, switch on message type and handle accordingly
+        // Example:
+        //   if (msg.type == MessageType::Hello)
+        //       HandleHello(msg);
+        //   else if (msg.type == MessageType::Acknowledge)
+        //       HandleAck(msg);
+    }
+
+    /**
+     * @brief Called when binary data transfer is about to start.
+     * 
+     * The size of the incoming transfer is provided so you can pre-allocate
+     * buffers or prepare for receiving large amounts of data.
+     * 
+     * @param msg Message containing binarySize (total bytes to expect)
+     */
+    void OnBinaryStart(const Protocol::Message& msg) override
+    {
+        // Log the start of binary transfer
+        Logger::Instance().Info("App", 
+            "Binary transfer starting - Expected size: " + 
+            std::to_string(msg.binarySize) + " bytes");
+        
+        // Reset accumulated bytes counter
+        mTotalBytesReceived = 0;
+        
+        // In a real application, you might:
+        // - Pre-allocate a buffer
+        // - Open a file for writing
+        // - Prepare a decompression context
+        // - Etc.
+    }
+
+    /**
+     * @brief Called when a chunk of binary data is received.
+     * 
+     * This may be called multiple times for a single transfer.
+     * Accumulate or process the data as it arrives.
+     * 
+     * @param data Pointer to binary chunk
+     * @param size Size of this chunk in bytes
+     */
+    void OnBinaryChunk(const uint8_t* data, size_t size) override
+    {
+        // Update total received (for progress reporting)
+        mTotalBytesReceived += size;
+        
+        // Log progress (every chunk)
+        Logger::Instance().Debug("App", 
+            "Received binary chunk: " + std::to_string(size) + " bytes " +
+            "(Total: " + std::to_string(mTotalBytesReceived) + ")");
+        
+        // In a real application, you would:
+        // - Write to file
+        // - Append to buffer
+        // - Process data (e.g., decompression, decryption)
+        // - Update progress UI
+        // - Validate checksums
+        // - Etc.
+        
+        // This example just accumulates the count
+    }
+
+    /**
+     * @brief Called when a complete binary transfer finishes.
+     * 
+     * All expected data has been received and passed to OnBinaryChunk calls.
+     * Now validate or finalize the transfer.
+     */
+    void OnBinaryComplete() override
+    {
+        // Log completion
+        Logger::Instance().Info("App", 
+            "Binary transfer complete - " + 
+            std::to_string(mTotalBytesReceived) + " bytes received");
+        
+        // In a real application, you would:
+        // - Close the file
+        // - Finalize decompression/decryption
+        // - Validate checksum
+        // - Update database
+        // - Notify user
+        // - Etc.
+    }
+
+    /**
+     * @brief Called when a protocol error occurs.
+     * 
+     * Report the error and take appropriate action (retry, abort, etc.)
+     * 
+     * @param reason Human-readable error description
+     */
+    void OnProtocolError(const std::string& reason) override
+    {
+        // Log the protocol error with details
+        Logger::Instance().Error("App", 
+            "Protocol error: " + reason);
+        
+        // In a real application, you would:
+        // - Abort ongoing operations
+        // - Request reconnection
+        // - Log to error tracking system
+        // - Notify user
+        // - Implement retry logic
+        // - Etc.
+    }
+
+    /**
+     * @brief Called when a ping frame is received from the server.
+     * 
+     * @param payload The ping payload data
+     */
+    void OnPing(const std::string& payload) override
+    {
+        Logger::Instance().Info("App", 
+            "Received PING from server" + 
+            (payload.empty() ? "" : ": " + payload));
+        ++mPingCount;  // Atomic increment (thread-safe)
+    }
+
+    /**
+     * @brief Called when a pong frame is received (response to our ping).
+     * 
+     * @param payload The pong payload data (echoes our ping payload)
+     */
+    void OnPong(const std::string& payload) override
+    {
+        Logger::Instance().Info("App", 
+            "Received PONG from server" + 
+            (payload.empty() ? "" : ": " + payload));
+        ++mPongCount;  // Atomic increment (thread-safe)
+    }
+
+    /// @brief Get the number of pings received (thread-safe)
+    int GetPingCount() const { return mPingCount.load(); }
+    
+    /// @brief Get the number of pongs received (thread-safe)
+    int GetPongCount() const { return mPongCount.load(); }
+
+private:
+    /// Running total of bytes received in current binary transfer
+    size_t mTotalBytesReceived = 0;
+    
+    /// Count of ping frames received (atomic for thread safety)
+    std::atomic<int> mPingCount{0};
+    
+    /// Count of pong frames received (atomic for thread safety)
+    std::atomic<int> mPongCount{0};
+};
+
+/**
+ * @brief Main application entry point.
+ * 
+ * Demonstrates the complete lifecycle of WebSocket client usage:
+ * 1. Configure the client
+ * 2. Set up message handler
+ * 3. Initialize and connect
+ * 4. Exchange protocol messages
+ * 5. Gracefully shutdown
+ * 
+ * @return 0 on success, -1 on error
+ */
+int main()
+{
+    // === INITIALIZATION ===
+    
+    // Configure logging level (Debug shows everything, Info hides debug messages)
+    // For production, use Logger::Level::Warning to reduce noise
+#ifdef NDEBUG
+    Logger::Instance().SetMinLevel(Logger::Level::Info);  // Release: less verbose
+#else
+    Logger::Instance().SetMinLevel(Logger::Level::Debug); // Debug: show everything
+#endif
+    
+    Logger::Instance().Info("Main", 
+        "====================================================");
+    Logger::Instance().Info("Main", 
+        "  TallyIX WebSocket POC - v2.0");
+    Logger::Instance().Info("Main", 
+        "====================================================");
+
+    // Create protocol configuration
+    // These settings can be adjusted based on your network conditions and data sizes
+    Protocol::Config config;
+    config.connectionTimeoutMs = 10000;      // Wait up to 10 seconds for connection
+    config.messageTimeoutMs = 5000;          // Wait up to 5 seconds for responses
+    config.maxBinaryPayloadSize = 100 * 1024 * 1024;  // Allow 100MB binary messages
+    config.enableCompression = true;         // Enable per-message deflate compression
+    config.pingIntervalSeconds = 30;         // Automatic heartbeat every 30 seconds
+
+    Logger::Instance().Info("Main", 
+        "Configuration: timeout=" + 
+        std::to_string(config.connectionTimeoutMs) + "ms, " +
+        "maxBinarySize=" + 
+        std::to_string(config.maxBinaryPayloadSize / (1024 * 1024)) + "MB, " +
+        "compression=" + (config.enableCompression ? "ON" : "OFF") + ", " +
+        "heartbeat=" + std::to_string(config.pingIntervalSeconds) + "s");
+
+    // Create WebSocket client with configuration
+    WsClient client(config);
+
+    // Create and attach the message handler
+    // The handler will receive all protocol messages from the server
+    TallyIXMessageHandler appHandler;
+    client.SetMessageHandler(&appHandler);
+
+    Logger::Instance().Info("Main", "Message handler attached");
+
+    // === NETWORK INITIALIZATION ===
+
+    // Initialize the network system (must be called once per application)
+    // Retry logic for Open() in case of transient failures
+    const int maxOpenAttempts = 3;
+    bool openSuccess = false;
+    
+    for (int attempt = 1; attempt <= maxOpenAttempts; ++attempt)
+    {
+        Logger::Instance().Info("Main", 
+            "Network initialization attempt " + std::to_string(attempt) + 
+            "/" + std::to_string(maxOpenAttempts));
+        
+        if (client.Open())
+        {
+            openSuccess = true;
+            Logger::Instance().Info("Main", "Network system initialized");
+            break;
+        }
+        
+        Logger::Instance().Error("Main", 
+            "Failed to initialize WebSocket client (attempt " + 
+            std::to_string(attempt) + "/" + std::to_string(maxOpenAttempts) + ")");
+        
+        if (attempt < maxOpenAttempts)
+        {
+            int backoffMs = 1000 * attempt;  // Linear backoff: 1s, 2s, 3s
+            Logger::Instance().Info("Main", 
+                "Retrying in " + std::to_string(backoffMs) + "ms...");
+            std::this_thread::sleep_for(std::chrono::milliseconds(backoffMs));
+        }
+    }
+    
+    if (!openSuccess)
+    {
+        Logger::Instance().Error("Main", 
+            "FATAL: Failed to initialize WebSocket client after " + 
+            std::to_string(maxOpenAttempts) + " attempts");
+        return -1;  // Fatal error - cannot continue without network system
+    }
+
+    // === CONNECTION WITH RETRY LOGIC ===
+
+    // Connection retry configuration
+    const int maxConnectionAttempts = 5;
+    int initialBackoffMs = 500;  // Start with 500ms
+    bool connectionSuccess = false;
+    
+    Logger::Instance().Info("Main", 
+        "Starting connection attempts (max: " + 
+        std::to_string(maxConnectionAttempts) + 
+        ", exponential backoff)");
+
+    for (int attempt = 1; attempt <= maxConnectionAttempts; ++attempt)
+    {
+        // Calculate exponential backoff: 500ms, 1s, 2s, 4s, 8s
+        int backoffMs = initialBackoffMs * (1 << (attempt - 1));
+        
+        Logger::Instance().Info("Main", 
+            "Connection attempt " + std::to_string(attempt) + 
+            "/" + std::to_string(maxConnectionAttempts) + 
+            " to ws://127.0.0.1:9001");
+        
+        // Initiate connection to the server (non-blocking)
+        if (!client.Connect("ws://127.0.0.1:9001"))
+        {
+            Logger::Instance().Error("Main", 
+                "Failed to initiate connection (attempt " + 
+                std::to_string(attempt) + ")");
+            
+            if (attempt < maxConnectionAttempts)
+            {
+                Logger::Instance().Info("Main", 
+                    "Retrying in " + std::to_string(backoffMs) + "ms...");
+                std::this_thread::sleep_for(std::chrono::milliseconds(backoffMs));
+            }
+            continue;  // Try next attempt
+        }
+
+        Logger::Instance().Info("Main", 
+            "Connection initiated, waiting for establishment...");
+
+        // Block until connection is established or times out
+        if (!client.WaitForConnection(config.connectionTimeoutMs))
+        {
+            Logger::Instance().Error("Main", 
+                "Connection failed or timed out after " + 
+                std::to_string(config.connectionTimeoutMs) + 
+                "ms (attempt " + std::to_string(attempt) + ")");
+            
+            // Close failed connection before retry
+            client.Close();
+            
+            if (attempt < maxConnectionAttempts)
+            {
+                Logger::Instance().Info("Main", 
+                    "Retrying in " + std::to_string(backoffMs) + "ms...");
+                std::this_thread::sleep_for(std::chrono::milliseconds(backoffMs));
+            }
+            continue;  // Try next attempt
+        }
+
+        // Success!
+        connectionSuccess = true;
+        Logger::Instance().Info("Main", 
+            "Connected to server successfully on attempt " + 
+            std::to_string(attempt) + "!");
+        Logger::Instance().Debug("Main",
+            "Connection state: " + client.GetStateString());
+        break;
+    }
+
+    // Handle connection failure after all retries exhausted
+    if (!connectionSuccess)
+    {
+        Logger::Instance().Error("Main", 
+            "FATAL: Failed to connect to server after " + 
+            std::to_string(maxConnectionAttempts) + " attempts");
+        
+        // Graceful degradation: could implement fallback behavior here
+        // For example:
+        // - Enable offline mode
+        // - Queue operations for later retry
+        // - Trigger monitoring/alerting system
+        // - Start with limited functionality
+        
+        Logger::Instance().Warning("Main", 
+            "Consider implementing graceful degradation or alerting here");
+        
+        return -1;  // Exit application - no fallback implemented yet
+    }
+
+    // === PROTOCOL COMMUNICATION ===
+
+    // Send a Hello message to initiate communication
+    Logger::Instance().Info("Main", 
+        "Sending Hello message...");
+    
+    Protocol::Message helloMsg(
+        Protocol::MessageType::Hello, 
+        "msg_001",                           // Unique message ID
+        "Hello from TallyIX POC");           // Message content
+    std::string helloJson = Protocol::SerializeJsonMessage(helloMsg);
+    
+    if (!client.SendText(helloJson))
+    {
+        Logger::Instance().Error("Main", 
+            "ERROR: Failed to send hello message");
+        client.Close();
+        return -1;
+    }
+
+    Logger::Instance().Info("Main", 
+        "Hello message sent: " + helloJson);
+
+    // === BINARY TRANSFER EXAMPLE ===
+
+    // Send metadata about upcoming binary data
+    Logger::Instance().Info("Main", 
+        "Preparing to send 1MB binary data...");
+    
+    Protocol::Message binaryMetaMsg(
+        Protocol::MessageType::BinaryStart,
+        "msg_002");                          // Unique message ID
+    binaryMetaMsg.binarySize = 1024 * 1024; // 1MB of binary data coming
+    std::string metaJson = Protocol::SerializeJsonMessage(binaryMetaMsg);
+    
+    if (!client.SendText(metaJson))
+    {
+        Logger::Instance().Error("Main", 
+            "ERROR: Failed to send binary metadata");
+        client.Close();
+        return -1;
+    }
+
+    Logger::Instance().Info("Main", 
+        "Binary metadata sent - 1MB transfer announced");
+
+    // Create 1MB of binary payload
+    // In a real application, this would be actual data (images, files, etc.)
+    // Using 0xAB (171) as a test pattern
+    std::vector<uint8_t> binaryData(1024 * 1024, 0xAB);
+
+    Logger::Instance().Info("Main", 
+        "Sending 1MB binary payload...");
+    
+    if (!client.SendBinary(binaryData.data(), binaryData.size()))
+    {
+        Logger::Instance().Error("Main", 
+            "ERROR: Failed to send binary data");
+        client.Close();
+        return -1;
+    }
+
+    Logger::Instance().Info("Main", 
+        "Binary payload sent: " + 
+        std::to_string(binaryData.size()) + " bytes");
+
+    // === PING/PONG DEMO ===
+
+    Logger::Instance().Info("Main", 
+        "=== PING/PONG Demo ===");
+    
+    // Send a manual ping to the server
+    Logger::Instance().Info("Main", 
+        "Sending manual ping...");
+    
+    if (client.SendPing("manual_ping_1"))
+    {
+        Logger::Instance().Info("Main", 
+            "Ping sent successfully");
+    }
+    else
+    {
+        Logger::Instance().Warning("Main", 
+            "Failed to send ping");
+    }
+
+    // Wait a moment for pong response
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    // Send another ping with different payload
+    if (client.SendPing("manual_ping_2"))
+    {
+        Logger::Instance().Info("Main", 
+            "Second ping sent");
+    }
+
+    // === COMPRESSION DEMO ===
+
+    Logger::Instance().Info("Main", 
+        "=== COMPRESSION Demo ===");
+    
+    // Compression is already enabled via config
+    // Let's demonstrate toggling it
+    Logger::Instance().Info("Main", 
+        "Compression is " + std::string(config.enableCompression ? "ENABLED" : "DISABLED"));
+    
+    // Send a text message (will be compressed if enabled)
+    Protocol::Message compressedMsg(
+        Protocol::MessageType::Hello,
+        "msg_003",
+        "This text message is sent with compression enabled");
+    
+    if (client.SendText(Protocol::SerializeJsonMessage(compressedMsg)))
+    {
+        Logger::Instance().Info("Main", 
+            "Sent message (with compression)");
+    }
+
+    // Toggle compression off and send another message
+    client.DisableCompression();
+    
+    Protocol::Message uncompressedMsg(
+        Protocol::MessageType::Hello,
+        "msg_004",
+        "This text message is sent WITHOUT compression");
+    
+    if (client.SendText(Protocol::SerializeJsonMessage(uncompressedMsg)))
+    {
+        Logger::Instance().Info("Main", 
+            "Sent message (without compression)");
+    }
+
+    // Re-enable compression
+    client.EnableCompression();
+
+    // === WAIT FOR SERVER RESPONSE ===
+
+    Logger::Instance().Info("Main", 
+        "Waiting for server response (3 seconds)...");
+    
+    // Wait for the server to echo back the messages
+    // The handler will log all received messages
+    std::this_thread::sleep_for(std::chrono::seconds(3));
+
+    Logger::Instance().Info("Main", 
+        "Wait period complete");
+
+    // === STATISTICS ===
+    
+    Logger::Instance().Info("Main", 
+        "=== Session Statistics ===");
+    Logger::Instance().Info("Main", 
+        "Pings received: " + std::to_string(appHandler.GetPingCount()));
+    Logger::Instance().Info("Main", 
+        "Pongs received: " + std::to_string(appHandler.GetPongCount()));
+
+    // === CLEANUP ===
+
+    Logger::Instance().Info("Main", 
+        "Closing connection...");
+    
+    // Gracefully close the connection
+    client.Close();
+
+    Logger::Instance().Info("Main", 
+        "Final state: " + client.GetStateString());
+    Logger::Instance().Info("Main", 
+        "====================================================");
+    Logger::Instance().Info("Main", 
+        "  TallyIX WebSocket POC - Complete");
+    Logger::Instance().Info("Main", 
+        "====================================================");
+
+    return 0;  // Success!
+}